@@ -53,3 +53,28 @@ if(NOT SKIP_L0_UNIT_TESTS AND BUILD_WITH_L0)
 endif()
 
 add_dependencies(run_unit_tests run_${product}_unit_tests)
+
+# Host overhead benchmarks are disabled tests of the unit test binaries, they are built with
+# unit tests but run only on request. Results of every binary are written as json.
+add_custom_target(run_${product}_benchmarks DEPENDS unit_tests)
+set_target_properties(run_${product}_benchmarks PROPERTIES FOLDER "${PLATFORM_SPECIFIC_TEST_TARGETS_FOLDER}/${product}")
+if(NOT SKIP_NEO_UNIT_TESTS)
+    add_custom_command(
+      TARGET run_${product}_benchmarks
+      POST_BUILD
+      COMMAND WORKING_DIRECTORY ${TargetDir}
+      COMMAND echo Running igdrcl_tests benchmarks ${target} ${slices}x${subslices}x${eu_per_ss} in ${TargetDir}/${product}
+      COMMAND ${CMAKE_COMMAND} -E env NEO_BENCHMARK_OUTPUT=${TargetDir}/${product}/igdrcl_tests_benchmarks.json $<TARGET_FILE:igdrcl_tests> --product ${product} --slices ${slices} --subslices ${subslices} --eu_per_ss ${eu_per_ss} --gtest_also_run_disabled_tests --gtest_filter=*Benchmark.DISABLED_*
+    )
+endif()
+
+if(NOT SKIP_L0_UNIT_TESTS AND BUILD_WITH_L0)
+    add_custom_command(
+      TARGET run_${product}_benchmarks
+      POST_BUILD
+      COMMAND WORKING_DIRECTORY ${TargetDir}
+      COMMAND echo Running ze_intel_gpu_core_tests benchmarks ${target} ${slices}x${subslices}x${eu_per_ss} in ${TargetDir}/${product}
+      COMMAND ${CMAKE_COMMAND} -E env NEO_BENCHMARK_OUTPUT=${TargetDir}/${product}/ze_intel_gpu_core_tests_benchmarks.json $<TARGET_FILE:ze_intel_gpu_core_tests> --product ${product} --slices ${slices} --subslices ${subslices} --eu_per_ss ${eu_per_ss} --gtest_also_run_disabled_tests --gtest_filter=*Benchmark.DISABLED_*
+    )
+endif()
+
@@ -0,0 +1,23 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/api/experimental/ze_exp_cmdlist.h"
+
+#include "level_zero/core/source/cmdlist/cmdlist.h"
+
+extern "C" {
+
+__zedllexport ze_result_t __zecall
+zeCommandListUpdateKernelLaunchExp(
+    ze_command_list_handle_t hCommandList,
+    uint32_t launchIndex,
+    ze_kernel_handle_t hKernel,
+    const ze_group_count_t *pLaunchFuncArgs) {
+    return L0::CommandList::fromHandle(hCommandList)->updateKernelLaunch(launchIndex, hKernel, pLaunchFuncArgs);
+}
+
+} // extern "C"
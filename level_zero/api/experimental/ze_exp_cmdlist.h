@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <level_zero/ze_api.h>
+
+extern "C" {
+
+// Experimental: updates a kernel launch recorded by zeCommandListAppendLaunchKernel in place,
+// so the command list can be executed again without reset and re-recording.
+// launchIndex is the position of the launch among zeCommandListAppendLaunchKernel calls since
+// the last reset. Argument values and group size are taken from the current state of hKernel,
+// which has to be the kernel recorded at launchIndex. ZE_RESULT_ERROR_UNSUPPORTED_SIZE is
+// returned when the new launch does not fit into the space reserved by the recorded one.
+// Available through zeDriverGetExtensionFunctionAddress.
+__zedllexport ze_result_t __zecall
+zeCommandListUpdateKernelLaunchExp(
+    ze_command_list_handle_t hCommandList,
+    uint32_t launchIndex,
+    ze_kernel_handle_t hKernel,
+    const ze_group_count_t *pLaunchFuncArgs);
+
+} // extern "C"
@@ -100,6 +100,8 @@ struct CommandList : _ze_command_list_handle_t {
     virtual ze_result_t appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phEvent) = 0;
     virtual ze_result_t reserveSpace(size_t size, void **ptr) = 0;
     virtual ze_result_t reset() = 0;
+    virtual ze_result_t updateKernelLaunch(uint32_t launchIndex, ze_kernel_handle_t hKernel,
+                                           const ze_group_count_t *pThreadGroupDimensions) = 0;
 
     virtual ze_result_t appendMetricMemoryBarrier() = 0;
     virtual ze_result_t appendMetricTracerMarker(zet_metric_tracer_handle_t hMetricTracer,
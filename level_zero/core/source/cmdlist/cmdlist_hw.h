@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/command_container/command_encoder.h"
+
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
 #include "level_zero/core/source/cmdlist/cmdlist_imp.h"
 
@@ -121,9 +123,16 @@ struct CommandListCoreFamily : CommandListImp {
     ze_result_t appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phEvent) override;
     ze_result_t reserveSpace(size_t size, void **ptr) override;
     ze_result_t reset() override;
+    ze_result_t updateKernelLaunch(uint32_t launchIndex, ze_kernel_handle_t hKernel,
+                                   const ze_group_count_t *pThreadGroupDimensions) override;
     ze_result_t executeCommandListImmediate(bool performMigration) override;
 
   protected:
+    struct MutableKernelLaunch {
+        Kernel *kernel = nullptr;
+        NEO::EncodeDispatchKernelPatchInfo patchInfo;
+    };
+
     MOCKABLE_VIRTUAL ze_result_t appendMemoryCopyKernelWithGA(void *dstPtr, NEO::GraphicsAllocation *dstPtrAlloc,
                                                               uint64_t dstOffset, void *srcPtr,
                                                               NEO::GraphicsAllocation *srcPtrAlloc,
@@ -191,6 +200,10 @@ struct CommandListCoreFamily : CommandListImp {
     uint64_t getInputBufferSize(NEO::ImageType imageType, uint64_t bytesPerPixel, const ze_image_region_t *region);
     virtual AlignedAllocationData getAlignedAllocation(Device *device, const void *buffer, uint64_t bufferSize);
     ze_result_t addEventsToCmdList(ze_event_handle_t hEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
+
+    std::vector<MutableKernelLaunch> mutableKernelLaunches;
+    NEO::EncodeDispatchKernelPatchInfo lastLaunchPatchInfo;
+    bool hasSharedDispatchState = false;
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
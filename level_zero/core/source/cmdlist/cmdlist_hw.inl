@@ -98,6 +98,12 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(ze_kernel_h
         return ret;
     }
 
+    MutableKernelLaunch launch;
+    launch.kernel = Kernel::fromHandle(hKernel);
+    launch.patchInfo = lastLaunchPatchInfo;
+    mutableKernelLaunches.push_back(launch);
+    hasSharedDispatchState |= launch.patchInfo.stateShared;
+
     return ret;
 }
 
@@ -1323,6 +1329,8 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reserveSpace(size_t size, void
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     printfFunctionContainer.clear();
+    mutableKernelLaunches.clear();
+    hasSharedDispatchState = false;
     removeDeallocationContainerData();
     removeHostPtrAllocations();
     commandContainer.reset();
@@ -1333,6 +1341,48 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     return ZE_RESULT_SUCCESS;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateKernelLaunch(uint32_t launchIndex, ze_kernel_handle_t hKernel,
+                                                                     const ze_group_count_t *pThreadGroupDimensions) {
+    auto kernel = Kernel::fromHandle(hKernel);
+    if (launchIndex >= mutableKernelLaunches.size() || mutableKernelLaunches[launchIndex].kernel != kernel ||
+        pThreadGroupDimensions == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    // Blocks written for this launch may be reused by later identical launches, see EnableDispatchStateReuse.
+    auto &patchInfo = mutableKernelLaunches[launchIndex].patchInfo;
+    for (size_t i = launchIndex + 1; hasSharedDispatchState && i < mutableKernelLaunches.size(); i++) {
+        auto &laterPatchInfo = mutableKernelLaunches[i].patchInfo;
+        if (laterPatchInfo.stateShared &&
+            (laterPatchInfo.indirectData == patchInfo.indirectData ||
+             laterPatchInfo.interfaceDescriptor == patchInfo.interfaceDescriptor ||
+             (patchInfo.surfaceStates != nullptr && laterPatchInfo.surfaceStates == patchInfo.surfaceStates))) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_SIZE;
+        }
+    }
+
+    // Checked before group count is set, rejected update leaves both kernel and command list unchanged.
+    if (!NEO::EncodeDispatchKernel<GfxFamily>::canPatchDispatch(patchInfo, kernel)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_SIZE;
+    }
+
+    // Arguments and group size are taken from the current state of the kernel, as on append.
+    kernel->setGroupCount(pThreadGroupDimensions->groupCountX,
+                          pThreadGroupDimensions->groupCountY,
+                          pThreadGroupDimensions->groupCountZ);
+    auto patched = NEO::EncodeDispatchKernel<GfxFamily>::patchDispatch(patchInfo, reinterpret_cast<const void *>(pThreadGroupDimensions), kernel);
+    DEBUG_BREAK_IF(!patched);
+    (void)patched;
+    // Updated blocks no longer hold what later appends would compare against.
+    commandContainer.getDispatchStateCache().invalidate();
+
+    for (auto resource : kernel->getResidencyContainer()) {
+        commandContainer.addToResidencyContainer(resource);
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::prepareIndirectParams(const ze_group_count_t *pThreadGroupDimensions) {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
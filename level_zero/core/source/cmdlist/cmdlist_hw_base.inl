@@ -56,9 +56,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(z
         svmAllocsManager->addInternalAllocationsToResidencyContainer(residencyContainer, unifiedMemoryControls.generateMask());
     }
 
+    lastLaunchPatchInfo = {};
     NEO::EncodeDispatchKernel<GfxFamily>::encode(commandContainer,
                                                  reinterpret_cast<const void *>(pThreadGroupDimensions), isIndirect, isPredicate, kernel,
-                                                 0, device->getNEODevice(), commandListPreemptionMode);
+                                                 0, device->getNEODevice(), commandListPreemptionMode, &lastLaunchPatchInfo);
 
     appendSignalEventPostWalker(hEvent);
 
@@ -335,9 +335,10 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandQueueHw<gfxCoreFamily>::programFrontEnd(uint64_t scratchAddress, NEO::LinearStream &commandStream) {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     UNRECOVERABLE_IF(csr == nullptr);
+    auto perThreadScratchSize = std::max(commandQueuePerThreadScratchSize.load(), csr->getScratchSpaceController()->getPerThreadScratchSpaceSize());
     NEO::PreambleHelper<GfxFamily>::programVFEState(&commandStream,
                                                     device->getHwInfo(),
-                                                    commandQueuePerThreadScratchSize,
+                                                    perThreadScratchSize,
                                                     scratchAddress,
                                                     device->getMaxNumHwThreads(),
                                                     csr->getOsContext().getEngineType());
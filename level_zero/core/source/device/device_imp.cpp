@@ -578,6 +578,7 @@ Device *Device::create(DriverHandle *driverHandle, NEO::Device *neoDevice, uint3
     device->builtins = BuiltinFunctionsLib::create(
         device, neoDevice->getBuiltIns());
     device->maxNumHwThreads = NEO::HwHelper::getMaxThreadsForVfe(neoDevice->getHardwareInfo());
+    device->eventPoolAllocator = std::make_unique<EventPoolAllocator>(neoDevice->getMemoryManager(), neoDevice->getRootDeviceIndex());
 
     const bool allocateDebugSurface = neoDevice->getDeviceInfo().debuggerActive && !isSubDevice;
     NEO::GraphicsAllocation *debugSurface = nullptr;
@@ -658,6 +659,7 @@ DeviceImp::~DeviceImp() {
     }
     metricContext.reset();
     builtins.reset();
+    eventPoolAllocator.reset();
 
     if (neoDevice->getDeviceInfo().debuggerActive) {
         getSourceLevelDebugger()->notifyDeviceDestruction();
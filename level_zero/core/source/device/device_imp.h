@@ -11,6 +11,7 @@
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/driver/driver_handle.h"
+#include "level_zero/core/source/event/event_pool_allocator.h"
 #include "level_zero/tools/source/metrics/metric.h"
 #include "level_zero/tools/source/tracing/tracing.h"
 
@@ -89,6 +90,7 @@ struct DeviceImp : public Device {
     std::vector<Device *> subDevices;
     DriverHandle *driverHandle = nullptr;
     CommandList *pageFaultCommandList = nullptr;
+    std::unique_ptr<EventPoolAllocator> eventPoolAllocator;
 
   protected:
     template <typename DescriptionType, typename ExpectedFlagType>
@@ -89,7 +89,7 @@ ze_result_t DriverHandleImp::getMemAllocProperties(const void *ptr,
     auto alloc = svmAllocsManager->getSVMAlloc(ptr);
     if (alloc) {
         pMemAllocProperties->type = parseUSMType(alloc->memoryType);
-        pMemAllocProperties->id = alloc->gpuAllocation->getGpuAddress();
+        pMemAllocProperties->id = alloc->getGpuAddress();
 
         if (phDevice != nullptr) {
             if (alloc->device == nullptr) {
@@ -108,6 +108,11 @@ ze_result_t DriverHandleImp::getMemAllocProperties(const void *ptr,
 }
 
 DriverHandleImp::~DriverHandleImp() {
+    // unified memory pools are released with the manager and need a live memory manager
+    if (this->svmAllocsManager) {
+        delete this->svmAllocsManager;
+        this->svmAllocsManager = nullptr;
+    }
     for (auto &device : this->devices) {
         if (device->getNEODevice()->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]->debugger.get() &&
             !device->getNEODevice()->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]->debugger->isLegacy()) {
@@ -115,10 +120,6 @@ DriverHandleImp::~DriverHandleImp() {
         }
         delete device;
     }
-    if (this->svmAllocsManager) {
-        delete this->svmAllocsManager;
-        this->svmAllocsManager = nullptr;
-    }
 }
 
 ze_result_t DriverHandleImp::initialize(std::vector<std::unique_ptr<NEO::Device>> neoDevices) {
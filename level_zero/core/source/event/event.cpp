@@ -21,6 +21,7 @@
 
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/device/device_imp.h"
+#include "level_zero/core/source/event/event_pool_allocator.h"
 #include "level_zero/tools/source/metrics/metric.h"
 
 #include <queue>
@@ -64,6 +65,17 @@ struct EventImp : public Event {
 
     ze_result_t getTimestamp(ze_event_timestamp_type_t timestampType, void *dstptr) override;
 
+    void reinitialize(EventPool *eventPool, Device *device) {
+        this->device = device;
+        this->eventPool = eventPool;
+        this->hostAddress = nullptr;
+        this->gpuAddress = 0u;
+        this->offsetUsed = -1;
+        this->isTimestampEvent = false;
+        this->metricTracer = nullptr;
+        this->csr = nullptr;
+    }
+
     Device *device;
     EventPool *eventPool;
 
@@ -97,6 +109,15 @@ struct EventPoolImp : public EventPool {
         }
         device = Device::fromHandle(hDevice);
 
+        // IPC pools need their own buffer object to be exportable
+        if ((NEO::DebugManager.flags.EnableEventPoolSlabAllocator.get() == 1) && !(flags & ZE_EVENT_POOL_FLAG_IPC)) {
+            auto slabAllocator = static_cast<DeviceImp *>(device)->eventPoolAllocator.get();
+            if (slabAllocator && slabAllocator->allocate(count * eventSize, isEventPoolUsedForTimestamp, slabChunk)) {
+                eventPoolAllocation = slabChunk.allocation;
+                return;
+            }
+        }
+
         NEO::AllocationProperties properties(
             device->getRootDeviceIndex(), count * eventSize,
             isEventPoolUsedForTimestamp ? NEO::GraphicsAllocation::AllocationType::TIMESTAMP_PACKET_TAG_BUFFER
@@ -108,7 +129,11 @@ struct EventPoolImp : public EventPool {
     }
 
     ~EventPoolImp() override {
-        device->getDriverHandle()->getMemoryManager()->freeGraphicsMemory(eventPoolAllocation);
+        if (slabChunk.allocation != nullptr) {
+            static_cast<DeviceImp *>(device)->eventPoolAllocator->free(slabChunk, isEventPoolUsedForTimestamp);
+        } else {
+            device->getDriverHandle()->getMemoryManager()->freeGraphicsMemory(eventPoolAllocation);
+        }
         eventPoolAllocation = nullptr;
 
         eventTracker.clear();
@@ -161,6 +186,7 @@ struct EventPoolImp : public EventPool {
     std::unordered_map<Event *, int> eventTracker;
 
     std::queue<int> lastEventPoolOffsetUsed;
+    EventPoolAllocator::Chunk slabChunk;
 
   protected:
     const uint32_t eventSize = static_cast<uint32_t>(alignUp(sizeof(struct KernelTimestampEvent),
@@ -169,7 +195,16 @@ struct EventPoolImp : public EventPool {
 };
 
 Event *Event::create(EventPool *eventPool, const ze_event_desc_t *desc, Device *device) {
-    auto event = new EventImp(eventPool, desc->index, device);
+    EventImp *event = nullptr;
+    if (NEO::DebugManager.flags.EnableEventPoolSlabAllocator.get() == 1) {
+        auto slabAllocator = static_cast<DeviceImp *>(device)->eventPoolAllocator.get();
+        event = slabAllocator ? static_cast<EventImp *>(slabAllocator->obtainEvent()) : nullptr;
+    }
+    if (event != nullptr) {
+        event->reinitialize(eventPool, device);
+    } else {
+        event = new EventImp(eventPool, desc->index, device);
+    }
     UNRECOVERABLE_IF(event == nullptr);
     eventPool->reserveEventFromPool(desc->index, static_cast<Event *>(event));
 
@@ -204,6 +239,13 @@ ze_result_t Event::destroy() {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    if (NEO::DebugManager.flags.EnableEventPoolSlabAllocator.get() == 1) {
+        auto slabAllocator = static_cast<DeviceImp *>(eventImp->device)->eventPoolAllocator.get();
+        if (slabAllocator && slabAllocator->storeEvent(this)) {
+            return ZE_RESULT_SUCCESS;
+        }
+    }
+
     delete this;
     return ZE_RESULT_SUCCESS;
 }
@@ -359,9 +401,9 @@ ze_result_t EventPoolImp::reserveEventFromPool(int index, Event *event) {
         lastEventPoolOffsetUsed.pop();
     }
 
-    uint64_t baseHostAddr = reinterpret_cast<uint64_t>(eventPoolAllocation->getUnderlyingBuffer());
+    uint64_t baseHostAddr = reinterpret_cast<uint64_t>(eventPoolAllocation->getUnderlyingBuffer()) + slabChunk.offset;
     event->hostAddress = reinterpret_cast<void *>(baseHostAddr + (event->offsetUsed * eventSize));
-    event->gpuAddress = eventPoolAllocation->getGpuAddress() + (event->offsetUsed * eventSize);
+    event->gpuAddress = eventPoolAllocation->getGpuAddress() + slabChunk.offset + (event->offsetUsed * eventSize);
 
     eventPoolUsedCount++;
 
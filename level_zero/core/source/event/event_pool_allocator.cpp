@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/event/event_pool_allocator.h"
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+#include "level_zero/core/source/event/event.h"
+
+namespace L0 {
+
+constexpr size_t EventPoolAllocator::slabSize;
+constexpr size_t EventPoolAllocator::maxChunkSize;
+constexpr size_t EventPoolAllocator::maxCachedEvents;
+
+EventPoolAllocator::EventPoolAllocator(NEO::MemoryManager *memoryManager, uint32_t rootDeviceIndex)
+    : memoryManager(memoryManager), rootDeviceIndex(rootDeviceIndex) {}
+
+EventPoolAllocator::~EventPoolAllocator() {
+    for (auto event : cachedEvents) {
+        delete event;
+    }
+    cachedEvents.clear();
+
+    for (auto slabs : {&regularSlabs, &timestampSlabs}) {
+        for (auto &slab : *slabs) {
+            DEBUG_BREAK_IF(slab->usedBytes != 0u);
+            memoryManager->freeGraphicsMemory(slab->allocation);
+        }
+        slabs->clear();
+    }
+}
+
+bool EventPoolAllocator::allocate(size_t size, bool timestamp, Chunk &outChunk) {
+    size = alignUp(size, MemoryConstants::cacheLineSize);
+    if ((size == 0u) || (size > maxChunkSize)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto &slabs = getSlabs(timestamp);
+    for (auto &slab : slabs) {
+        if (allocateFromSlab(*slab, size, outChunk)) {
+            return true;
+        }
+    }
+
+    NEO::AllocationProperties properties(rootDeviceIndex, slabSize,
+                                         timestamp ? NEO::GraphicsAllocation::AllocationType::TIMESTAMP_PACKET_TAG_BUFFER
+                                                   : NEO::GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY);
+    properties.alignment = MemoryConstants::cacheLineSize;
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(properties);
+    if (allocation == nullptr) {
+        return false;
+    }
+
+    auto slab = std::make_unique<Slab>();
+    slab->allocation = allocation;
+    slab->freeRanges.insert({0u, slabSize});
+    UNRECOVERABLE_IF(false == allocateFromSlab(*slab, size, outChunk));
+    slabs.push_back(std::move(slab));
+    return true;
+}
+
+void EventPoolAllocator::free(const Chunk &chunk, bool timestamp) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto &slabs = getSlabs(timestamp);
+    for (auto it = slabs.begin(); it != slabs.end(); ++it) {
+        auto &slab = **it;
+        if (slab.allocation != chunk.allocation) {
+            continue;
+        }
+
+        releaseToSlab(slab, chunk.offset, alignUp(chunk.size, MemoryConstants::cacheLineSize));
+
+        // keep a single empty slab around to absorb create/destroy churn
+        if ((slab.usedBytes == 0u) && (slabs.size() > 1u)) {
+            memoryManager->freeGraphicsMemory(slab.allocation);
+            slabs.erase(it);
+        }
+        return;
+    }
+    UNRECOVERABLE_IF(true);
+}
+
+bool EventPoolAllocator::allocateFromSlab(Slab &slab, size_t size, Chunk &outChunk) {
+    for (auto it = slab.freeRanges.begin(); it != slab.freeRanges.end(); ++it) {
+        if (it->second < size) {
+            continue;
+        }
+
+        outChunk.allocation = slab.allocation;
+        outChunk.offset = it->first;
+        outChunk.size = size;
+
+        auto remainingOffset = it->first + size;
+        auto remainingSize = it->second - size;
+        slab.freeRanges.erase(it);
+        if (remainingSize > 0u) {
+            slab.freeRanges.insert({remainingOffset, remainingSize});
+        }
+        slab.usedBytes += size;
+        return true;
+    }
+    return false;
+}
+
+void EventPoolAllocator::releaseToSlab(Slab &slab, size_t offset, size_t size) {
+    UNRECOVERABLE_IF(slab.usedBytes < size);
+    slab.usedBytes -= size;
+
+    auto inserted = slab.freeRanges.insert({offset, size}).first;
+
+    auto next = std::next(inserted);
+    if ((next != slab.freeRanges.end()) && (inserted->first + inserted->second == next->first)) {
+        inserted->second += next->second;
+        slab.freeRanges.erase(next);
+    }
+
+    if (inserted != slab.freeRanges.begin()) {
+        auto prev = std::prev(inserted);
+        if (prev->first + prev->second == inserted->first) {
+            prev->second += inserted->second;
+            slab.freeRanges.erase(inserted);
+        }
+    }
+}
+
+Event *EventPoolAllocator::obtainEvent() {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (cachedEvents.empty()) {
+        return nullptr;
+    }
+    auto event = cachedEvents.back();
+    cachedEvents.pop_back();
+    return event;
+}
+
+bool EventPoolAllocator::storeEvent(Event *event) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (cachedEvents.size() >= maxCachedEvents) {
+        return false;
+    }
+    cachedEvents.push_back(event);
+    return true;
+}
+
+size_t EventPoolAllocator::getSlabsCount(bool timestamp) {
+    std::lock_guard<std::mutex> lock(mtx);
+    return getSlabs(timestamp).size();
+}
+
+size_t EventPoolAllocator::getCachedEventsCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return cachedEvents.size();
+}
+
+} // namespace L0
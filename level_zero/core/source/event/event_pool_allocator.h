@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class GraphicsAllocation;
+class MemoryManager;
+} // namespace NEO
+
+namespace L0 {
+struct Event;
+
+// Carves small event pools out of large, shared allocations so that creating
+// an event pool does not require a dedicated buffer object per pool.
+// Also keeps a bounded cache of destroyed event objects for reuse.
+class EventPoolAllocator : NEO::NonCopyableOrMovableClass {
+  public:
+    struct Chunk {
+        NEO::GraphicsAllocation *allocation = nullptr;
+        size_t offset = 0u;
+        size_t size = 0u;
+    };
+
+    static constexpr size_t slabSize = MemoryConstants::pageSize64k;
+    static constexpr size_t maxChunkSize = slabSize / 4;
+    static constexpr size_t maxCachedEvents = 256u;
+
+    EventPoolAllocator(NEO::MemoryManager *memoryManager, uint32_t rootDeviceIndex);
+    ~EventPoolAllocator();
+
+    bool allocate(size_t size, bool timestamp, Chunk &outChunk);
+    void free(const Chunk &chunk, bool timestamp);
+
+    Event *obtainEvent();
+    bool storeEvent(Event *event);
+
+    size_t getSlabsCount(bool timestamp);
+    size_t getCachedEventsCount();
+
+  protected:
+    struct Slab {
+        NEO::GraphicsAllocation *allocation = nullptr;
+        std::map<size_t, size_t> freeRanges;
+        size_t usedBytes = 0u;
+    };
+
+    bool allocateFromSlab(Slab &slab, size_t size, Chunk &outChunk);
+    void releaseToSlab(Slab &slab, size_t offset, size_t size);
+
+    std::vector<std::unique_ptr<Slab>> &getSlabs(bool timestamp) {
+        return timestamp ? timestampSlabs : regularSlabs;
+    }
+
+    NEO::MemoryManager *memoryManager = nullptr;
+    uint32_t rootDeviceIndex = 0u;
+    std::vector<std::unique_ptr<Slab>> regularSlabs;
+    std::vector<std::unique_ptr<Slab>> timestampSlabs;
+    std::vector<Event *> cachedEvents;
+    std::mutex mtx;
+};
+
+} // namespace L0
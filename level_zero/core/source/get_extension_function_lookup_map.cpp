@@ -7,9 +7,13 @@
 
 #include "level_zero/core/source/get_extension_function_lookup_map.h"
 
+#include "level_zero/api/experimental/ze_exp_cmdlist.h"
+
 namespace L0 {
 std::unordered_map<std::string, void *> getExtensionFunctionsLookupMap() {
-    return std::unordered_map<std::string, void *>();
+    std::unordered_map<std::string, void *> lookupMap;
+    lookupMap["zeCommandListUpdateKernelLaunchExp"] = reinterpret_cast<void *>(zeCommandListUpdateKernelLaunchExp);
+    return lookupMap;
 }
 
-} // namespace L0
\ No newline at end of file
+} // namespace L0
@@ -56,6 +56,7 @@ struct KernelImmutableData {
     const uint8_t *getDynamicStateHeapTemplate() const { return dynamicStateHeapTemplate.get(); }
 
     const NEO::KernelDescriptor &getDescriptor() const { return *kernelDescriptor; }
+    void setDescriptor(NEO::KernelDescriptor *descriptor) { kernelDescriptor = descriptor; }
 
     Device *getDevice() { return this->device; }
 
@@ -16,6 +16,10 @@ namespace L0 {
 ze_result_t DriverHandleImp::getIpcMemHandle(const void *ptr, ze_ipc_mem_handle_t *pIpcHandle) {
     NEO::SvmAllocationData *allocData = svmAllocsManager->getSVMAlloc(ptr);
     if (allocData) {
+        if (allocData->pool) {
+            // the exported handle would cover the whole pool, not this allocation
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
         uint64_t handle = allocData->gpuAllocation->peekInternalHandle(this->getMemoryManager());
         memcpy_s(reinterpret_cast<void *>(pIpcHandle->data),
                  sizeof(ze_ipc_mem_handle_t),
@@ -86,11 +90,11 @@ ze_result_t DriverHandleImp::getMemAddressRange(const void *ptr, void **pBase, s
         alloc = allocData->gpuAllocation;
         if (pBase) {
             uint64_t *allocBase = reinterpret_cast<uint64_t *>(pBase);
-            *allocBase = alloc->getGpuAddress();
+            *allocBase = allocData->getGpuAddress();
         }
 
         if (pSize) {
-            *pSize = alloc->getUnderlyingBufferSize();
+            *pSize = allocData->pool ? allocData->size : alloc->getUnderlyingBufferSize();
         }
 
         return ZE_RESULT_SUCCESS;
@@ -106,6 +110,7 @@ ze_result_t DriverHandleImp::allocHostMem(ze_host_mem_alloc_flag_t flags, size_t
         return ZE_RESULT_ERROR_UNSUPPORTED_SIZE;
     }
     NEO::SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY);
+    unifiedMemoryProperties.alignment = alignment;
 
     auto usmPtr = svmAllocsManager->createUnifiedMemoryAllocation(0u, size, unifiedMemoryProperties);
 
@@ -127,6 +132,7 @@ ze_result_t DriverHandleImp::allocDeviceMem(ze_device_handle_t hDevice, ze_devic
     NEO::SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY);
     unifiedMemoryProperties.allocationFlags.flags.shareable = 1u;
     unifiedMemoryProperties.device = Device::fromHandle(hDevice)->getNEODevice();
+    unifiedMemoryProperties.alignment = alignment;
     void *usmPtr =
         svmAllocsManager->createUnifiedMemoryAllocation(Device::fromHandle(hDevice)->getRootDeviceIndex(),
                                                         size, unifiedMemoryProperties);
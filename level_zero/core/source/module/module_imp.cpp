@@ -7,6 +7,7 @@
 
 #include "level_zero/core/source/module/module_imp.h"
 
+#include "shared/source/command_stream/scratch_space_controller.h"
 #include "shared/source/compiler_interface/intermediate_representations.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
@@ -15,6 +16,7 @@
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/program/program_initialization.h"
 #include "shared/source/source_level_debugger/source_level_debugger.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "opencl/source/program/kernel_info.h"
 
@@ -25,6 +27,7 @@
 #include "compiler_options.h"
 #include "program_debug_data.h"
 
+#include <algorithm>
 #include <memory>
 
 namespace L0 {
@@ -327,29 +330,60 @@ bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice)
         return false;
     }
 
-    kernelImmDatas.reserve(this->translationUnit->programInfo.kernelInfos.size());
+    auto kernelCount = this->translationUnit->programInfo.kernelInfos.size();
+    kernelImmDatas.reserve(kernelCount);
     for (auto &ki : this->translationUnit->programInfo.kernelInfos) {
         std::unique_ptr<KernelImmutableData> kernelImmData{new KernelImmutableData(this->device)};
-        kernelImmData->initialize(ki, *(getDevice()->getDriverHandle()->getMemoryManager()),
-                                  device->getNEODevice(),
-                                  device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
-                                  this->translationUnit->globalConstBuffer, this->translationUnit->globalVarBuffer);
+        kernelImmData->setDescriptor(&ki->kernelDescriptor);
         kernelImmDatas.push_back(std::move(kernelImmData));
     }
+    kernelImmDatasInitialized.reset(new std::once_flag[kernelCount]);
+
+    // Linking patches ISA of all kernels, so only modules without linker input can defer kernel initialization.
+    lazyKernelInitialization = NEO::DebugManager.flags.EnableLazyKernelInitialization.get() == 1 &&
+                               this->translationUnit->programInfo.linkerInput == nullptr;
+    if (false == lazyKernelInitialization) {
+        NEO::parallelFor(kernelCount, NEO::getKernelInitializationThreadCount(kernelCount), [this](size_t kernelIndex) {
+            this->initializeKernelImmutableData(kernelIndex);
+        });
+    }
     this->maxGroupSize = static_cast<uint32_t>(this->translationUnit->device->getNEODevice()->getDeviceInfo().maxWorkGroupSize);
 
+    if (NEO::ScratchSpaceController::isGeometricGrowthEnabled()) {
+        uint32_t maxPerThreadScratchSize = 0u;
+        for (auto &kernelInfo : this->translationUnit->programInfo.kernelInfos) {
+            maxPerThreadScratchSize = std::max(maxPerThreadScratchSize, kernelInfo->kernelDescriptor.kernelAttributes.perThreadScratchSize[0]);
+        }
+        if (maxPerThreadScratchSize > 0u) {
+            neoDevice->reserveScratchSpace(maxPerThreadScratchSize);
+        }
+    }
+
     return this->linkBinary();
 }
 
 const KernelImmutableData *ModuleImp::getKernelImmutableData(const char *functionName) const {
     for (auto &kernelImmData : kernelImmDatas) {
         if (kernelImmData->getDescriptor().kernelMetadata.kernelName.compare(functionName) == 0) {
+            if (lazyKernelInitialization) {
+                initializeKernelImmutableData(&kernelImmData - &kernelImmDatas[0]);
+            }
             return kernelImmData.get();
         }
     }
     return nullptr;
 }
 
+void ModuleImp::initializeKernelImmutableData(size_t kernelIndex) const {
+    std::call_once(kernelImmDatasInitialized[kernelIndex], [&]() {
+        kernelImmDatas[kernelIndex]->initialize(this->translationUnit->programInfo.kernelInfos[kernelIndex],
+                                                *(getDevice()->getDriverHandle()->getMemoryManager()),
+                                                device->getNEODevice(),
+                                                device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
+                                                this->translationUnit->globalConstBuffer, this->translationUnit->globalVarBuffer);
+    });
+}
+
 void ModuleImp::createBuildOptions(const char *pBuildFlags, std::string &apiOptions, std::string &internalBuildOptions) {
     if (pBuildFlags != nullptr) {
         std::string buildFlags(pBuildFlags);
@@ -18,6 +18,7 @@
 #include "igfxfmid.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace L0 {
@@ -100,6 +101,8 @@ struct ModuleImp : public Module {
     bool isDebugEnabled() const override;
 
   protected:
+    void initializeKernelImmutableData(size_t kernelIndex) const;
+
     Device *device = nullptr;
     PRODUCT_FAMILY productFamily{};
     std::unique_ptr<ModuleTranslationUnit> translationUnit;
@@ -107,6 +110,8 @@ struct ModuleImp : public Module {
     NEO::GraphicsAllocation *exportedFunctionsSurface = nullptr;
     uint32_t maxGroupSize = 0U;
     std::vector<std::unique_ptr<KernelImmutableData>> kernelImmDatas;
+    std::unique_ptr<std::once_flag[]> kernelImmDatasInitialized;
+    bool lazyKernelInitialization = false;
     NEO::Linker::RelocatedSymbolsMap symbols;
     bool debugEnabled = false;
 };
@@ -32,7 +32,8 @@ void PrintfHandler::printOutput(const KernelImmutableData *kernelData,
     NEO::PrintFormatter printfFormatter{static_cast<uint8_t *>(printfBuffer->getUnderlyingBuffer()),
                                         static_cast<uint32_t>(printfBuffer->getUnderlyingBufferSize()),
                                         using32BitGpuPointers,
-                                        kernelData->getDescriptor().kernelMetadata.printfStringsMap};
+                                        kernelData->getDescriptor().kernelMetadata.printfStringsMap,
+                                        &kernelData->getDescriptor().kernelMetadata.printfFormatPrograms};
     printfFormatter.printKernelOutput();
 
     *reinterpret_cast<uint32_t *>(printfBuffer->getUnderlyingBuffer()) =
@@ -42,6 +42,7 @@ struct WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>
     using BaseClass::commandListPreemptionMode;
     using BaseClass::getAlignedAllocation;
     using BaseClass::hostPtrMap;
+    using BaseClass::mutableKernelLaunches;
 
     WhiteBox() : ::L0::CommandListCoreFamily<gfxCoreFamily>(BaseClass::defaultNumIddsPerBlock) {}
 };
@@ -151,6 +152,9 @@ struct Mock<CommandList> : public CommandList {
     MOCK_METHOD2(reserveSpace, ze_result_t(size_t size, void **ptr));
     MOCK_METHOD0(reset, ze_result_t());
     MOCK_METHOD0(resetParameters, ze_result_t());
+    MOCK_METHOD3(updateKernelLaunch,
+                 ze_result_t(uint32_t launchIndex, ze_kernel_handle_t hKernel,
+                             const ze_group_count_t *pThreadGroupDimensions));
 
     MOCK_METHOD0(appendMetricMemoryBarrier, ze_result_t());
     MOCK_METHOD2(appendMetricTracerMarker,
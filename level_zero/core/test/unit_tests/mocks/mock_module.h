@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/test/unit_test/mocks/mock_compiler_interface.h"
 
+#include "opencl/source/program/kernel_info.h"
 #include "opencl/test/unit_test/mocks/mock_cif.h"
 
 #include "level_zero/core/source/module/module_imp.h"
@@ -22,6 +23,7 @@ struct WhiteBox<::L0::Module> : public ::L0::ModuleImp {
     using BaseClass = ::L0::ModuleImp;
     using BaseClass::BaseClass;
     using BaseClass::device;
+    using BaseClass::lazyKernelInitialization;
     using BaseClass::translationUnit;
 };
 
@@ -52,6 +54,30 @@ struct MockModuleTranslationUnit : public L0::ModuleTranslationUnit {
     }
 };
 
+// Replaces decoded device binary with kernels that only carry ISA and cross thread data, named kernel0, kernel1, ...
+struct MockModuleTranslationUnitWithSyntheticKernels : public L0::ModuleTranslationUnit {
+    MockModuleTranslationUnitWithSyntheticKernels(L0::Device *device, uint32_t kernelCount, uint32_t isaSize)
+        : L0::ModuleTranslationUnit(device), kernelCount(kernelCount), isa(isaSize, 0u) {
+    }
+
+    bool processUnpackedBinary() override {
+        for (uint32_t kernel = 0; kernel < kernelCount; kernel++) {
+            auto kernelInfo = new NEO::KernelInfo();
+            kernelInfo->name = "kernel" + std::to_string(kernel);
+            kernelInfo->kernelDescriptor.kernelMetadata.kernelName = kernelInfo->name;
+            kernelInfo->kernelDescriptor.kernelAttributes.simdSize = 8u;
+            kernelInfo->kernelDescriptor.kernelAttributes.crossThreadDataSize = 64u;
+            kernelInfo->heapInfo.pKernelHeap = isa.data();
+            kernelInfo->heapInfo.KernelHeapSize = static_cast<uint32_t>(isa.size());
+            programInfo.kernelInfos.push_back(kernelInfo);
+        }
+        return true;
+    }
+
+    uint32_t kernelCount = 0u;
+    std::vector<uint8_t> isa;
+};
+
 struct MockCompilerInterface : public NEO::CompilerInterface {
     MockCompilerInterface(uint32_t moduleNumSpecConstants) : moduleNumSpecConstants(moduleNumSpecConstants) {
     }
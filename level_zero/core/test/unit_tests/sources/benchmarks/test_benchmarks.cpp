@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/test/unit_test/helpers/benchmark_runner.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+#include "shared/test/unit_test/helpers/memory_management.h"
+
+#include "test.h"
+
+#include "level_zero/api/experimental/ze_exp_cmdlist.h"
+#include "level_zero/core/source/cmdlist/cmdlist.h"
+#include "level_zero/core/source/cmdqueue/cmdqueue.h"
+#include "level_zero/core/source/event/event.h"
+#include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_module.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace L0 {
+namespace ult {
+
+namespace {
+::testing::Environment *const benchmarkEnvironment = ::testing::AddGlobalTestEnvironment(new NEO::BenchmarkEnvironment);
+} // namespace
+
+// Host side cost of Level Zero API calls on the ULT device, command stream receivers submit nothing.
+// Benchmarks are disabled in regular runs, run_<product>_benchmarks targets enable them and collect json results.
+struct ZeApiBenchmarkFixture : public DeviceFixture {
+    void SetUp() override {
+        DeviceFixture::SetUp();
+        // Benchmark results outlive the test.
+        MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+
+        auto threadCounts = NEO::BenchmarkRunner::getThreadCounts();
+        auto maxThreadCount = *std::max_element(threadCounts.begin(), threadCounts.end());
+
+        ze_event_pool_desc_t eventPoolDesc = {ZE_EVENT_POOL_DESC_VERSION_CURRENT, ZE_EVENT_POOL_FLAG_HOST_VISIBLE, 1};
+        for (uint32_t thread = 0; thread < maxThreadCount; thread++) {
+            commandLists.emplace_back(CommandList::create(productFamily, device, false));
+            kernels.push_back(std::make_unique<Mock<::L0::Kernel>>());
+            eventPools.emplace_back(EventPool::create(driverHandle.get(), 0, nullptr, &eventPoolDesc));
+        }
+
+        executedCommandList.reset(CommandList::create(productFamily, device, false));
+        ze_group_count_t groupCount = {1, 1, 1};
+        ASSERT_EQ(ZE_RESULT_SUCCESS, executedCommandList->appendLaunchKernel(kernels[0]->toHandle(), &groupCount, nullptr, 0, nullptr));
+        ASSERT_EQ(ZE_RESULT_SUCCESS, executedCommandList->close());
+
+        ze_command_queue_desc_t queueDesc = {ZE_COMMAND_QUEUE_DESC_VERSION_CURRENT};
+        commandQueue = CommandQueue::create(productFamily, device, neoDevice->getDefaultEngine().commandStreamReceiver, &queueDesc, false);
+        ASSERT_NE(nullptr, commandQueue);
+    }
+
+    void TearDown() override {
+        if (commandQueue) {
+            commandQueue->destroy();
+        }
+        for (auto eventPool : eventPools) {
+            eventPool->destroy();
+        }
+        DeviceFixture::TearDown();
+    }
+
+    void runForAllThreadCounts(const std::string &name, const NEO::BenchmarkRunner::Operation &operation) {
+        for (auto threadCount : NEO::BenchmarkRunner::getThreadCounts()) {
+            NEO::BenchmarkRunner::run(name, threadCount, operation);
+        }
+        EXPECT_EQ(0u, failures.load());
+    }
+
+    std::vector<std::unique_ptr<CommandList>> commandLists;
+    std::vector<std::unique_ptr<Mock<::L0::Kernel>>> kernels;
+    std::vector<EventPool *> eventPools;
+    std::unique_ptr<CommandList> executedCommandList;
+    CommandQueue *commandQueue = nullptr;
+    std::atomic<uint32_t> failures{0u};
+};
+
+using ZeApiBenchmark = Test<ZeApiBenchmarkFixture>;
+
+TEST_F(ZeApiBenchmark, DISABLED_zeCommandListAppendLaunchKernel) {
+    const ze_group_count_t groupCount = {64, 1, 1};
+    runForAllThreadCounts("zeCommandListAppendLaunchKernel", [&](uint32_t thread, uint32_t iteration) {
+        auto result = zeCommandListAppendLaunchKernel(commandLists[thread]->toHandle(), kernels[thread]->toHandle(), &groupCount, nullptr, 0, nullptr);
+        failures += (result != ZE_RESULT_SUCCESS);
+    });
+}
+
+TEST_F(ZeApiBenchmark, DISABLED_zeCommandQueueExecuteCommandLists) {
+    // Queues sharing a command stream receiver must not execute concurrently, so only one thread submits.
+    auto commandListHandle = executedCommandList->toHandle();
+    NEO::BenchmarkRunner::run("zeCommandQueueExecuteCommandLists", 1u, [&](uint32_t thread, uint32_t iteration) {
+        auto result = zeCommandQueueExecuteCommandLists(commandQueue->toHandle(), 1, &commandListHandle, nullptr);
+        failures += (result != ZE_RESULT_SUCCESS);
+    });
+    EXPECT_EQ(0u, failures.load());
+}
+
+TEST_F(ZeApiBenchmark, DISABLED_recordVersusUpdateOfCommandListWith1000Kernels) {
+    constexpr uint32_t launchCount = 1000u;
+    constexpr uint32_t iterations = 100u;
+    const ze_group_count_t groupCount = {64, 1, 1};
+    auto commandList = commandLists[0]->toHandle();
+    auto kernel = kernels[0]->toHandle();
+
+    NEO::BenchmarkRunner::run("zeCommandListReset+1000xzeCommandListAppendLaunchKernel+zeCommandListClose", 1u, [&](uint32_t thread, uint32_t iteration) {
+        failures += (zeCommandListReset(commandList) != ZE_RESULT_SUCCESS);
+        for (uint32_t launch = 0; launch < launchCount; launch++) {
+            failures += (zeCommandListAppendLaunchKernel(commandList, kernel, &groupCount, nullptr, 0, nullptr) != ZE_RESULT_SUCCESS);
+        }
+        failures += (zeCommandListClose(commandList) != ZE_RESULT_SUCCESS);
+    },
+                              iterations);
+
+    NEO::BenchmarkRunner::run("1000xzeCommandListUpdateKernelLaunchExp", 1u, [&](uint32_t thread, uint32_t iteration) {
+        for (uint32_t launch = 0; launch < launchCount; launch++) {
+            failures += (zeCommandListUpdateKernelLaunchExp(commandList, launch, kernel, &groupCount) != ZE_RESULT_SUCCESS);
+        }
+    },
+                              iterations);
+    EXPECT_EQ(0u, failures.load());
+}
+
+TEST_F(ZeApiBenchmark, DISABLED_recordCommandListWith1000IdenticalKernelsWithAndWithoutDispatchStateReuse) {
+    constexpr uint32_t launchCount = 1000u;
+    constexpr uint32_t iterations = 100u;
+    const ze_group_count_t groupCount = {64, 1, 1};
+    auto commandList = commandLists[0].get();
+    auto kernel = kernels[0]->toHandle();
+    DebugManagerStateRestore restorer;
+
+    for (auto reuse : {0, 1}) {
+        NEO::DebugManager.flags.EnableDispatchStateReuse.set(reuse);
+        auto name = std::string("zeCommandListReset+1000xzeCommandListAppendLaunchKernel+zeCommandListClose") + (reuse ? "WithDispatchStateReuse" : "");
+        auto &counters = commandList->commandContainer.getDispatchStateCache().getCounters();
+        auto countersBefore = counters;
+        uint32_t recordings = 0u;
+        NEO::BenchmarkRunner::run(name, 1u, [&](uint32_t thread, uint32_t iteration) {
+            failures += (zeCommandListReset(commandList->toHandle()) != ZE_RESULT_SUCCESS);
+            for (uint32_t launch = 0; launch < launchCount; launch++) {
+                failures += (zeCommandListAppendLaunchKernel(commandList->toHandle(), kernel, &groupCount, nullptr, 0, nullptr) != ZE_RESULT_SUCCESS);
+            }
+            failures += (zeCommandListClose(commandList->toHandle()) != ZE_RESULT_SUCCESS);
+            recordings++;
+        },
+                                  iterations);
+
+        auto &results = NEO::BenchmarkResults::getInstance();
+        auto perRecording = [&](uint64_t after, uint64_t before) { return static_cast<double>(after - before) / recordings; };
+        results.addMetric("reused_surface_states_per_list", perRecording(counters.reusedSurfaceStates, countersBefore.reusedSurfaceStates));
+        results.addMetric("reused_indirect_data_per_list", perRecording(counters.reusedIndirectData, countersBefore.reusedIndirectData));
+        results.addMetric("reused_interface_descriptors_per_list", perRecording(counters.reusedInterfaceDescriptors, countersBefore.reusedInterfaceDescriptors));
+        results.addMetric("saved_ssh_bytes_per_list", perRecording(counters.savedSurfaceStateHeapSize, countersBefore.savedSurfaceStateHeapSize));
+        results.addMetric("saved_ioh_bytes_per_list", perRecording(counters.savedIndirectObjectHeapSize, countersBefore.savedIndirectObjectHeapSize));
+        results.addMetric("saved_dsh_bytes_per_list", perRecording(counters.savedDynamicStateHeapSize, countersBefore.savedDynamicStateHeapSize));
+    }
+    EXPECT_EQ(0u, failures.load());
+}
+
+TEST_F(ZeApiBenchmark, DISABLED_loadModuleWith500KernelsSeriallyInParallelAndLazily) {
+    constexpr uint32_t kernelCount = 500u;
+    constexpr uint32_t iterations = 10u;
+    DebugManagerStateRestore restorer;
+    neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[0]->compilerInterface.reset(new MockCompilerInterface(0u));
+
+    const char spirV[4] = {0x03, 0x02, 0x23, 0x07};
+    ze_module_desc_t moduleDesc = {ZE_MODULE_DESC_VERSION_CURRENT};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = reinterpret_cast<const uint8_t *>(spirV);
+    moduleDesc.inputSize = sizeof(spirV);
+
+    struct {
+        const char *name;
+        int32_t threadCount;
+        int32_t lazy;
+    } modes[] = {{"serial", -1, -1}, {"4 threads", 4, -1}, {"all hardware threads", 0, -1}, {"lazy, first kernel only", -1, 1}};
+
+    for (auto &mode : modes) {
+        NEO::DebugManager.flags.KernelInitializationThreadCount.set(mode.threadCount);
+        NEO::DebugManager.flags.EnableLazyKernelInitialization.set(mode.lazy);
+        NEO::BenchmarkRunner::run(std::string("ModuleImp::initialize(500 kernels, ") + mode.name + ")", 1u, [&](uint32_t thread, uint32_t iteration) {
+            auto module = std::make_unique<Module>(device, nullptr);
+            module->translationUnit.reset(new MockModuleTranslationUnitWithSyntheticKernels(device, kernelCount, MemoryConstants::pageSize));
+            failures += !module->initialize(&moduleDesc, neoDevice);
+            failures += (module->getKernelImmutableData("kernel0") == nullptr);
+        },
+                                  iterations, NEO::BenchmarkRunner::defaultRepetitions, 1u);
+    }
+    EXPECT_EQ(0u, failures.load());
+}
+
+TEST_F(ZeApiBenchmark, DISABLED_zeEventCreateAndDestroy) {
+    const ze_event_desc_t eventDesc = {ZE_EVENT_DESC_VERSION_CURRENT, 0, ZE_EVENT_SCOPE_FLAG_NONE, ZE_EVENT_SCOPE_FLAG_NONE};
+    runForAllThreadCounts("zeEventCreate+zeEventDestroy", [&](uint32_t thread, uint32_t iteration) {
+        ze_event_handle_t event = nullptr;
+        failures += (zeEventCreate(eventPools[thread]->toHandle(), &eventDesc, &event) != ZE_RESULT_SUCCESS);
+        failures += (zeEventDestroy(event) != ZE_RESULT_SUCCESS);
+    });
+}
+
+TEST_F(ZeApiBenchmark, DISABLED_zeEventPoolCreateAndDestroyWithAndWithoutSlabAllocator) {
+    const ze_event_pool_desc_t eventPoolDesc = {ZE_EVENT_POOL_DESC_VERSION_CURRENT, ZE_EVENT_POOL_FLAG_HOST_VISIBLE, 16};
+    const ze_event_desc_t eventDesc = {ZE_EVENT_DESC_VERSION_CURRENT, 0, ZE_EVENT_SCOPE_FLAG_NONE, ZE_EVENT_SCOPE_FLAG_NONE};
+    DebugManagerStateRestore restorer;
+
+    for (auto slabAllocator : {0, 1}) {
+        NEO::DebugManager.flags.EnableEventPoolSlabAllocator.set(slabAllocator);
+        std::string variant = slabAllocator ? "(slab allocator)" : "";
+        runForAllThreadCounts("zeEventPoolCreate+zeEventCreate+zeEventDestroy+zeEventPoolDestroy" + variant, [&](uint32_t thread, uint32_t iteration) {
+            ze_device_handle_t deviceHandle = device->toHandle();
+            ze_event_pool_handle_t eventPool = nullptr;
+            ze_event_handle_t event = nullptr;
+            failures += (zeEventPoolCreate(driverHandle->toHandle(), &eventPoolDesc, 1, &deviceHandle, &eventPool) != ZE_RESULT_SUCCESS);
+            failures += (zeEventCreate(eventPool, &eventDesc, &event) != ZE_RESULT_SUCCESS);
+            failures += (zeEventDestroy(event) != ZE_RESULT_SUCCESS);
+            failures += (zeEventPoolDestroy(eventPool) != ZE_RESULT_SUCCESS);
+        });
+    }
+}
+
+TEST_F(ZeApiBenchmark, DISABLED_zeDriverAllocHostMemAndFree) {
+    ze_host_mem_alloc_desc_t hostDesc;
+    hostDesc.flags = ZE_HOST_MEM_ALLOC_FLAG_DEFAULT;
+    hostDesc.version = ZE_HOST_MEM_ALLOC_DESC_VERSION_CURRENT;
+    runForAllThreadCounts("zeDriverAllocHostMem+zeDriverFreeMem", [&](uint32_t thread, uint32_t iteration) {
+        void *ptr = nullptr;
+        failures += (zeDriverAllocHostMem(driverHandle->toHandle(), &hostDesc, MemoryConstants::pageSize, 0, &ptr) != ZE_RESULT_SUCCESS);
+        failures += (zeDriverFreeMem(driverHandle->toHandle(), ptr) != ZE_RESULT_SUCCESS);
+    });
+}
+
+TEST_F(ZeApiBenchmark, DISABLED_zeDriverAllocDeviceMemAndFree) {
+    ze_device_mem_alloc_desc_t deviceDesc;
+    deviceDesc.flags = ZE_DEVICE_MEM_ALLOC_FLAG_DEFAULT;
+    deviceDesc.ordinal = 0;
+    deviceDesc.version = ZE_DEVICE_MEM_ALLOC_DESC_VERSION_CURRENT;
+    runForAllThreadCounts("zeDriverAllocDeviceMem+zeDriverFreeMem", [&](uint32_t thread, uint32_t iteration) {
+        void *ptr = nullptr;
+        failures += (zeDriverAllocDeviceMem(driverHandle->toHandle(), &deviceDesc, MemoryConstants::pageSize, 0, device->toHandle(), &ptr) != ZE_RESULT_SUCCESS);
+        failures += (zeDriverFreeMem(driverHandle->toHandle(), ptr) != ZE_RESULT_SUCCESS);
+    });
+}
+
+} // namespace ult
+} // namespace L0
@@ -7,6 +7,8 @@
 
 #include "test.h"
 
+#include "level_zero/api/experimental/ze_exp_cmdlist.h"
+
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
@@ -22,6 +24,17 @@ TEST(zeCommandListClose, whenCalledThenRedirectedToObject) {
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST(zeCommandListUpdateKernelLaunchExp, whenCalledThenRedirectedToObject) {
+    Mock<CommandList> commandList;
+    Mock<::L0::Kernel> kernel;
+    ze_group_count_t groupCount{1, 1, 1};
+
+    EXPECT_CALL(commandList, updateKernelLaunch(2u, kernel.toHandle(), &groupCount)).Times(1);
+
+    auto res = zeCommandListUpdateKernelLaunchExp(commandList.toHandle(), 2u, kernel.toHandle(), &groupCount);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, res);
+}
+
 TEST(zeCommandListAppendMemoryPrefetch, whenCalledThenRedirectedToObject) {
     Mock<CommandList> commandList;
 
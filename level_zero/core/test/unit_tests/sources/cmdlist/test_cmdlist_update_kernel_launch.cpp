@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_container/command_encoder.h"
+#include "shared/test/unit_test/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "test.h"
+
+#include "level_zero/api/experimental/ze_exp_cmdlist.h"
+#include "level_zero/core/test/unit_tests/fixtures/module_fixture.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
+
+namespace L0 {
+namespace ult {
+
+using CommandListUpdateKernelLaunch = Test<ModuleFixture>;
+
+HWTEST_F(CommandListUpdateKernelLaunch, givenClosedCommandListWhenKernelLaunchIsUpdatedThenWalkerAndIndirectDataArePatchedInPlace) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    createKernel();
+
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, false);
+    ze_group_count_t groupCount{1, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->close());
+    ASSERT_EQ(1u, commandList->mutableKernelLaunches.size());
+
+    auto commandStream = commandList->commandContainer.getCommandStream();
+    auto usedSpaceBefore = commandStream->getUsed();
+
+    ze_group_count_t newGroupCount{4, 2, 3};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListUpdateKernelLaunchExp(commandList->toHandle(), 0u, kernel->toHandle(), &newGroupCount));
+    EXPECT_EQ(usedSpaceBefore, commandStream->getUsed());
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(cmdList, commandStream->getCpuBase(), commandStream->getUsed()));
+    auto itor = find<WALKER_TYPE *>(cmdList.begin(), cmdList.end());
+    ASSERT_NE(cmdList.end(), itor);
+    auto walker = genCmdCast<WALKER_TYPE *>(*itor);
+    EXPECT_EQ(4u, walker->getThreadGroupIdXDimension());
+    EXPECT_EQ(2u, walker->getThreadGroupIdYDimension());
+    EXPECT_EQ(3u, walker->getThreadGroupIdZDimension());
+
+    auto &patchInfo = commandList->mutableKernelLaunches[0].patchInfo;
+    EXPECT_EQ(0, memcmp(patchInfo.indirectData, kernel->getCrossThreadData(), kernel->getCrossThreadDataSize()));
+}
+
+HWTEST_F(CommandListUpdateKernelLaunch, givenInvalidLaunchIndexOrDifferentKernelWhenKernelLaunchIsUpdatedThenInvalidArgumentIsReturned) {
+    createKernel();
+    Mock<::L0::Kernel> otherKernel;
+
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, false);
+    ze_group_count_t groupCount{1, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr));
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateKernelLaunch(1u, kernel->toHandle(), &groupCount));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateKernelLaunch(0u, otherKernel.toHandle(), &groupCount));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateKernelLaunch(0u, kernel->toHandle(), nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateKernelLaunch(0u, kernel->toHandle(), &groupCount));
+}
+
+HWTEST_F(CommandListUpdateKernelLaunch, givenKernelLaunchWhichDoesNotFitIntoRecordedSpaceWhenKernelLaunchIsUpdatedThenUnsupportedSizeIsReturned) {
+    createKernel();
+
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, false);
+    ze_group_count_t groupCount{1, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr));
+
+    auto perThreadDataSizeForWholeThreadGroup = kernel->perThreadDataSizeForWholeThreadGroup;
+    kernel->perThreadDataSizeForWholeThreadGroup += 32u;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_SIZE, commandList->updateKernelLaunch(0u, kernel->toHandle(), &groupCount));
+    kernel->perThreadDataSizeForWholeThreadGroup = perThreadDataSizeForWholeThreadGroup;
+}
+
+HWTEST_F(CommandListUpdateKernelLaunch, givenKernelLaunchWhichDoesNotFitIntoRecordedSpaceWhenKernelLaunchIsUpdatedThenKernelCrossThreadDataIsNotChanged) {
+    createKernel();
+
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, false);
+    ze_group_count_t groupCount{1, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr));
+    std::vector<uint8_t> crossThreadData(kernel->getCrossThreadData(), kernel->getCrossThreadData() + kernel->getCrossThreadDataSize());
+
+    auto perThreadDataSizeForWholeThreadGroup = kernel->perThreadDataSizeForWholeThreadGroup;
+    kernel->perThreadDataSizeForWholeThreadGroup += 32u;
+    ze_group_count_t newGroupCount{4, 2, 3};
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_SIZE, commandList->updateKernelLaunch(0u, kernel->toHandle(), &newGroupCount));
+    kernel->perThreadDataSizeForWholeThreadGroup = perThreadDataSizeForWholeThreadGroup;
+
+    EXPECT_EQ(0, memcmp(crossThreadData.data(), kernel->getCrossThreadData(), crossThreadData.size()));
+    auto &patchInfo = commandList->mutableKernelLaunches[0].patchInfo;
+    EXPECT_EQ(0, memcmp(patchInfo.indirectData, crossThreadData.data(), crossThreadData.size()));
+}
+
+HWTEST_F(CommandListUpdateKernelLaunch, givenCommandListResetWhenKernelLaunchIsUpdatedThenRecordedLaunchesAreGone) {
+    createKernel();
+
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, false);
+    ze_group_count_t groupCount{1, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->reset());
+
+    EXPECT_TRUE(commandList->mutableKernelLaunches.empty());
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateKernelLaunch(0u, kernel->toHandle(), &groupCount));
+}
+
+HWTEST_F(CommandListUpdateKernelLaunch, givenIndirectLaunchWhenAppendedThenItIsNotRecordedAsUpdatableLaunch) {
+    createKernel();
+
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, false);
+    ze_group_count_t groupCount{1, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernelIndirect(kernel->toHandle(), &groupCount, nullptr, 0, nullptr));
+
+    EXPECT_TRUE(commandList->mutableKernelLaunches.empty());
+}
+
+HWTEST_F(CommandListUpdateKernelLaunch, givenDispatchStateReuseWhenIdenticalLaunchesShareHeapBlocksThenNeitherOfThemCanBeUpdated) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableDispatchStateReuse.set(1);
+    createKernel();
+
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, false);
+    ze_group_count_t groupCount{1, 1, 1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr));
+    ASSERT_EQ(2u, commandList->mutableKernelLaunches.size());
+    ASSERT_TRUE(commandList->mutableKernelLaunches[1].patchInfo.stateShared);
+    EXPECT_EQ(commandList->mutableKernelLaunches[0].patchInfo.indirectData, commandList->mutableKernelLaunches[1].patchInfo.indirectData);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_SIZE, commandList->updateKernelLaunch(0u, kernel->toHandle(), &groupCount));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_SIZE, commandList->updateKernelLaunch(1u, kernel->toHandle(), &groupCount));
+}
+
+TEST_F(CommandListUpdateKernelLaunch, whenGettingExtensionFunctionAddressThenUpdateKernelLaunchIsReturned) {
+    void *function = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, driverHandle->getExtensionFunctionAddress("zeCommandListUpdateKernelLaunchExp", &function));
+    EXPECT_EQ(reinterpret_cast<void *>(zeCommandListUpdateKernelLaunchExp), function);
+}
+
+} // namespace ult
+} // namespace L0
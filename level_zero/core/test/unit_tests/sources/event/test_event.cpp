@@ -5,9 +5,13 @@
  *
  */
 
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
 #include "test.h"
 
+#include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
+#include "level_zero/core/source/event/event_pool_allocator.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_event.h"
 
@@ -177,5 +181,185 @@ TEST_F(TimestampEventCreate, givenTimestampEventThenAllocationsIsOfPacketTagBuff
     EXPECT_EQ(NEO::GraphicsAllocation::AllocationType::TIMESTAMP_PACKET_TAG_BUFFER, allocation->getAllocationType());
 }
 
+using EventPoolAllocatorTest = Test<DeviceFixture>;
+
+TEST_F(EventPoolAllocatorTest, givenSmallChunksWhenAllocatingThenChunksAreCarvedFromSingleSlab) {
+    EventPoolAllocator allocator(neoDevice->getMemoryManager(), neoDevice->getRootDeviceIndex());
+
+    EventPoolAllocator::Chunk chunk0, chunk1;
+    ASSERT_TRUE(allocator.allocate(MemoryConstants::cacheLineSize, false, chunk0));
+    ASSERT_TRUE(allocator.allocate(MemoryConstants::cacheLineSize * 2, false, chunk1));
+
+    EXPECT_EQ(chunk0.allocation, chunk1.allocation);
+    EXPECT_EQ(0u, chunk0.offset);
+    EXPECT_EQ(MemoryConstants::cacheLineSize, chunk1.offset);
+    EXPECT_EQ(1u, allocator.getSlabsCount(false));
+    EXPECT_EQ(0u, allocator.getSlabsCount(true));
+    EXPECT_EQ(NEO::GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY, chunk0.allocation->getAllocationType());
+
+    allocator.free(chunk0, false);
+    allocator.free(chunk1, false);
+}
+
+TEST_F(EventPoolAllocatorTest, givenTimestampChunkWhenAllocatingThenTimestampSlabIsUsed) {
+    EventPoolAllocator allocator(neoDevice->getMemoryManager(), neoDevice->getRootDeviceIndex());
+
+    EventPoolAllocator::Chunk chunk;
+    ASSERT_TRUE(allocator.allocate(MemoryConstants::cacheLineSize, true, chunk));
+    EXPECT_EQ(1u, allocator.getSlabsCount(true));
+    EXPECT_EQ(NEO::GraphicsAllocation::AllocationType::TIMESTAMP_PACKET_TAG_BUFFER, chunk.allocation->getAllocationType());
+
+    allocator.free(chunk, true);
+}
+
+TEST_F(EventPoolAllocatorTest, givenTooBigChunkWhenAllocatingThenFail) {
+    EventPoolAllocator allocator(neoDevice->getMemoryManager(), neoDevice->getRootDeviceIndex());
+
+    EventPoolAllocator::Chunk chunk;
+    EXPECT_FALSE(allocator.allocate(EventPoolAllocator::maxChunkSize + 1, false, chunk));
+    EXPECT_FALSE(allocator.allocate(0u, false, chunk));
+    EXPECT_EQ(0u, allocator.getSlabsCount(false));
+}
+
+TEST_F(EventPoolAllocatorTest, givenFreedChunksWhenAllocatingAgainThenFreeRangesAreCoalescedAndReused) {
+    EventPoolAllocator allocator(neoDevice->getMemoryManager(), neoDevice->getRootDeviceIndex());
+
+    EventPoolAllocator::Chunk chunks[3];
+    for (auto &chunk : chunks) {
+        ASSERT_TRUE(allocator.allocate(MemoryConstants::cacheLineSize, false, chunk));
+    }
+
+    allocator.free(chunks[0], false);
+    allocator.free(chunks[1], false);
+
+    EventPoolAllocator::Chunk biggerChunk;
+    ASSERT_TRUE(allocator.allocate(MemoryConstants::cacheLineSize * 2, false, biggerChunk));
+    EXPECT_EQ(0u, biggerChunk.offset);
+    EXPECT_EQ(1u, allocator.getSlabsCount(false));
+
+    allocator.free(biggerChunk, false);
+    allocator.free(chunks[2], false);
+}
+
+TEST_F(EventPoolAllocatorTest, givenFullSlabWhenAllocatingThenNewSlabIsCreatedAndReleasedWhenEmpty) {
+    EventPoolAllocator allocator(neoDevice->getMemoryManager(), neoDevice->getRootDeviceIndex());
+
+    std::vector<EventPoolAllocator::Chunk> chunks(EventPoolAllocator::slabSize / EventPoolAllocator::maxChunkSize + 1);
+    for (auto &chunk : chunks) {
+        ASSERT_TRUE(allocator.allocate(EventPoolAllocator::maxChunkSize, false, chunk));
+    }
+    EXPECT_EQ(2u, allocator.getSlabsCount(false));
+    EXPECT_NE(chunks[0].allocation, chunks.rbegin()->allocation);
+
+    allocator.free(*chunks.rbegin(), false);
+    EXPECT_EQ(1u, allocator.getSlabsCount(false));
+
+    chunks.pop_back();
+    for (auto &chunk : chunks) {
+        allocator.free(chunk, false);
+    }
+    EXPECT_EQ(1u, allocator.getSlabsCount(false));
+}
+
+TEST_F(EventPoolAllocatorTest, givenEventCacheWhenStoringEventsThenCacheIsBounded) {
+    EventPoolAllocator allocator(neoDevice->getMemoryManager(), neoDevice->getRootDeviceIndex());
+    EXPECT_EQ(nullptr, allocator.obtainEvent());
+
+    auto event = new Mock<Event>();
+    EXPECT_TRUE(allocator.storeEvent(event));
+    EXPECT_EQ(1u, allocator.getCachedEventsCount());
+    EXPECT_EQ(event, allocator.obtainEvent());
+    EXPECT_EQ(0u, allocator.getCachedEventsCount());
+    delete event;
+}
+
+struct EventPoolSlabAllocatorTest : public Test<DeviceFixture> {
+    void SetUp() override {
+        DebugManager.flags.EnableEventPoolSlabAllocator.set(1);
+        Test<DeviceFixture>::SetUp();
+    }
+
+    DebugManagerStateRestore restorer;
+};
+
+TEST_F(EventPoolSlabAllocatorTest, givenSlabAllocatorEnabledWhenCreatingSmallEventPoolsThenPoolsShareAllocation) {
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_EVENT_POOL_DESC_VERSION_CURRENT,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+        1};
+    const ze_event_desc_t eventDesc = {
+        ZE_EVENT_DESC_VERSION_CURRENT,
+        0,
+        ZE_EVENT_SCOPE_FLAG_NONE,
+        ZE_EVENT_SCOPE_FLAG_NONE};
+
+    std::unique_ptr<L0::EventPool> eventPool0(EventPool::create(driverHandle.get(), 0, nullptr, &eventPoolDesc));
+    std::unique_ptr<L0::EventPool> eventPool1(EventPool::create(driverHandle.get(), 0, nullptr, &eventPoolDesc));
+    ASSERT_NE(nullptr, eventPool0);
+    ASSERT_NE(nullptr, eventPool1);
+    EXPECT_EQ(&eventPool0->getAllocation(), &eventPool1->getAllocation());
+
+    std::unique_ptr<L0::Event> event0(Event::create(eventPool0.get(), &eventDesc, device));
+    std::unique_ptr<L0::Event> event1(Event::create(eventPool1.get(), &eventDesc, device));
+    EXPECT_NE(event0->getGpuAddress(), event1->getGpuAddress());
+    EXPECT_NE(event0->hostAddress, event1->hostAddress);
+    EXPECT_EQ(event1->getGpuAddress() - event0->getGpuAddress(),
+              reinterpret_cast<uintptr_t>(event1->hostAddress) - reinterpret_cast<uintptr_t>(event0->hostAddress));
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event1->queryStatus());
+
+    event0->hostSignal();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event0->queryStatus());
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event1->queryStatus());
+
+    eventPool0->releaseEventToPool(event0.get());
+    eventPool1->releaseEventToPool(event1.get());
+}
+
+TEST_F(EventPoolSlabAllocatorTest, givenSlabAllocatorEnabledWhenCreatingIpcEventPoolThenDedicatedAllocationIsUsed) {
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_EVENT_POOL_DESC_VERSION_CURRENT,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+        1};
+    ze_event_pool_desc_t ipcEventPoolDesc = eventPoolDesc;
+    ipcEventPoolDesc.flags = static_cast<ze_event_pool_flag_t>(ZE_EVENT_POOL_FLAG_HOST_VISIBLE | ZE_EVENT_POOL_FLAG_IPC);
+
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), 0, nullptr, &eventPoolDesc));
+    std::unique_ptr<L0::EventPool> ipcEventPool(EventPool::create(driverHandle.get(), 0, nullptr, &ipcEventPoolDesc));
+    ASSERT_NE(nullptr, eventPool);
+    ASSERT_NE(nullptr, ipcEventPool);
+
+    EXPECT_NE(&eventPool->getAllocation(), &ipcEventPool->getAllocation());
+}
+
+TEST_F(EventPoolSlabAllocatorTest, givenSlabAllocatorEnabledWhenEventIsDestroyedThenEventObjectIsReused) {
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_EVENT_POOL_DESC_VERSION_CURRENT,
+        ZE_EVENT_POOL_FLAG_TIMESTAMP,
+        1};
+    const ze_event_desc_t eventDesc = {
+        ZE_EVENT_DESC_VERSION_CURRENT,
+        0,
+        ZE_EVENT_SCOPE_FLAG_NONE,
+        ZE_EVENT_SCOPE_FLAG_NONE};
+
+    auto eventPoolAllocator = static_cast<DeviceImp *>(device)->eventPoolAllocator.get();
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), 0, nullptr, &eventPoolDesc));
+    ASSERT_NE(nullptr, eventPool);
+    EXPECT_EQ(1u, eventPoolAllocator->getSlabsCount(true));
+
+    auto event = Event::create(eventPool.get(), &eventDesc, device);
+    ASSERT_NE(nullptr, event);
+    EXPECT_TRUE(event->isTimestampEvent);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->destroy());
+    EXPECT_EQ(1u, eventPoolAllocator->getCachedEventsCount());
+
+    auto recycledEvent = Event::create(eventPool.get(), &eventDesc, device);
+    EXPECT_EQ(event, recycledEvent);
+    EXPECT_EQ(0u, eventPoolAllocator->getCachedEventsCount());
+    EXPECT_TRUE(recycledEvent->isTimestampEvent);
+    EXPECT_NE(nullptr, recycledEvent->hostAddress);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, recycledEvent->destroy());
+}
+
 } // namespace ult
 } // namespace L0
@@ -5,6 +5,8 @@
  *
  */
 
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
 #include "test.h"
 
 #include "level_zero/core/source/module/module_imp.h"
@@ -114,5 +116,76 @@ HWTEST_F(ModuleSpecConstantsTests, givenSpecializationConstantsSetInDescriptorTh
     module->destroy();
 }
 
+struct ModuleKernelInitializationTests : public DeviceFixture,
+                                         public ::testing::Test {
+    void SetUp() override {
+        DeviceFixture::SetUp();
+
+        auto rootDeviceEnvironment = neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[0].get();
+        rootDeviceEnvironment->compilerInterface.reset(new MockCompilerInterface(0u));
+    }
+
+    void TearDown() override {
+        DeviceFixture::TearDown();
+    }
+
+    std::unique_ptr<Module> createModule() {
+        moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+        moduleDesc.pInputModule = reinterpret_cast<const uint8_t *>(spirV);
+        moduleDesc.inputSize = sizeof(spirV);
+
+        auto module = std::make_unique<Module>(device, nullptr);
+        module->translationUnit.reset(new MockModuleTranslationUnitWithSyntheticKernels(device, kernelCount, MemoryConstants::pageSize));
+        EXPECT_TRUE(module->initialize(&moduleDesc, neoDevice));
+        return module;
+    }
+
+    DebugManagerStateRestore restorer;
+    ze_module_desc_t moduleDesc = {ZE_MODULE_DESC_VERSION_CURRENT};
+    const char spirV[4] = {0x03, 0x02, 0x23, 0x07};
+    const uint32_t kernelCount = 16u;
+};
+
+TEST_F(ModuleKernelInitializationTests, givenKernelInitializationThreadCountWhenModuleIsInitializedThenAllKernelsAreInitializedInProgramOrder) {
+    NEO::DebugManager.flags.KernelInitializationThreadCount.set(4);
+    auto module = createModule();
+
+    auto &kernelImmDatas = module->getKernelImmutableDataVector();
+    ASSERT_EQ(kernelCount, kernelImmDatas.size());
+    for (uint32_t kernel = 0; kernel < kernelCount; kernel++) {
+        EXPECT_EQ("kernel" + std::to_string(kernel), kernelImmDatas[kernel]->getDescriptor().kernelMetadata.kernelName);
+        ASSERT_NE(nullptr, kernelImmDatas[kernel]->getIsaGraphicsAllocation());
+        EXPECT_EQ(0, memcmp(kernelImmDatas[kernel]->getIsaGraphicsAllocation()->getUnderlyingBuffer(),
+                            module->translationUnit->programInfo.kernelInfos[kernel]->heapInfo.pKernelHeap, MemoryConstants::pageSize));
+        EXPECT_NE(nullptr, kernelImmDatas[kernel]->getCrossThreadDataTemplate());
+    }
+}
+
+TEST_F(ModuleKernelInitializationTests, givenLazyKernelInitializationWhenKernelImmutableDataIsQueriedThenOnlyThatKernelIsInitialized) {
+    NEO::DebugManager.flags.EnableLazyKernelInitialization.set(1);
+    auto module = createModule();
+    EXPECT_TRUE(module->lazyKernelInitialization);
+
+    auto &kernelImmDatas = module->getKernelImmutableDataVector();
+    ASSERT_EQ(kernelCount, kernelImmDatas.size());
+    for (auto &kernelImmData : kernelImmDatas) {
+        EXPECT_EQ(nullptr, kernelImmData->getIsaGraphicsAllocation());
+    }
+
+    uint32_t count = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module->getKernelNames(&count, nullptr));
+    EXPECT_EQ(kernelCount, count);
+
+    auto kernelImmData = module->getKernelImmutableData("kernel3");
+    ASSERT_EQ(kernelImmDatas[3].get(), kernelImmData);
+    auto isaAllocation = kernelImmData->getIsaGraphicsAllocation();
+    EXPECT_NE(nullptr, isaAllocation);
+    EXPECT_EQ(nullptr, kernelImmDatas[2]->getIsaGraphicsAllocation());
+
+    EXPECT_EQ(kernelImmData, module->getKernelImmutableData("kernel3"));
+    EXPECT_EQ(isaAllocation, kernelImmData->getIsaGraphicsAllocation());
+    EXPECT_EQ(nullptr, module->getKernelImmutableData("kernel16"));
+}
+
 } // namespace ult
 } // namespace L0
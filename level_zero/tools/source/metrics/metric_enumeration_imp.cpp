@@ -513,8 +513,14 @@ bool MetricGroupImp::getCalculatedMetricValues(const size_t rawDataSize, const u
         return false;
     }
 
-    // Calculated metrics container.
-    std::vector<MetricsDiscovery::TTypedValue_1_0> calculatedMetrics(expectedMetricValueCount);
+    // Calculated metrics container. Calling thread's container is reused up to a size cap,
+    // so that repeated calculations do not allocate and a single huge batch does not keep its memory.
+    static thread_local std::vector<MetricsDiscovery::TTypedValue_1_0> threadCalculatedMetrics;
+    std::vector<MetricsDiscovery::TTypedValue_1_0> callCalculatedMetrics;
+    auto &calculatedMetrics = (expectedMetricValueCount <= maxReusedCalculatedMetricCount) ? threadCalculatedMetrics : callCalculatedMetrics;
+    if (calculatedMetrics.size() < expectedMetricValueCount) {
+        calculatedMetrics.resize(expectedMetricValueCount);
+    }
 
     // Set filtering type.
     pReferenceMetricSet->SetApiFiltering(MetricGroupImp::getApiMask(properties.samplingType));
@@ -523,7 +529,7 @@ bool MetricGroupImp::getCalculatedMetricValues(const size_t rawDataSize, const u
     const bool result = pReferenceMetricSet->CalculateMetrics(
                             reinterpret_cast<unsigned char *>(const_cast<uint8_t *>(pRawData)), static_cast<uint32_t>(rawDataSize),
                             calculatedMetrics.data(),
-                            static_cast<uint32_t>(calculatedMetrics.size()) * sizeof(MetricsDiscovery::TTypedValue_1_0),
+                            expectedMetricValueCount * static_cast<uint32_t>(sizeof(MetricsDiscovery::TTypedValue_1_0)),
                             &calculatedReportCount, nullptr, static_cast<uint32_t>(0)) == MetricsDiscovery::CC_OK;
 
     if (result) {
@@ -90,6 +90,9 @@ struct MetricGroupImp : MetricGroup {
 
     static uint32_t getApiMask(const zet_metric_group_sampling_type_t samplingType);
 
+    // Largest number of calculated values kept per thread between calculations.
+    static const uint32_t maxReusedCalculatedMetricCount = 64 * 1024;
+
     // Time based measurements.
     ze_result_t openIoStream(uint32_t &timerPeriodNs, uint32_t &oaBufferSize) override;
     ze_result_t waitForReports(const uint32_t timeoutMs) override;
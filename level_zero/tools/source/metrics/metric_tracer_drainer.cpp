@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/tools/source/metrics/metric_tracer_drainer.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include "level_zero/tools/source/metrics/metric.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace L0 {
+
+constexpr uint32_t MetricTracerDrainer::defaultRingSizeInOaBuffers;
+constexpr uint32_t MetricTracerDrainer::waitForReportsTimeoutMs;
+
+MetricTracerDrainer::MetricTracerDrainer(MetricGroup &metricGroup, uint32_t rawReportSize, uint32_t ringReportCount, uint32_t highWaterReportCount)
+    : metricGroup(metricGroup), rawReportSize(rawReportSize), ringReportCount(ringReportCount),
+      highWaterReportCount(highWaterReportCount), ring(static_cast<size_t>(ringReportCount) * rawReportSize) {
+}
+
+MetricTracerDrainer::~MetricTracerDrainer() {
+    stop();
+}
+
+std::unique_ptr<MetricTracerDrainer> MetricTracerDrainer::create(MetricGroup &metricGroup, uint32_t rawReportSize,
+                                                                 uint32_t oaBufferSize, uint32_t notifyEveryNReports) {
+    if (NEO::DebugManager.flags.EnableMetricTracerDrainer.get() != 1 || rawReportSize == 0) {
+        return nullptr;
+    }
+
+    uint32_t ringReportCount = defaultRingSizeInOaBuffers * (oaBufferSize / rawReportSize);
+    if (NEO::DebugManager.flags.MetricTracerDrainerRingSize.get() > 0) {
+        ringReportCount = static_cast<uint32_t>(NEO::DebugManager.flags.MetricTracerDrainerRingSize.get());
+    }
+    ringReportCount = std::max(ringReportCount, 1u);
+
+    uint32_t highWaterReportCount = notifyEveryNReports;
+    if (NEO::DebugManager.flags.MetricTracerDrainerHighWater.get() > 0) {
+        highWaterReportCount = static_cast<uint32_t>(NEO::DebugManager.flags.MetricTracerDrainerHighWater.get());
+    }
+    highWaterReportCount = std::min(std::max(highWaterReportCount, 1u), ringReportCount);
+
+    return std::make_unique<MetricTracerDrainer>(metricGroup, rawReportSize, ringReportCount, highWaterReportCount);
+}
+
+void MetricTracerDrainer::start() {
+    std::lock_guard<std::mutex> lock(ringMutex);
+    if (drainThread == nullptr) {
+        keepRunning = true;
+        drainThread = NEO::Thread::create(run, reinterpret_cast<void *>(this));
+    }
+}
+
+void MetricTracerDrainer::stop() {
+    std::unique_lock<std::mutex> lock(ringMutex);
+    keepRunning = false;
+    lock.unlock();
+    condition.notify_all();
+    if (drainThread) {
+        drainThread->join();
+        drainThread.reset();
+    }
+}
+
+uint32_t MetricTracerDrainer::drain() {
+    std::lock_guard<std::mutex> drainLock(drainMutex);
+    uint32_t drainedReportCount = 0u;
+
+    while (true) {
+        uint32_t freeReport = 0u;
+        uint32_t freeReportCount = 0u;
+        {
+            std::lock_guard<std::mutex> lock(ringMutex);
+            if (pendingReportCount == ringReportCount) {
+                ringFullCount++;
+                break;
+            }
+            // Only the contiguous part of the free space, the wrapped part is read in the next iteration.
+            freeReport = (firstPendingReport + pendingReportCount) % ringReportCount;
+            freeReportCount = std::min(ringReportCount - pendingReportCount, ringReportCount - freeReport);
+        }
+
+        // Reader only releases reports, so the free space cannot shrink while reading outside of the lock.
+        uint32_t reportCount = freeReportCount;
+        auto result = metricGroup.readIoStream(reportCount, ring[static_cast<size_t>(freeReport) * rawReportSize]);
+        if (result != ZE_RESULT_SUCCESS || reportCount == 0u) {
+            break;
+        }
+        reportCount = std::min(reportCount, freeReportCount);
+
+        {
+            std::lock_guard<std::mutex> lock(ringMutex);
+            pendingReportCount += reportCount;
+        }
+        drainedReportCount += reportCount;
+
+        if (reportCount < freeReportCount) {
+            break;
+        }
+    }
+    return drainedReportCount;
+}
+
+uint32_t MetricTracerDrainer::readReports(uint32_t maxReportCount, uint8_t *pRawData) {
+    std::unique_lock<std::mutex> lock(ringMutex);
+    const uint32_t reportCount = std::min(maxReportCount, pendingReportCount);
+    const uint32_t contiguousReportCount = std::min(reportCount, ringReportCount - firstPendingReport);
+
+    memcpy(pRawData, &ring[static_cast<size_t>(firstPendingReport) * rawReportSize],
+           static_cast<size_t>(contiguousReportCount) * rawReportSize);
+    memcpy(pRawData + static_cast<size_t>(contiguousReportCount) * rawReportSize, ring.data(),
+           static_cast<size_t>(reportCount - contiguousReportCount) * rawReportSize);
+
+    firstPendingReport = (firstPendingReport + reportCount) % ringReportCount;
+    pendingReportCount -= reportCount;
+    lock.unlock();
+
+    if (reportCount > 0u) {
+        condition.notify_all();
+    }
+    return reportCount;
+}
+
+uint32_t MetricTracerDrainer::getPendingReportCount() {
+    std::lock_guard<std::mutex> lock(ringMutex);
+    return pendingReportCount;
+}
+
+bool MetricTracerDrainer::isHighWaterReached() {
+    std::lock_guard<std::mutex> lock(ringMutex);
+    return pendingReportCount >= highWaterReportCount;
+}
+
+uint64_t MetricTracerDrainer::getRingFullCount() {
+    std::lock_guard<std::mutex> lock(ringMutex);
+    return ringFullCount;
+}
+
+void *MetricTracerDrainer::run(void *arg) {
+    auto self = reinterpret_cast<MetricTracerDrainer *>(arg);
+    const auto timeout = std::chrono::milliseconds(waitForReportsTimeoutMs);
+
+    while (true) {
+        const bool reportsReady = self->metricGroup.waitForReports(waitForReportsTimeoutMs) == ZE_RESULT_SUCCESS;
+        const bool reportsDrained = self->drain() > 0u;
+
+        std::unique_lock<std::mutex> lock(self->ringMutex);
+        if (!self->keepRunning) {
+            break;
+        }
+        if (self->pendingReportCount == self->ringReportCount) {
+            // Oa buffer keeps collecting reports until application reads some from the ring.
+            self->condition.wait(lock, [self] { return !self->keepRunning || self->pendingReportCount < self->ringReportCount; });
+        } else if (!reportsReady && !reportsDrained) {
+            self->condition.wait_for(lock, timeout, [self] { return !self->keepRunning; });
+        }
+    }
+    return nullptr;
+}
+
+} // namespace L0
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+} // namespace NEO
+
+namespace L0 {
+struct MetricGroup;
+
+// Moves oa reports from the io stream into a large ring buffer on a background thread,
+// so that reports are not lost when the application polls slowly. Reports are read
+// directly into the free space of the ring and copied out once, in readReports().
+class MetricTracerDrainer : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t defaultRingSizeInOaBuffers = 8u;
+    static constexpr uint32_t waitForReportsTimeoutMs = 10u;
+
+    MetricTracerDrainer(MetricGroup &metricGroup, uint32_t rawReportSize, uint32_t ringReportCount, uint32_t highWaterReportCount);
+    ~MetricTracerDrainer();
+
+    static std::unique_ptr<MetricTracerDrainer> create(MetricGroup &metricGroup, uint32_t rawReportSize,
+                                                       uint32_t oaBufferSize, uint32_t notifyEveryNReports);
+
+    void start();
+    void stop();
+
+    // Reads available reports from the io stream into the ring, returns number of reports read.
+    uint32_t drain();
+    // Copies up to maxReportCount oldest reports to pRawData and releases them from the ring.
+    uint32_t readReports(uint32_t maxReportCount, uint8_t *pRawData);
+
+    uint32_t getPendingReportCount();
+    bool isHighWaterReached();
+    uint32_t getRingReportCount() const { return ringReportCount; }
+    uint32_t getHighWaterReportCount() const { return highWaterReportCount; }
+    uint64_t getRingFullCount();
+
+  protected:
+    static void *run(void *arg);
+
+    MetricGroup &metricGroup;
+    const uint32_t rawReportSize;
+    const uint32_t ringReportCount;
+    const uint32_t highWaterReportCount;
+
+    std::vector<uint8_t> ring;
+    uint32_t firstPendingReport = 0u;
+    uint32_t pendingReportCount = 0u;
+    uint64_t ringFullCount = 0u;
+
+    bool keepRunning = false;
+    std::unique_ptr<NEO::Thread> drainThread;
+    std::mutex drainMutex;
+    std::mutex ringMutex;
+    std::condition_variable condition;
+};
+
+} // namespace L0
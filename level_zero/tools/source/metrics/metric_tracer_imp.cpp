@@ -12,6 +12,8 @@
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/tools/source/metrics/metric_query_imp.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 ze_result_t MetricTracerImp::readData(uint32_t maxReportCount, size_t *pRawDataSize,
@@ -34,6 +36,14 @@ ze_result_t MetricTracerImp::readData(uint32_t maxReportCount, size_t *pRawDataS
     // Retrieve the number of reports that fit into the buffer.
     uint32_t reportCount = static_cast<uint32_t>(*pRawDataSize / rawReportSize);
 
+    // Reports drained in background are returned together with the ones not drained yet.
+    if (drainer) {
+        drainer->drain();
+        reportCount = drainer->readReports(reportCount, pRawData);
+        *pRawDataSize = reportCount * rawReportSize;
+        return ZE_RESULT_SUCCESS;
+    }
+
     // Read tracer data.
     const ze_result_t result = metricGroup->readIoStream(reportCount, *pRawData);
     if (result == ZE_RESULT_SUCCESS) {
@@ -94,6 +104,11 @@ ze_result_t MetricTracerImp::startMeasurements(uint32_t &notifyEveryNReports,
     if (result == ZE_RESULT_SUCCESS) {
         oaBufferSize = requestedOaBufferSize;
         notifyEveryNReports = getNotifyEveryNReports(requestedOaBufferSize);
+
+        drainer = MetricTracerDrainer::create(*metricGroup, rawReportSize, oaBufferSize, notifyEveryNReports);
+        if (drainer) {
+            drainer->start();
+        }
     }
 
     // Associate notification event with metric tracer.
@@ -108,9 +123,16 @@ ze_result_t MetricTracerImp::startMeasurements(uint32_t &notifyEveryNReports,
 ze_result_t MetricTracerImp::stopMeasurements() {
     auto metricGroup = MetricGroup::fromHandle(hMetricGroup);
 
+    if (drainer) {
+        drainer->stop();
+    }
+
     const ze_result_t result = metricGroup->closeIoStream();
     if (result == ZE_RESULT_SUCCESS) {
         oaBufferSize = 0;
+        drainer.reset();
+    } else if (drainer) {
+        drainer->start();
     }
 
     return result;
@@ -130,6 +152,12 @@ uint32_t MetricTracerImp::getNotifyEveryNReports(const uint32_t oaBufferSize) co
 
 Event::State MetricTracerImp::getNotificationState() {
 
+    if (drainer) {
+        return drainer->isHighWaterReached()
+                   ? Event::State::STATE_SIGNALED
+                   : Event::State::STATE_INITIAL;
+    }
+
     auto metricGroup = MetricGroup::fromHandle(hMetricGroup);
     bool reportsReady = metricGroup->waitForReports(0) == ZE_RESULT_SUCCESS;
 
@@ -140,6 +168,9 @@ Event::State MetricTracerImp::getNotificationState() {
 
 uint32_t MetricTracerImp::getRequiredBufferSize(const uint32_t maxReportCount) const {
     DEBUG_BREAK_IF(rawReportSize == 0);
+    if (drainer) {
+        return std::min(maxReportCount, drainer->getRingReportCount()) * rawReportSize;
+    }
     uint32_t maxOaBufferReportCount = oaBufferSize / rawReportSize;
 
     // Trim to OA buffer size if needed.
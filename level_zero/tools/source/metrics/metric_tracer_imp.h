@@ -8,6 +8,9 @@
 #pragma once
 
 #include "level_zero/tools/source/metrics/metric.h"
+#include "level_zero/tools/source/metrics/metric_tracer_drainer.h"
+
+#include <memory>
 
 struct Event;
 
@@ -34,6 +37,7 @@ struct MetricTracerImp : MetricTracer {
     Event *pNotificationEvent = nullptr;
     uint32_t rawReportSize = 0;
     uint32_t oaBufferSize = 0;
+    std::unique_ptr<MetricTracerDrainer> drainer;
 };
 
 } // namespace L0
\ No newline at end of file
@@ -83,22 +83,7 @@ ze_result_t FrequencyImp::frequencySetRange(const zet_freq_range_t *pLimits) {
 ze_result_t FrequencyImp::frequencyGetState(zet_freq_state_t *pState) {
     ze_result_t result;
 
-    result = pOsFrequency->getRequest(pState->request);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    result = pOsFrequency->getTdp(pState->tdp);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    result = pOsFrequency->getEfficient(pState->efficient);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    result = pOsFrequency->getActual(pState->actual);
+    result = pOsFrequency->getState(*pState);
     if (ZE_RESULT_SUCCESS != result) {
         return result;
     }
@@ -17,6 +17,7 @@ const std::string LinuxFrequencyImp::actualFreqFile("gt_act_freq_mhz");
 const std::string LinuxFrequencyImp::efficientFreqFile("gt_RP1_freq_mhz");
 const std::string LinuxFrequencyImp::maxValFreqFile("gt_RP0_freq_mhz");
 const std::string LinuxFrequencyImp::minValFreqFile("gt_RPn_freq_mhz");
+const std::vector<std::string> LinuxFrequencyImp::stateFreqFiles{requestFreqFile, tdpFreqFile, efficientFreqFile, actualFreqFile};
 
 ze_result_t LinuxFrequencyImp::getMin(double &min) {
     double intval;
@@ -127,6 +128,20 @@ ze_result_t LinuxFrequencyImp::getThrottleReasons(uint32_t &throttleReasons) {
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t LinuxFrequencyImp::getState(zet_freq_state_t &state) {
+    std::vector<uint64_t> values;
+
+    ze_result_t result = pSysfsAccess->read(stateFreqFiles, values);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
+    }
+    state.request = static_cast<double>(values[0]);
+    state.tdp = static_cast<double>(values[1]);
+    state.efficient = static_cast<double>(values[2]);
+    state.actual = static_cast<double>(values[3]);
+    return ZE_RESULT_SUCCESS;
+}
+
 LinuxFrequencyImp::LinuxFrequencyImp(OsSysman *pOsSysman) {
     LinuxSysmanImp *pLinuxSysmanImp = static_cast<LinuxSysmanImp *>(pOsSysman);
 
@@ -28,6 +28,7 @@ class LinuxFrequencyImp : public NEO::NonCopyableClass, public OsFrequency {
     ze_result_t getMaxVal(double &maxVal) override;
     ze_result_t getMinVal(double &minVal) override;
     ze_result_t getThrottleReasons(uint32_t &throttleReasons) override;
+    ze_result_t getState(zet_freq_state_t &state) override;
     LinuxFrequencyImp() = default;
     LinuxFrequencyImp(OsSysman *pOsSysman);
     ~LinuxFrequencyImp() override = default;
@@ -44,6 +45,7 @@ class LinuxFrequencyImp : public NEO::NonCopyableClass, public OsFrequency {
     static const std::string efficientFreqFile;
     static const std::string maxValFreqFile;
     static const std::string minValFreqFile;
+    static const std::vector<std::string> stateFreqFiles;
 };
 
 } // namespace L0
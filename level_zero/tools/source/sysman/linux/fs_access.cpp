@@ -7,13 +7,19 @@
 
 #include "level_zero/tools/source/sysman/linux/fs_access.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
 #include <climits>
 
+#include <algorithm>
 #include <array>
+#include <cctype>
 #include <cerrno>
 #include <cstdio>
 #include <cstdlib>
 #include <dirent.h>
+#include <fcntl.h>
+#include <limits>
 #include <unistd.h>
 
 namespace L0 {
@@ -295,6 +301,180 @@ ze_result_t ProcfsAccess::getFileName(const ::pid_t pid, const int fd, std::stri
     return ::getpid();
 }
 
+// Sysfs Reader
+constexpr size_t SysfsReader::bufferSize;
+
+SysfsReader::SysfsReader(const std::string dirname, std::chrono::microseconds timeToLive)
+    : dirname(dirname), timeToLive(timeToLive) {
+}
+
+SysfsReader::~SysfsReader() {
+    for (auto &attribute : attributes) {
+        ::close(attribute.second.fd);
+    }
+}
+
+ze_result_t SysfsReader::fetch(const std::string &file, const char *&value) {
+    auto now = std::chrono::steady_clock::now();
+    auto it = attributes.find(file);
+    if (it == attributes.end()) {
+        int fd = ::open((dirname + file).c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return getResult(errno);
+        }
+        it = attributes.emplace(file, Attribute{}).first;
+        it->second.fd = fd;
+    }
+
+    auto &attribute = it->second;
+    if (!attribute.valid || (now - attribute.readTime) >= timeToLive) {
+        ssize_t len = ::pread(attribute.fd, attribute.buffer.data(), bufferSize - 1, 0);
+        if (len < 0) {
+            auto result = getResult(errno);
+            ::close(attribute.fd);
+            attributes.erase(it);
+            return result;
+        }
+        if (static_cast<size_t>(len) == bufferSize - 1) {
+            // value may be truncated, caller has to read the whole file
+            attribute.valid = false;
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+        attribute.buffer[len] = '\0';
+        attribute.readTime = now;
+        attribute.valid = true;
+    }
+    value = attribute.buffer.data();
+    return ZE_RESULT_SUCCESS;
+}
+
+// Parses optionally signed decimal the way operator>> does: leading whitespace is skipped
+// and parsing stops at the first non-digit. Fails when magnitude exceeds limit.
+static bool parseMagnitude(const char *str, uint64_t limit, bool &negative, uint64_t &magnitude) {
+    while (std::isspace(static_cast<unsigned char>(*str))) {
+        str++;
+    }
+    negative = (*str == '-');
+    if (negative || *str == '+') {
+        str++;
+    }
+    if (!std::isdigit(static_cast<unsigned char>(*str))) {
+        return false;
+    }
+    uint64_t result = 0;
+    for (; std::isdigit(static_cast<unsigned char>(*str)); str++) {
+        uint64_t digit = static_cast<uint64_t>(*str - '0');
+        if (result > (limit - digit) / 10) {
+            return false;
+        }
+        result = result * 10 + digit;
+    }
+    magnitude = result;
+    return true;
+}
+
+bool SysfsReader::parseUnsigned(const char *str, uint64_t &val) {
+    bool negative = false;
+    uint64_t magnitude = 0;
+    if (!parseMagnitude(str, std::numeric_limits<uint64_t>::max(), negative, magnitude)) {
+        return false;
+    }
+    // Stream extraction into unsigned accepts minus sign and negates the value modulo 2^64
+    val = negative ? (0u - magnitude) : magnitude;
+    return true;
+}
+
+bool SysfsReader::parseSigned(const char *str, int &val) {
+    constexpr uint64_t maxPositive = static_cast<uint64_t>(std::numeric_limits<int>::max());
+    bool negative = false;
+    uint64_t magnitude = 0;
+    if (!parseMagnitude(str, maxPositive + 1, negative, magnitude) ||
+        (!negative && magnitude > maxPositive)) {
+        return false;
+    }
+    val = static_cast<int>(negative ? -static_cast<int64_t>(magnitude) : static_cast<int64_t>(magnitude));
+    return true;
+}
+
+ze_result_t SysfsReader::read(const std::string file, std::string &val) {
+    std::lock_guard<std::mutex> lock(mtx);
+    const char *value = nullptr;
+    auto result = fetch(file, value);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
+    }
+    // Same as reading a single token from a stream
+    while (std::isspace(static_cast<unsigned char>(*value))) {
+        value++;
+    }
+    auto end = value;
+    while (*end != '\0' && !std::isspace(static_cast<unsigned char>(*end))) {
+        end++;
+    }
+    if (end == value) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+    val.assign(value, end);
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t SysfsReader::read(const std::string file, int &val) {
+    std::lock_guard<std::mutex> lock(mtx);
+    const char *value = nullptr;
+    auto result = fetch(file, value);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
+    }
+    return parseSigned(value, val) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
+}
+
+ze_result_t SysfsReader::read(const std::string file, uint64_t &val) {
+    std::lock_guard<std::mutex> lock(mtx);
+    const char *value = nullptr;
+    auto result = fetch(file, value);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
+    }
+    return parseUnsigned(value, val) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
+}
+
+ze_result_t SysfsReader::read(const std::string file, double &val) {
+    std::lock_guard<std::mutex> lock(mtx);
+    const char *value = nullptr;
+    auto result = fetch(file, value);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
+    }
+    char *end = nullptr;
+    val = std::strtod(value, &end);
+    return (end != value) ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
+}
+
+ze_result_t SysfsReader::read(const std::vector<std::string> &files, std::vector<uint64_t> &vals) {
+    // Sample all attributes under one lock, so they are taken as close in time as possible
+    std::lock_guard<std::mutex> lock(mtx);
+    vals.resize(files.size());
+    for (size_t i = 0; i < files.size(); i++) {
+        const char *value = nullptr;
+        auto result = fetch(files[i], value);
+        if (ZE_RESULT_SUCCESS != result) {
+            return result;
+        }
+        if (!parseUnsigned(value, vals[i])) {
+            return ZE_RESULT_ERROR_UNKNOWN;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+void SysfsReader::invalidate(const std::string file) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = attributes.find(file);
+    if (it != attributes.end()) {
+        it->second.valid = false;
+    }
+}
+
 // Sysfs Access
 const std::string SysfsAccess::drmPath = "/sys/class/drm/";
 const std::string SysfsAccess::devicesPath = "device/drm/";
@@ -320,6 +500,11 @@ SysfsAccess::SysfsAccess(const std::string dev) {
             break;
         }
     }
+
+    if (NEO::DebugManager.flags.EnableSysmanSysfsReader.get() == 1) {
+        int64_t timeToLive = std::max(NEO::DebugManager.flags.SysmanSysfsReaderTtlUs.get(), 0);
+        pReader = std::make_unique<SysfsReader>(dirname, std::chrono::microseconds(timeToLive));
+    }
 }
 
 SysfsAccess *SysfsAccess::create(const std::string dev) {
@@ -342,11 +527,23 @@ ze_result_t SysfsAccess::getFileMode(const std::string file, ::mode_t &mode) {
 }
 
 ze_result_t SysfsAccess::read(const std::string file, std::string &val) {
+    if (pReader) {
+        auto result = pReader->read(file, val);
+        if (ZE_RESULT_ERROR_UNSUPPORTED_FEATURE != result) {
+            return result;
+        }
+    }
     // Prepend sysfs directory path and call the base read
     return FsAccess::read(fullPath(file).c_str(), val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, int &val) {
+    if (pReader) {
+        auto result = pReader->read(file, val);
+        if (ZE_RESULT_ERROR_UNSUPPORTED_FEATURE != result) {
+            return result;
+        }
+    }
     std::string str;
     ze_result_t result;
 
@@ -365,6 +562,12 @@ ze_result_t SysfsAccess::read(const std::string file, int &val) {
 }
 
 ze_result_t SysfsAccess::read(const std::string file, double &val) {
+    if (pReader) {
+        auto result = pReader->read(file, val);
+        if (ZE_RESULT_ERROR_UNSUPPORTED_FEATURE != result) {
+            return result;
+        }
+    }
     std::string str;
     ze_result_t result;
 
@@ -383,6 +586,12 @@ ze_result_t SysfsAccess::read(const std::string file, double &val) {
 }
 
 ze_result_t SysfsAccess::read(const std::string file, uint64_t &val) {
+    if (pReader) {
+        auto result = pReader->read(file, val);
+        if (ZE_RESULT_ERROR_UNSUPPORTED_FEATURE != result) {
+            return result;
+        }
+    }
     std::string str;
     ze_result_t result;
 
@@ -405,9 +614,30 @@ ze_result_t SysfsAccess::read(const std::string file, std::vector<std::string> &
     return FsAccess::read(fullPath(file), val);
 }
 
+ze_result_t SysfsAccess::read(const std::vector<std::string> &files, std::vector<uint64_t> &vals) {
+    if (pReader) {
+        auto result = pReader->read(files, vals);
+        if (ZE_RESULT_ERROR_UNSUPPORTED_FEATURE != result) {
+            return result;
+        }
+    }
+    vals.resize(files.size());
+    for (size_t i = 0; i < files.size(); i++) {
+        auto result = read(files[i], vals[i]);
+        if (ZE_RESULT_SUCCESS != result) {
+            return result;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t SysfsAccess::write(const std::string file, const std::string val) {
     // Prepend sysfs directory path and call the base write
-    return FsAccess::write(fullPath(file).c_str(), val);
+    ze_result_t result = FsAccess::write(fullPath(file).c_str(), val);
+    if (pReader) {
+        pReader->invalidate(file);
+    }
+    return result;
 }
 
 ze_result_t SysfsAccess::write(const std::string file, const int val) {
@@ -417,7 +647,7 @@ ze_result_t SysfsAccess::write(const std::string file, const int val) {
     if (stream.fail()) {
         return ZE_RESULT_ERROR_UNKNOWN;
     }
-    return FsAccess::write(fullPath(file), stream.str());
+    return write(file, stream.str());
 }
 
 ze_result_t SysfsAccess::write(const std::string file, const double val) {
@@ -427,7 +657,7 @@ ze_result_t SysfsAccess::write(const std::string file, const double val) {
     if (stream.fail()) {
         return ZE_RESULT_ERROR_UNKNOWN;
     }
-    return FsAccess::write(fullPath(file), stream.str());
+    return write(file, stream.str());
 }
 
 ze_result_t SysfsAccess::write(const std::string file, const uint64_t val) {
@@ -437,7 +667,7 @@ ze_result_t SysfsAccess::write(const std::string file, const uint64_t val) {
     if (stream.fail()) {
         return ZE_RESULT_ERROR_UNKNOWN;
     }
-    return FsAccess::write(fullPath(file), stream.str());
+    return write(file, stream.str());
 }
 
 ze_result_t SysfsAccess::scanDirEntries(const std::string path, std::vector<std::string> &list) {
@@ -10,15 +10,20 @@
 #include "level_zero/ze_api.h"
 #include "level_zero/zet_api.h"
 
+#include <array>
+#include <chrono>
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
 #include <sys/sysmacros.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <unordered_map>
 #include <vector>
 
 namespace L0 {
@@ -69,6 +74,42 @@ class ProcfsAccess : private FsAccess {
     static const std::string fdDir;
 };
 
+// Keeps sysfs attributes open and rereads them with pread() into preallocated buffers.
+// sysfs regenerates an attribute on every read from offset 0, so an open descriptor
+// always reports the current value. Values younger than timeToLive are not reread.
+class SysfsReader {
+  public:
+    static constexpr size_t bufferSize = 128;
+
+    SysfsReader(const std::string dirname, std::chrono::microseconds timeToLive);
+    ~SysfsReader();
+
+    ze_result_t read(const std::string file, std::string &val);
+    ze_result_t read(const std::string file, int &val);
+    ze_result_t read(const std::string file, uint64_t &val);
+    ze_result_t read(const std::string file, double &val);
+    ze_result_t read(const std::vector<std::string> &files, std::vector<uint64_t> &vals);
+    void invalidate(const std::string file);
+
+    static bool parseUnsigned(const char *str, uint64_t &val);
+    static bool parseSigned(const char *str, int &val);
+
+  protected:
+    struct Attribute {
+        int fd = -1;
+        bool valid = false;
+        std::chrono::steady_clock::time_point readTime;
+        std::array<char, bufferSize> buffer;
+    };
+
+    ze_result_t fetch(const std::string &file, const char *&value);
+
+    const std::string dirname;
+    const std::chrono::microseconds timeToLive;
+    std::unordered_map<std::string, Attribute> attributes;
+    std::mutex mtx;
+};
+
 class SysfsAccess : private FsAccess {
   public:
     static SysfsAccess *create(const std::string file);
@@ -84,6 +125,7 @@ class SysfsAccess : private FsAccess {
     MOCKABLE_VIRTUAL ze_result_t read(const std::string file, uint64_t &val);
     MOCKABLE_VIRTUAL ze_result_t read(const std::string file, double &val);
     MOCKABLE_VIRTUAL ze_result_t read(const std::string file, std::vector<std::string> &val);
+    MOCKABLE_VIRTUAL ze_result_t read(const std::vector<std::string> &files, std::vector<uint64_t> &vals);
 
     ze_result_t write(const std::string file, const std::string val);
     MOCKABLE_VIRTUAL ze_result_t write(const std::string file, const int val);
@@ -106,6 +148,7 @@ class SysfsAccess : private FsAccess {
 
     std::vector<std::string> deviceNames;
     std::string dirname;
+    std::unique_ptr<SysfsReader> pReader;
     static const std::string drmPath;
     static const std::string devicesPath;
     static const std::string primaryDevName;
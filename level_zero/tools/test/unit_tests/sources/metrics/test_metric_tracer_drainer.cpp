@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "level_zero/tools/source/metrics/metric.h"
+#include "level_zero/tools/source/metrics/metric_tracer_drainer.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace L0 {
+namespace ult {
+
+// Metrics library io stream producing reports filled with consecutive numbers.
+struct MockMetricGroup : public MetricGroup {
+    ze_result_t getProperties(zet_metric_group_properties_t *pProperties) override { return ZE_RESULT_SUCCESS; }
+    ze_result_t getMetric(uint32_t *pCount, zet_metric_handle_t *phMetrics) override { return ZE_RESULT_SUCCESS; }
+    ze_result_t calculateMetricValues(size_t rawDataSize, const uint8_t *pRawData, uint32_t *pMetricValueCount,
+                                      zet_typed_value_t *pMetricValues) override { return ZE_RESULT_SUCCESS; }
+    uint32_t getRawReportSize() override { return rawReportSize; }
+    bool activate() override { return true; }
+    bool deactivate() override { return true; }
+    ze_result_t openIoStream(uint32_t &timerPeriodNs, uint32_t &oaBufferSize) override { return ZE_RESULT_SUCCESS; }
+    ze_result_t closeIoStream() override { return ZE_RESULT_SUCCESS; }
+
+    ze_result_t waitForReports(const uint32_t timeoutMs) override {
+        std::lock_guard<std::mutex> lock(mtx);
+        return availableReports > 0u ? ZE_RESULT_SUCCESS : ZE_RESULT_NOT_READY;
+    }
+
+    ze_result_t readIoStream(uint32_t &reportCount, uint8_t &reportData) override {
+        std::lock_guard<std::mutex> lock(mtx);
+        readIoStreamCalled++;
+        reportCount = std::min(reportCount, availableReports);
+        for (uint32_t i = 0; i < reportCount; i++) {
+            memset(&reportData + i * rawReportSize, static_cast<int>(nextReport++), rawReportSize);
+        }
+        availableReports -= reportCount;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    void addReports(uint32_t count) {
+        std::lock_guard<std::mutex> lock(mtx);
+        availableReports += count;
+    }
+
+    uint32_t getAvailableReports() {
+        std::lock_guard<std::mutex> lock(mtx);
+        return availableReports;
+    }
+
+    static constexpr uint32_t rawReportSize = 8u;
+    uint32_t availableReports = 0u;
+    uint32_t nextReport = 0u;
+    uint32_t readIoStreamCalled = 0u;
+    std::mutex mtx;
+};
+
+constexpr uint32_t MockMetricGroup::rawReportSize;
+
+TEST(MetricTracerDrainerTest, givenDefaultSettingsWhenCreatingDrainerThenNullptrIsReturned) {
+    MockMetricGroup metricGroup;
+    EXPECT_EQ(nullptr, MetricTracerDrainer::create(metricGroup, MockMetricGroup::rawReportSize, 64 * MockMetricGroup::rawReportSize, 32));
+}
+
+TEST(MetricTracerDrainerTest, givenDrainerEnabledWhenCreatingDrainerThenRingAndHighWaterAreDerivedFromOaBuffer) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableMetricTracerDrainer.set(1);
+    MockMetricGroup metricGroup;
+
+    auto drainer = MetricTracerDrainer::create(metricGroup, MockMetricGroup::rawReportSize, 64 * MockMetricGroup::rawReportSize, 32);
+    ASSERT_NE(nullptr, drainer);
+    EXPECT_EQ(MetricTracerDrainer::defaultRingSizeInOaBuffers * 64, drainer->getRingReportCount());
+    EXPECT_EQ(32u, drainer->getHighWaterReportCount());
+
+    NEO::DebugManager.flags.MetricTracerDrainerRingSize.set(16);
+    NEO::DebugManager.flags.MetricTracerDrainerHighWater.set(100);
+    drainer = MetricTracerDrainer::create(metricGroup, MockMetricGroup::rawReportSize, 64 * MockMetricGroup::rawReportSize, 32);
+    ASSERT_NE(nullptr, drainer);
+    EXPECT_EQ(16u, drainer->getRingReportCount());
+    EXPECT_EQ(16u, drainer->getHighWaterReportCount());
+}
+
+TEST(MetricTracerDrainerTest, givenRingWrappingWhenDrainingAndReadingThenReportsAreReturnedInOrder) {
+    MockMetricGroup metricGroup;
+    MetricTracerDrainer drainer(metricGroup, MockMetricGroup::rawReportSize, 4, 4);
+
+    metricGroup.addReports(3);
+    EXPECT_EQ(3u, drainer.drain());
+
+    uint8_t rawData[4 * MockMetricGroup::rawReportSize] = {};
+    EXPECT_EQ(2u, drainer.readReports(2, rawData));
+    EXPECT_EQ(0u, rawData[0]);
+    EXPECT_EQ(1u, rawData[MockMetricGroup::rawReportSize]);
+
+    metricGroup.addReports(3);
+    metricGroup.readIoStreamCalled = 0;
+    EXPECT_EQ(3u, drainer.drain());
+    EXPECT_EQ(2u, metricGroup.readIoStreamCalled);
+    EXPECT_EQ(4u, drainer.getPendingReportCount());
+
+    EXPECT_EQ(4u, drainer.readReports(8, rawData));
+    for (uint32_t i = 0; i < 4; i++) {
+        EXPECT_EQ(2u + i, rawData[i * MockMetricGroup::rawReportSize]);
+        EXPECT_EQ(2u + i, rawData[(i + 1) * MockMetricGroup::rawReportSize - 1]);
+    }
+    EXPECT_EQ(0u, drainer.getPendingReportCount());
+}
+
+TEST(MetricTracerDrainerTest, givenFullRingWhenDrainingThenRemainingReportsStayInIoStream) {
+    MockMetricGroup metricGroup;
+    MetricTracerDrainer drainer(metricGroup, MockMetricGroup::rawReportSize, 2, 2);
+
+    metricGroup.addReports(5);
+    EXPECT_EQ(2u, drainer.drain());
+    EXPECT_EQ(1u, drainer.getRingFullCount());
+    EXPECT_EQ(3u, metricGroup.getAvailableReports());
+
+    uint8_t rawData[MockMetricGroup::rawReportSize] = {};
+    EXPECT_EQ(1u, drainer.readReports(1, rawData));
+    EXPECT_EQ(1u, drainer.drain());
+    EXPECT_EQ(2u, metricGroup.getAvailableReports());
+}
+
+TEST(MetricTracerDrainerTest, givenHighWaterWhenReportsAreDrainedThenHighWaterIsReachedOnlyAboveIt) {
+    MockMetricGroup metricGroup;
+    MetricTracerDrainer drainer(metricGroup, MockMetricGroup::rawReportSize, 8, 2);
+
+    metricGroup.addReports(1);
+    drainer.drain();
+    EXPECT_FALSE(drainer.isHighWaterReached());
+
+    metricGroup.addReports(1);
+    drainer.drain();
+    EXPECT_TRUE(drainer.isHighWaterReached());
+}
+
+TEST(MetricTracerDrainerTest, givenStartedDrainerWhenReportsArriveThenTheyAreDrainedInBackground) {
+    MockMetricGroup metricGroup;
+    MetricTracerDrainer drainer(metricGroup, MockMetricGroup::rawReportSize, 8, 4);
+    drainer.start();
+
+    metricGroup.addReports(6);
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (drainer.getPendingReportCount() < 6u && std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(6u, drainer.getPendingReportCount());
+    EXPECT_TRUE(drainer.isHighWaterReached());
+
+    metricGroup.addReports(4);
+    timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (metricGroup.getAvailableReports() > 2u && std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(8u, drainer.getPendingReportCount());
+
+    uint8_t rawData[8 * MockMetricGroup::rawReportSize] = {};
+    EXPECT_EQ(8u, drainer.readReports(8, rawData));
+    timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (metricGroup.getAvailableReports() > 0u && std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(0u, metricGroup.getAvailableReports());
+
+    drainer.stop();
+}
+
+} // namespace ult
+} // namespace L0
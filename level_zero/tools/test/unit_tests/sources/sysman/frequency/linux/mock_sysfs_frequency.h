@@ -50,6 +50,19 @@ struct Mock<FrequencySysfsAccess> : public FrequencySysfsAccess {
     MOCK_METHOD2(read, ze_result_t(const std::string file, double &val));
     MOCK_METHOD2(write, ze_result_t(const std::string file, const double val));
 
+    ze_result_t read(const std::vector<std::string> &files, std::vector<uint64_t> &vals) override {
+        vals.resize(files.size());
+        for (size_t i = 0; i < files.size(); i++) {
+            double val = 0;
+            ze_result_t result = read(files[i], val);
+            if (ZE_RESULT_SUCCESS != result) {
+                return result;
+            }
+            vals[i] = static_cast<uint64_t>(val);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
     ze_result_t getVal(const std::string file, double &val) {
         if (file.compare(minFreqFile) == 0) {
             val = mockMin;
@@ -271,5 +271,13 @@ TEST_F(SysmanFrequencyFixture, GivenValidFrequencyHandleWhenCallingzetSysmanFreq
     EXPECT_EQ(0u, state.throttleReasons);
 }
 
+TEST_F(SysmanFrequencyFixture, GivenActualFrequencyReadFailsWhenCallingzetSysmanFrequencyGetStateThenErrorIsReturned) {
+    ON_CALL(*pSysfsAccess, read(actualFreqFile, _))
+        .WillByDefault(Return(ZE_RESULT_ERROR_NOT_AVAILABLE));
+
+    zet_freq_state_t state;
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, zetSysmanFrequencyGetState(hSysmanFrequency, &state));
+}
+
 } // namespace ult
 } // namespace L0
@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/unit_test/helpers/benchmark_runner.h"
+#include "shared/test/unit_test/helpers/memory_management.h"
+
+#include "level_zero/tools/source/sysman/linux/fs_access.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <sstream>
+
+namespace L0 {
+namespace ult {
+
+namespace {
+::testing::Environment *const benchmarkEnvironment = ::testing::AddGlobalTestEnvironment(new NEO::BenchmarkEnvironment);
+} // namespace
+
+class SysmanSysfsReaderFixture : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        char dirTemplate[] = "/tmp/sysman_sysfs_XXXXXX";
+        ASSERT_NE(nullptr, ::mkdtemp(dirTemplate));
+        dirname = std::string(dirTemplate) + "/";
+    }
+
+    void TearDown() override {
+        for (auto &file : files) {
+            std::remove((dirname + file).c_str());
+        }
+        ::rmdir(dirname.c_str());
+    }
+
+    void writeAttribute(const std::string &file, const std::string &value) {
+        std::ofstream fs(dirname + file, std::ios::trunc);
+        fs << value << std::endl;
+        files.push_back(file);
+    }
+
+    std::string dirname;
+    std::vector<std::string> files;
+};
+
+TEST_F(SysmanSysfsReaderFixture, GivenSysfsAttributesWhenReadingThenValuesAreParsed) {
+    writeAttribute("gt_act_freq_mhz", "1100");
+    writeAttribute("offset", "-5");
+    writeAttribute("energy", "3.5");
+    writeAttribute("mode", "default extra");
+
+    SysfsReader reader(dirname, std::chrono::microseconds(0));
+
+    uint64_t frequency = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read("gt_act_freq_mhz", frequency));
+    EXPECT_EQ(1100u, frequency);
+
+    int offset = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read("offset", offset));
+    EXPECT_EQ(-5, offset);
+
+    double energy = 0.0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read("energy", energy));
+    EXPECT_EQ(3.5, energy);
+
+    std::string mode;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read("mode", mode));
+    EXPECT_EQ("default", mode);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, reader.read("mode", frequency));
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, reader.read("missing", frequency));
+}
+
+TEST_F(SysmanSysfsReaderFixture, GivenZeroTimeToLiveWhenAttributeChangesThenNewValueIsReadThroughOpenDescriptor) {
+    writeAttribute("gt_act_freq_mhz", "300");
+    SysfsReader reader(dirname, std::chrono::microseconds(0));
+
+    uint64_t frequency = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read("gt_act_freq_mhz", frequency));
+    EXPECT_EQ(300u, frequency);
+
+    writeAttribute("gt_act_freq_mhz", "1100");
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read("gt_act_freq_mhz", frequency));
+    EXPECT_EQ(1100u, frequency);
+}
+
+TEST_F(SysmanSysfsReaderFixture, GivenLongTimeToLiveWhenAttributeChangesThenCachedValueIsReturnedUntilInvalidated) {
+    writeAttribute("gt_max_freq_mhz", "1100");
+    SysfsReader reader(dirname, std::chrono::hours(1));
+
+    uint64_t frequency = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read("gt_max_freq_mhz", frequency));
+    writeAttribute("gt_max_freq_mhz", "900");
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read("gt_max_freq_mhz", frequency));
+    EXPECT_EQ(1100u, frequency);
+
+    reader.invalidate("gt_max_freq_mhz");
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read("gt_max_freq_mhz", frequency));
+    EXPECT_EQ(900u, frequency);
+}
+
+TEST_F(SysmanSysfsReaderFixture, GivenMultipleAttributesWhenReadingInBatchThenAllValuesAreReturned) {
+    writeAttribute("gt_cur_freq_mhz", "400");
+    writeAttribute("gt_boost_freq_mhz", "1200");
+    writeAttribute("gt_act_freq_mhz", "350");
+    SysfsReader reader(dirname, std::chrono::microseconds(0));
+
+    std::vector<uint64_t> values;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reader.read({"gt_cur_freq_mhz", "gt_boost_freq_mhz", "gt_act_freq_mhz"}, values));
+    ASSERT_EQ(3u, values.size());
+    EXPECT_EQ(400u, values[0]);
+    EXPECT_EQ(1200u, values[1]);
+    EXPECT_EQ(350u, values[2]);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, reader.read({"gt_cur_freq_mhz", "missing"}, values));
+}
+
+TEST_F(SysmanSysfsReaderFixture, GivenAttributeLongerThanBufferWhenReadingThenUnsupportedFeatureIsReturned) {
+    writeAttribute("long", std::string(SysfsReader::bufferSize, '1'));
+    SysfsReader reader(dirname, std::chrono::microseconds(0));
+
+    std::string value;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, reader.read("long", value));
+}
+
+TEST(SysmanSysfsReaderParseTest, GivenTextWhenParsingIntegersThenOnlyNumbersAreAccepted) {
+    uint64_t unsignedValue = 0;
+    EXPECT_TRUE(SysfsReader::parseUnsigned(" 18446744073709551615\n", unsignedValue));
+    EXPECT_EQ(18446744073709551615u, unsignedValue);
+    EXPECT_FALSE(SysfsReader::parseUnsigned("abc", unsignedValue));
+    EXPECT_FALSE(SysfsReader::parseUnsigned("", unsignedValue));
+
+    int signedValue = 0;
+    EXPECT_TRUE(SysfsReader::parseSigned("+7", signedValue));
+    EXPECT_EQ(7, signedValue);
+    EXPECT_TRUE(SysfsReader::parseSigned(" -42\n", signedValue));
+    EXPECT_EQ(-42, signedValue);
+    EXPECT_FALSE(SysfsReader::parseSigned("- 5", signedValue));
+}
+
+TEST(SysmanSysfsReaderParseTest, GivenValuesOutOfRangeWhenParsingIntegersThenParsingFailsAsWithStreamExtraction) {
+    uint64_t unsignedValue = 0;
+    EXPECT_FALSE(SysfsReader::parseUnsigned("18446744073709551616", unsignedValue));
+    EXPECT_FALSE(SysfsReader::parseUnsigned("99999999999999999999", unsignedValue));
+    EXPECT_FALSE(SysfsReader::parseUnsigned("-18446744073709551616", unsignedValue));
+
+    int signedValue = 0;
+    EXPECT_TRUE(SysfsReader::parseSigned("2147483647", signedValue));
+    EXPECT_EQ(std::numeric_limits<int>::max(), signedValue);
+    EXPECT_TRUE(SysfsReader::parseSigned("-2147483648", signedValue));
+    EXPECT_EQ(std::numeric_limits<int>::min(), signedValue);
+    EXPECT_FALSE(SysfsReader::parseSigned("2147483648", signedValue));
+    EXPECT_FALSE(SysfsReader::parseSigned("-2147483649", signedValue));
+    EXPECT_FALSE(SysfsReader::parseSigned("4294967295", signedValue));
+    EXPECT_FALSE(SysfsReader::parseSigned("18446744073709551617", signedValue));
+}
+
+TEST(SysmanSysfsReaderParseTest, GivenNegativeValueWhenParsingUnsignedThenValueIsNegatedModuloAsWithStreamExtraction) {
+    uint64_t unsignedValue = 0;
+    EXPECT_TRUE(SysfsReader::parseUnsigned("-1", unsignedValue));
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), unsignedValue);
+    EXPECT_TRUE(SysfsReader::parseUnsigned("-18446744073709551615", unsignedValue));
+    EXPECT_EQ(1u, unsignedValue);
+    EXPECT_TRUE(SysfsReader::parseUnsigned("-0", unsignedValue));
+    EXPECT_EQ(0u, unsignedValue);
+    EXPECT_TRUE(SysfsReader::parseUnsigned("+5", unsignedValue));
+    EXPECT_EQ(5u, unsignedValue);
+
+    for (auto text : {"-1", "18446744073709551615", "18446744073709551616", "-18446744073709551616", "12abc", "+"}) {
+        uint64_t streamValue = 0;
+        std::istringstream stream(text);
+        stream >> streamValue;
+        EXPECT_EQ(!stream.fail(), SysfsReader::parseUnsigned(text, unsignedValue)) << text;
+        if (!stream.fail()) {
+            EXPECT_EQ(streamValue, unsignedValue) << text;
+        }
+    }
+}
+
+// Host cost of sampling frequency attributes, as zesFrequencyGetState does, on a fake sysfs tree.
+// Stream based path opens and closes the file on every read, reader rereads open descriptors.
+TEST_F(SysmanSysfsReaderFixture, DISABLED_readFrequencyAttributes) {
+    // Benchmark results outlive the test.
+    MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+
+    const std::vector<std::string> attributes = {"gt_cur_freq_mhz", "gt_boost_freq_mhz", "gt_act_freq_mhz"};
+    for (auto &attribute : attributes) {
+        writeAttribute(attribute, "1100");
+    }
+    std::unique_ptr<FsAccess> fsAccess(FsAccess::create());
+    SysfsReader reader(dirname, std::chrono::microseconds(0));
+    std::atomic<uint32_t> failures{0u};
+
+    for (auto threadCount : NEO::BenchmarkRunner::getThreadCounts()) {
+        NEO::BenchmarkRunner::run("FsAccess::read(uint64_t) x3", threadCount, [&](uint32_t thread, uint32_t iteration) {
+            uint64_t value = 0;
+            for (auto &attribute : attributes) {
+                failures += (ZE_RESULT_SUCCESS != fsAccess->read(dirname + attribute, value));
+            }
+        });
+        NEO::BenchmarkRunner::run("SysfsReader::read(uint64_t) x3", threadCount, [&](uint32_t thread, uint32_t iteration) {
+            uint64_t value = 0;
+            for (auto &attribute : attributes) {
+                failures += (ZE_RESULT_SUCCESS != reader.read(attribute, value));
+            }
+        });
+        NEO::BenchmarkRunner::run("SysfsReader::read(std::vector<uint64_t>) x3", threadCount, [&](uint32_t thread, uint32_t iteration) {
+            std::vector<uint64_t> values;
+            failures += (ZE_RESULT_SUCCESS != reader.read(attributes, values));
+        });
+    }
+    EXPECT_EQ(0u, failures.load());
+}
+
+} // namespace ult
+} // namespace L0
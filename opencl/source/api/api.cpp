@@ -19,6 +19,7 @@
 #include "shared/source/os_interface/device_factory.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/utilities/api_intercept.h"
+#include "shared/source/utilities/parallel_for.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include "opencl/source/accelerators/intel_motion_estimation.h"
@@ -44,6 +45,7 @@
 #include "opencl/source/mem_obj/mem_obj_helper.h"
 #include "opencl/source/mem_obj/pipe.h"
 #include "opencl/source/platform/platform.h"
+#include "opencl/source/program/block_kernel_manager.h"
 #include "opencl/source/program/program.h"
 #include "opencl/source/sampler/sampler.h"
 #include "opencl/source/sharings/sharing_factory.h"
@@ -1665,13 +1667,17 @@ cl_int CL_API_CALL clCreateKernelsInProgram(cl_program clProgram,
                 return retVal;
             }
 
-            for (unsigned int i = 0; i < numKernelsInProgram; ++i) {
+            // Block kernels of parent kernels share private surfaces owned by the program, create those serially.
+            auto threadCount = program->getBlockKernelManager()->getCount() == 0 ? getKernelInitializationThreadCount(numKernelsInProgram) : 1u;
+            parallelFor(numKernelsInProgram, threadCount, [&](size_t i) {
                 const auto kernelInfo = program->getKernelInfo(i);
                 DEBUG_BREAK_IF(kernelInfo == nullptr);
                 kernels[i] = Kernel::create(
                     program,
                     *kernelInfo,
                     nullptr);
+            });
+            for (unsigned int i = 0; i < numKernelsInProgram; ++i) {
                 gtpinNotifyKernelCreate(kernels[i]);
             }
         }
@@ -3494,6 +3500,7 @@ void *clHostMemAllocINTEL(
     }
 
     SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY);
+    unifiedMemoryProperties.alignment = alignment;
     cl_mem_flags flags = 0;
     cl_mem_flags_intel flagsIntel = 0;
     cl_mem_alloc_flags_intel allocflags = 0;
@@ -3532,6 +3539,7 @@ void *clDeviceMemAllocINTEL(
     }
 
     SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY);
+    unifiedMemoryProperties.alignment = alignment;
     cl_mem_flags flags = 0;
     cl_mem_flags_intel flagsIntel = 0;
     cl_mem_alloc_flags_intel allocflags = 0;
@@ -3682,7 +3690,7 @@ cl_int clGetMemAllocInfoINTEL(
         if (!unifiedMemoryAllocation) {
             return changeGetInfoStatusToCLResultType(info.set<void *>(nullptr));
         }
-        return changeGetInfoStatusToCLResultType(info.set<uint64_t>(unifiedMemoryAllocation->gpuAllocation->getGpuAddress()));
+        return changeGetInfoStatusToCLResultType(info.set<uint64_t>(unifiedMemoryAllocation->getGpuAddress()));
     }
     case CL_MEM_ALLOC_SIZE_INTEL: {
         if (!unifiedMemoryAllocation) {
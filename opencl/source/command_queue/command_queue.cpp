@@ -8,6 +8,7 @@
 #include "opencl/source/command_queue/command_queue.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/host_staging_ring.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/array_count.h"
 #include "shared/source/helpers/engine_node_helper.h"
@@ -22,6 +23,7 @@
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
 #include "opencl/source/cl_device/cl_device.h"
+#include "opencl/source/command_queue/hybrid_copy_balancer.h"
 #include "opencl/source/context/context.h"
 #include "opencl/source/device_queue/device_queue.h"
 #include "opencl/source/event/event_builder.h"
@@ -74,6 +76,7 @@ CommandQueue::CommandQueue(Context *context, ClDevice *device, const cl_queue_pr
         if (hwInfo.capabilityTable.blitterOperationsSupported) {
             auto &selectorCopyEngine = device->getDeviceById(0)->getSelectorCopyEngine();
             bcsEngine = &device->getDeviceById(0)->getEngine(EngineHelpers::getBcsEngineType(hwInfo, selectorCopyEngine), false);
+            hybridCopyBalancer = HybridCopyBalancer::create();
         }
     }
 
@@ -147,6 +150,14 @@ bool CommandQueue::isCompleted(uint32_t taskCount) const {
     return tag >= taskCount;
 }
 
+bool CommandQueue::isCompleted(uint32_t gpgpuTaskCount, uint32_t bcsTaskCount) const {
+    if (!isCompleted(gpgpuTaskCount)) {
+        return false;
+    }
+    auto bcsCsr = getBcsCommandStreamReceiver();
+    return (bcsCsr == nullptr) || (*bcsCsr->getTagAddress() >= bcsTaskCount);
+}
+
 void CommandQueue::waitUntilComplete(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep) {
     WAIT_ENTER()
 
@@ -620,7 +631,7 @@ bool CommandQueue::queueDependenciesClearRequired() const {
 }
 
 bool CommandQueue::blitEnqueueAllowed(cl_command_type cmdType) const {
-    bool blitAllowed = device->getHardwareInfo().capabilityTable.blitterOperationsSupported;
+    bool blitAllowed = device->getHardwareInfo().capabilityTable.blitterOperationsSupported && !blitEnqueueDisabled;
 
     if (DebugManager.flags.EnableBlitterOperationsForReadWriteBuffers.get() != -1) {
         blitAllowed &= !!DebugManager.flags.EnableBlitterOperationsForReadWriteBuffers.get();
@@ -634,6 +645,43 @@ bool CommandQueue::blitEnqueueAllowed(cl_command_type cmdType) const {
     return commandAllowed && blitAllowed;
 }
 
+bool CommandQueue::isHybridCopyAllowed(size_t size, cl_uint numEventsInWaitList, const cl_event *eventWaitList) {
+    if (!hybridCopyBalancer || !hybridCopyBalancer->isSplitRequired(size) || !blitEnqueueAllowed(CL_COMMAND_COPY_BUFFER)) {
+        return false;
+    }
+
+    // engines are joined with timestamp packets, taskCount based synchronization would serialize them
+    if (!getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled() || isProfilingEnabled() || isQueueBlocked()) {
+        return false;
+    }
+
+    for (cl_uint i = 0; i < numEventsInWaitList; i++) {
+        auto waitlistEvent = castToObjectOrAbort<Event>(eventWaitList[i]);
+        if (waitlistEvent->peekTaskCount() == CompletionStamp::notReady) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CommandQueue::isHostPtrStagingAllowed(size_t size, cl_uint numEventsInWaitList) const {
+    return size != 0u && numEventsInWaitList == 0u &&
+           size <= HostStagingRing::getTransferSizeThreshold(HostStagingRing::defaultRingSize);
+}
+
+HostStagingRing *CommandQueue::obtainHostStagingChunk(cl_command_type cmdType, size_t size, HostStagingChunk &chunk) {
+    // submissions deferred by user events get task count later, chunk could not be returned to the ring
+    if (isQueueBlocked()) {
+        return nullptr;
+    }
+
+    auto stagingRing = getCommandStreamReceiverByCommandType(cmdType).getHostStagingRing();
+    if (stagingRing == nullptr || !stagingRing->obtainChunk(size, chunk)) {
+        return nullptr;
+    }
+    return stagingRing;
+}
+
 bool CommandQueue::isBlockedCommandStreamRequired(uint32_t commandType, const EventsRequest &eventsRequest, bool blockedQueue) const {
     if (!blockedQueue) {
         return false;
@@ -26,6 +26,8 @@ class Device;
 class Event;
 class EventBuilder;
 class FlushStampTracker;
+class HostStagingRing;
+class HybridCopyBalancer;
 class Image;
 class IndirectHeap;
 class Kernel;
@@ -33,6 +35,7 @@ class MemObj;
 class PerformanceCounters;
 struct CompletionStamp;
 struct DispatchGlobalsArgs;
+struct HostStagingChunk;
 struct MultiDispatchInfo;
 
 enum class QueuePriority {
@@ -211,6 +214,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     volatile uint32_t *getHwTagAddress() const;
 
     bool isCompleted(uint32_t taskCount) const;
+    bool isCompleted(uint32_t gpgpuTaskCount, uint32_t bcsTaskCount) const;
 
     MOCKABLE_VIRTUAL bool isQueueBlocked();
 
@@ -256,6 +260,8 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
         return !!(this->getCommandQueueProperties() & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE);
     }
 
+    bool queueDependenciesClearRequired() const;
+
     bool isPerfCountersEnabled() const {
         return perfCountersEnabled;
     }
@@ -332,8 +338,10 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     bool bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandType, cl_bool blocking, size_t size, void *ptr,
                               cl_uint numEventsInWaitList, const cl_event *eventWaitList);
     void providePerformanceHint(TransferProperties &transferProperties);
-    bool queueDependenciesClearRequired() const;
     bool blitEnqueueAllowed(cl_command_type cmdType) const;
+    bool isHybridCopyAllowed(size_t size, cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+    bool isHostPtrStagingAllowed(size_t size, cl_uint numEventsInWaitList) const;
+    HostStagingRing *obtainHostStagingChunk(cl_command_type cmdType, size_t size, HostStagingChunk &chunk);
     void aubCaptureHook(bool &blocking, bool &clearAllDependencies, const MultiDispatchInfo &multiDispatchInfo);
     virtual bool obtainTimestampPacketForCacheFlush(bool isCacheFlushRequired) const = 0;
 
@@ -358,6 +366,9 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     bool requiresCacheFlushAfterWalker = false;
 
     std::unique_ptr<TimestampPacketContainer> timestampPacketContainer;
+
+    std::unique_ptr<HybridCopyBalancer> hybridCopyBalancer;
+    bool blitEnqueueDisabled = false;
 };
 
 using CommandQueueCreateFunc = CommandQueue *(*)(Context *context, ClDevice *device, const cl_queue_properties *properties, bool internalUsage);
@@ -409,6 +409,11 @@ class CommandQueueHw : public CommandQueue {
     cl_int enqueueMarkerForReadWriteOperation(MemObj *memObj, void *ptr, cl_command_type commandType, cl_bool blocking, cl_uint numEventsInWaitList,
                                               const cl_event *eventWaitList, cl_event *event);
 
+    void enqueueCopyBufferRange(Buffer *srcBuffer, Buffer *dstBuffer, size_t srcOffset, size_t dstOffset, size_t size,
+                                cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event);
+    void enqueueCopyBufferHybrid(Buffer *srcBuffer, Buffer *dstBuffer, size_t srcOffset, size_t dstOffset, size_t size,
+                                 cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event);
+
     MOCKABLE_VIRTUAL void dispatchAuxTranslationBuiltin(MultiDispatchInfo &multiDispatchInfo, AuxTranslationDirection auxTranslationDirection);
     void setupBlitAuxTranslation(MultiDispatchInfo &multiDispatchInfo);
 
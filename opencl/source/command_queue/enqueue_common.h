@@ -15,6 +15,7 @@
 #include "shared/source/memory_manager/surface.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/program/sync_buffer_handler.h"
+#include "shared/source/utilities/enqueue_phase_profiler.h"
 #include "shared/source/utilities/range.h"
 #include "shared/source/utilities/tag_allocator.h"
 
@@ -144,6 +145,9 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
         return;
     }
 
+    ENQUEUE_PHASE_DISPATCH(multiDispatchInfo.peekMainKernel() ? multiDispatchInfo.peekMainKernel()->getKernelInfo().name.c_str() : nullptr);
+    ENQUEUE_PHASE(Enqueue);
+
     Kernel *parentKernel = multiDispatchInfo.peekParentKernel();
     auto devQueue = this->getContext().getDefaultDeviceQueue();
     DeviceQueueHw<GfxFamily> *devQueueHw = castToObject<DeviceQueueHw<GfxFamily>>(devQueue);
@@ -247,6 +251,7 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
         blitPropertiesContainer.push_back(processDispatchForBlitEnqueue(multiDispatchInfo, timestampPacketDependencies,
                                                                         eventsRequest, commandStream, commandType, blockQueue));
     } else if (multiDispatchInfo.empty() == false) {
+        ENQUEUE_PHASE(ProcessDispatchForKernels);
         processDispatchForKernels<commandType>(multiDispatchInfo, printfHandler, eventBuilder.getEvent(),
                                                hwTimeStamps, blockQueue, devQueueHw, csrDeps, blockedCommandsData.get(),
                                                timestampPacketDependencies);
@@ -440,16 +445,19 @@ void CommandQueueHw<GfxFamily>::processDispatchForKernels(const MultiDispatchInf
         hwPerfCounter = event->getHwPerfCounterNode();
     }
 
-    HardwareInterface<GfxFamily>::dispatchWalker(
-        *this,
-        multiDispatchInfo,
-        csrDeps,
-        blockedCommandsData,
-        hwTimeStamps,
-        hwPerfCounter,
-        &timestampPacketDependencies,
-        timestampPacketContainer.get(),
-        commandType);
+    {
+        ENQUEUE_PHASE(DispatchWalker);
+        HardwareInterface<GfxFamily>::dispatchWalker(
+            *this,
+            multiDispatchInfo,
+            csrDeps,
+            blockedCommandsData,
+            hwTimeStamps,
+            hwPerfCounter,
+            &timestampPacketDependencies,
+            timestampPacketContainer.get(),
+            commandType);
+    }
 
     if (DebugManager.flags.AddPatchInfoCommentsForAUBDump.get()) {
         for (auto &dispatchInfo : multiDispatchInfo) {
@@ -669,6 +677,7 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
     PrintfHandler *printfHandler) {
 
     UNRECOVERABLE_IF(multiDispatchInfo.empty());
+    ENQUEUE_PHASE(EnqueueNonBlocked);
 
     auto implicitFlush = false;
 
@@ -11,6 +11,7 @@
 
 #include "opencl/source/command_queue/command_queue_hw.h"
 #include "opencl/source/command_queue/enqueue_common.h"
+#include "opencl/source/command_queue/hybrid_copy_balancer.h"
 #include "opencl/source/helpers/hardware_commands_helper.h"
 #include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/memory_manager/mem_obj_surface.h"
@@ -30,6 +31,26 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyBuffer(
     const cl_event *eventWaitList,
     cl_event *event) {
 
+    if (isHybridCopyAllowed(size, numEventsInWaitList, eventWaitList)) {
+        enqueueCopyBufferHybrid(srcBuffer, dstBuffer, srcOffset, dstOffset, size, numEventsInWaitList, eventWaitList, event);
+    } else {
+        enqueueCopyBufferRange(srcBuffer, dstBuffer, srcOffset, dstOffset, size, numEventsInWaitList, eventWaitList, event);
+    }
+
+    return CL_SUCCESS;
+}
+
+template <typename GfxFamily>
+void CommandQueueHw<GfxFamily>::enqueueCopyBufferRange(
+    Buffer *srcBuffer,
+    Buffer *dstBuffer,
+    size_t srcOffset,
+    size_t dstOffset,
+    size_t size,
+    cl_uint numEventsInWaitList,
+    const cl_event *eventWaitList,
+    cl_event *event) {
+
     MultiDispatchInfo dispatchInfo;
     auto eBuiltInOpsType = EBuiltInOps::CopyBufferToBuffer;
 
@@ -61,7 +82,55 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyBuffer(
         numEventsInWaitList,
         eventWaitList,
         event);
+}
 
-    return CL_SUCCESS;
+template <typename GfxFamily>
+void CommandQueueHw<GfxFamily>::enqueueCopyBufferHybrid(
+    Buffer *srcBuffer,
+    Buffer *dstBuffer,
+    size_t srcOffset,
+    size_t dstOffset,
+    size_t size,
+    cl_uint numEventsInWaitList,
+    const cl_event *eventWaitList,
+    cl_event *event) {
+
+    auto commandStreamRecieverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
+    TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
+
+    auto blitterSize = hybridCopyBalancer->getBlitterPortion(size);
+    auto computeSize = size - blitterSize;
+
+    // both parts depend on the work preceding the copy, but not on each other
+    TimestampPacketContainer previousNodes;
+    previousNodes.assignAndIncrementNodesRefCounts(*timestampPacketContainer);
+
+    TimestampPacketContainer blitterNodes;
+    uint32_t blitterTaskCount = 0;
+    if (blitterSize != 0) {
+        enqueueCopyBufferRange(srcBuffer, dstBuffer, srcOffset, dstOffset, blitterSize,
+                               numEventsInWaitList, eventWaitList, computeSize != 0 ? nullptr : event);
+        blitterTaskCount = this->bcsTaskCount;
+        blitterNodes.assignAndIncrementNodesRefCounts(*timestampPacketContainer);
+        hybridCopyBalancer->trackCopy(HybridCopyBalancer::Engine::Blitter, blitterSize, blitterNodes);
+        timestampPacketContainer->swapNodes(previousNodes);
+    }
+
+    if (computeSize != 0) {
+        blitEnqueueDisabled = true;
+        enqueueCopyBufferRange(srcBuffer, dstBuffer, srcOffset + blitterSize, dstOffset + blitterSize, computeSize,
+                               numEventsInWaitList, eventWaitList, event);
+        blitEnqueueDisabled = false;
+        hybridCopyBalancer->trackCopy(HybridCopyBalancer::Engine::Compute, computeSize, *timestampPacketContainer);
+    }
+
+    // join both engines, following enqueues and the output event wait for the whole copy
+    timestampPacketContainer->assignAndIncrementNodesRefCounts(blitterNodes);
+    if (event && computeSize != 0) {
+        // output event carries gpgpu task count of compute part, which does not wait for the blitter part
+        auto outEvent = castToObjectOrAbort<Event>(*event);
+        outEvent->addTimestampPacketNodes(blitterNodes);
+        outEvent->setBcsTaskCount(blitterTaskCount);
+    }
 }
 } // namespace NEO
@@ -8,7 +8,9 @@
 #pragma once
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/host_staging_ring.h"
 #include "shared/source/helpers/cache_policy.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
 #include "opencl/source/command_queue/command_queue_hw.h"
@@ -46,7 +48,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
     if (!mapAllocation && this->getContext().getSVMAllocsManager()) {
         auto svmEntry = this->getContext().getSVMAllocsManager()->getSVMAlloc(ptr);
         if (svmEntry) {
-            if ((svmEntry->gpuAllocation->getGpuAddress() + svmEntry->size) < (castToUint64(ptr) + size)) {
+            if ((svmEntry->getGpuAddress() + svmEntry->size) < (castToUint64(ptr) + size)) {
                 return CL_INVALID_OPERATION;
             }
 
@@ -82,6 +84,17 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
 
     void *dstPtr = ptr;
 
+    // small blocking reads land in staging ring of csr and are copied to the host pointer after completion
+    HostStagingRing *stagingRing = nullptr;
+    HostStagingChunk stagingChunk;
+    if (!mapAllocation && blockingRead && isHostPtrStagingAllowed(size, numEventsInWaitList)) {
+        stagingRing = obtainHostStagingChunk(cmdType, size, stagingChunk);
+        if (stagingRing) {
+            mapAllocation = stagingRing->getAllocation();
+            dstPtr = stagingChunk.cpuPtr;
+        }
+    }
+
     MemObjSurface bufferSurf(buffer);
     HostPtrSurface hostPtrSurf(dstPtr, size);
     GeneralSurface mapSurface;
@@ -132,6 +145,11 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadBuffer(
         eventWaitList,
         event);
 
+    if (stagingRing) {
+        memcpy_s(ptr, size, stagingChunk.cpuPtr, size);
+        stagingRing->releaseChunk(stagingChunk, 0u);
+    }
+
     return CL_SUCCESS;
 }
 } // namespace NEO
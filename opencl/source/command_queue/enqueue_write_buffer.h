@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/host_staging_ring.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
@@ -41,7 +42,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
     if (!mapAllocation && this->getContext().getSVMAllocsManager()) {
         auto svmEntry = this->getContext().getSVMAllocsManager()->getSVMAlloc(ptr);
         if (svmEntry) {
-            if ((svmEntry->gpuAllocation->getGpuAddress() + svmEntry->size) < (castToUint64(ptr) + size)) {
+            if ((svmEntry->getGpuAddress() + svmEntry->size) < (castToUint64(ptr) + size)) {
                 return CL_INVALID_OPERATION;
             }
 
@@ -79,6 +80,23 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
 
     void *srcPtr = const_cast<void *>(ptr);
 
+    // small writes are copied into staging ring of csr instead of pinning the host pointer
+    TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this, false);
+    HostStagingRing *stagingRing = nullptr;
+    HostStagingChunk stagingChunk;
+    if (!mapAllocation && isHostPtrStagingAllowed(size, numEventsInWaitList)) {
+        // queue can not get blocked by other threads until the staged write is submitted
+        queueOwnership.lock();
+        stagingRing = obtainHostStagingChunk(cmdType, size, stagingChunk);
+        if (stagingRing) {
+            memcpy_s(stagingChunk.cpuPtr, size, ptr, size);
+            mapAllocation = stagingRing->getAllocation();
+            srcPtr = stagingChunk.cpuPtr;
+        } else {
+            queueOwnership.unlock();
+        }
+    }
+
     HostPtrSurface hostPtrSurf(srcPtr, size, true);
     MemObjSurface bufferSurf(buffer);
     GeneralSurface mapSurface;
@@ -123,6 +141,11 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
         eventWaitList,
         event);
 
+    if (stagingRing) {
+        stagingRing->releaseChunk(stagingChunk, getCommandStreamReceiverByCommandType(cmdType).peekTaskCount());
+        queueOwnership.unlock();
+    }
+
     if (context->isProvidingPerformanceHints()) {
         context->providePerformanceHint(CL_CONTEXT_DIAGNOSTICS_LEVEL_NEUTRAL_INTEL, CL_ENQUEUE_WRITE_BUFFER_REQUIRES_COPY_DATA, static_cast<cl_mem>(buffer));
     }
@@ -201,10 +201,17 @@ void GpgpuWalkerHelper<GfxFamily>::setupTimestampPacket(
 
 template <typename GfxFamily>
 size_t EnqueueOperation<GfxFamily>::getSizeRequiredCSKernel(bool reserveProfilingCmdsSpace, bool reservePerfCounters, CommandQueue &commandQueue, const Kernel *pKernel) {
-    size_t size = sizeof(typename GfxFamily::GPGPU_WALKER) + HardwareCommandsHelper<GfxFamily>::getSizeRequiredCS(pKernel) +
-                  sizeof(PIPE_CONTROL) * (HardwareCommandsHelper<GfxFamily>::isPipeControlWArequired(pKernel->getDevice().getHardwareInfo()) ? 2 : 1);
+    auto estimateKernelCommandsSize = [pKernel, &commandQueue]() {
+        return sizeof(typename GfxFamily::GPGPU_WALKER) + HardwareCommandsHelper<GfxFamily>::getSizeRequiredCS(pKernel) +
+               sizeof(PIPE_CONTROL) * (HardwareCommandsHelper<GfxFamily>::isPipeControlWArequired(pKernel->getDevice().getHardwareInfo()) ? 2 : 1) +
+               PreemptionHelper::getPreemptionWaCsSize<GfxFamily>(commandQueue.getDevice()) +
+               GpgpuWalkerHelper<GfxFamily>::getSizeForWADisableLSQCROPERFforOCL(pKernel);
+    };
+    // Preemption workaround is sized for queue device, cached size is valid for kernel device only.
+    size_t size = (&commandQueue.getDevice() == &pKernel->getDevice().getDevice())
+                      ? pKernel->getSizeEstimateCache().getKernelCommandsSize(estimateKernelCommandsSize)
+                      : estimateKernelCommandsSize();
     size += HardwareCommandsHelper<GfxFamily>::getSizeRequiredForCacheFlush(commandQueue, pKernel, 0U);
-    size += PreemptionHelper::getPreemptionWaCsSize<GfxFamily>(commandQueue.getDevice());
     if (reserveProfilingCmdsSpace) {
         size += 2 * sizeof(PIPE_CONTROL) + 2 * sizeof(typename GfxFamily::MI_STORE_REGISTER_MEM);
     }
@@ -217,7 +224,6 @@ size_t EnqueueOperation<GfxFamily>::getSizeRequiredCSKernel(bool reserveProfilin
         size += commandQueue.getPerfCounters()->getGpuCommandsSize(commandBufferType, true);
         size += commandQueue.getPerfCounters()->getGpuCommandsSize(commandBufferType, false);
     }
-    size += GpgpuWalkerHelper<GfxFamily>::getSizeForWADisableLSQCROPERFforOCL(pKernel);
 
     return size;
 }
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/command_queue/hybrid_copy_balancer.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+constexpr size_t HybridCopyBalancer::defaultMinSplitSize;
+constexpr size_t HybridCopyBalancer::splitAlignment;
+constexpr double HybridCopyBalancer::initialBlitterShare;
+constexpr double HybridCopyBalancer::minEngineShare;
+constexpr double HybridCopyBalancer::throughputSmoothing;
+constexpr size_t HybridCopyBalancer::maxTrackedCopies;
+
+HybridCopyBalancer::HybridCopyBalancer(size_t minSplitSize, int32_t fixedBlitterPercentage)
+    : minSplitSize(minSplitSize), fixedShare(fixedBlitterPercentage >= 0) {
+    if (fixedShare) {
+        blitterShare = std::min(fixedBlitterPercentage, 100) / 100.0;
+    }
+}
+
+std::unique_ptr<HybridCopyBalancer> HybridCopyBalancer::create() {
+    if (DebugManager.flags.EnableHybridBufferCopy.get() != 1) {
+        return nullptr;
+    }
+    size_t minSplitSize = defaultMinSplitSize;
+    if (DebugManager.flags.HybridBufferCopyMinSize.get() != -1) {
+        minSplitSize = static_cast<size_t>(DebugManager.flags.HybridBufferCopyMinSize.get());
+    }
+    return std::make_unique<HybridCopyBalancer>(minSplitSize, DebugManager.flags.HybridBufferCopyBlitterPercentage.get());
+}
+
+size_t HybridCopyBalancer::getBlitterPortion(size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+    updateFromCompletedCopies();
+
+    // compute part is aligned, the blitter takes the remainder
+    auto computePortion = alignDown(static_cast<size_t>(size * (1.0 - blitterShare)), splitAlignment);
+    return size - std::min(computePortion, size);
+}
+
+void HybridCopyBalancer::trackCopy(Engine engine, size_t size, const TimestampPacketContainer &timestampPacketNodes) {
+    if (fixedShare || size == 0u || timestampPacketNodes.peekNodes().empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    if (trackedCopies.size() >= maxTrackedCopies) {
+        trackedCopies.erase(trackedCopies.begin());
+    }
+    auto nodes = std::make_unique<TimestampPacketContainer>();
+    nodes->assignAndIncrementNodesRefCounts(timestampPacketNodes);
+    trackedCopies.push_back({engine, size, std::move(nodes)});
+}
+
+double HybridCopyBalancer::getBlitterShare() {
+    std::lock_guard<std::mutex> lock(mtx);
+    updateFromCompletedCopies();
+    return blitterShare;
+}
+
+double HybridCopyBalancer::getThroughput(Engine engine) {
+    std::lock_guard<std::mutex> lock(mtx);
+    updateFromCompletedCopies();
+    return throughput[static_cast<uint32_t>(engine)];
+}
+
+void HybridCopyBalancer::updateFromCompletedCopies() {
+    bool updated = false;
+    for (auto it = trackedCopies.begin(); it != trackedCopies.end();) {
+        uint64_t duration = 0u;
+        if (!getDuration(*it->timestampPacketNodes, duration)) {
+            ++it;
+            continue;
+        }
+
+        // bytes per timestamp tick, both engines use the same global timestamp
+        auto measuredThroughput = static_cast<double>(it->size) / std::max(duration, static_cast<uint64_t>(1u));
+        auto &engineThroughput = throughput[static_cast<uint32_t>(it->engine)];
+        if (engineThroughput == 0.0) {
+            engineThroughput = measuredThroughput;
+        } else {
+            engineThroughput += throughputSmoothing * (measuredThroughput - engineThroughput);
+        }
+        updated = true;
+        it = trackedCopies.erase(it);
+    }
+
+    auto blitterThroughput = throughput[static_cast<uint32_t>(Engine::Blitter)];
+    auto computeThroughput = throughput[static_cast<uint32_t>(Engine::Compute)];
+    if (updated && blitterThroughput > 0.0 && computeThroughput > 0.0) {
+        // both engines should finish at the same time, keep each of them busy enough to be measured
+        blitterShare = blitterThroughput / (blitterThroughput + computeThroughput);
+        blitterShare = std::min(std::max(blitterShare, minEngineShare), 1.0 - minEngineShare);
+    }
+}
+
+bool HybridCopyBalancer::getDuration(const TimestampPacketContainer &timestampPacketNodes, uint64_t &duration) {
+    auto &nodes = timestampPacketNodes.peekNodes();
+    if (nodes.empty()) {
+        return false;
+    }
+
+    // global timestamps are 32-bit, measure relative to the first start to survive wrapping
+    auto referenceStart = nodes[0]->tagForCpuAccess->packets[0].globalStart;
+    int64_t start = 0;
+    int64_t end = 0;
+    for (auto node : nodes) {
+        auto tag = node->tagForCpuAccess;
+        if (!tag->isCompleted()) {
+            return false;
+        }
+        for (uint32_t i = 0; i < tag->packetsUsed; i++) {
+            start = std::min(start, static_cast<int64_t>(static_cast<int32_t>(tag->packets[i].globalStart - referenceStart)));
+            end = std::max(end, static_cast<int64_t>(static_cast<int32_t>(tag->packets[i].globalEnd - referenceStart)));
+        }
+    }
+    duration = static_cast<uint64_t>(end - start);
+    return true;
+}
+
+} // namespace NEO
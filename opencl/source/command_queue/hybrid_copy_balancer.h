@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/helpers/timestamp_packet.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+
+// Decides how a large buffer copy is divided between the blitter and a compute builtin.
+// Unless the share is fixed, it follows the throughput of both engines measured from the
+// timestamp packets of previous split copies.
+class HybridCopyBalancer : NonCopyableOrMovableClass {
+  public:
+    enum class Engine : uint32_t {
+        Blitter = 0,
+        Compute,
+        Count
+    };
+
+    static constexpr size_t defaultMinSplitSize = 64 * MemoryConstants::megaByte;
+    static constexpr size_t splitAlignment = MemoryConstants::cacheLineSize;
+    static constexpr double initialBlitterShare = 0.5;
+    static constexpr double minEngineShare = 0.1;
+    static constexpr double throughputSmoothing = 0.25;
+    static constexpr size_t maxTrackedCopies = 16u;
+
+    HybridCopyBalancer(size_t minSplitSize, int32_t fixedBlitterPercentage);
+
+    static std::unique_ptr<HybridCopyBalancer> create();
+
+    bool isSplitRequired(size_t size) const { return size >= minSplitSize; }
+    size_t getBlitterPortion(size_t size);
+    void trackCopy(Engine engine, size_t size, const TimestampPacketContainer &timestampPacketNodes);
+
+    double getBlitterShare();
+    double getThroughput(Engine engine);
+
+  protected:
+    struct TrackedCopy {
+        Engine engine;
+        size_t size;
+        std::unique_ptr<TimestampPacketContainer> timestampPacketNodes;
+    };
+
+    void updateFromCompletedCopies();
+    static bool getDuration(const TimestampPacketContainer &timestampPacketNodes, uint64_t &duration);
+
+    const size_t minSplitSize;
+    const bool fixedShare;
+    double blitterShare = initialBlitterShare;
+    double throughput[static_cast<uint32_t>(Engine::Count)] = {};
+    std::vector<TrackedCopy> trackedCopies;
+    std::mutex mtx;
+};
+
+} // namespace NEO
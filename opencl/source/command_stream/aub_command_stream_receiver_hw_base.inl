@@ -87,6 +87,7 @@ AUBCommandStreamReceiverHw<GfxFamily>::AUBCommandStreamReceiverHw(const std::str
 
 template <typename GfxFamily>
 AUBCommandStreamReceiverHw<GfxFamily>::~AUBCommandStreamReceiverHw() {
+    this->stopAdaptiveBatchingTimer();
     if (osContext) {
         pollForCompletion();
     }
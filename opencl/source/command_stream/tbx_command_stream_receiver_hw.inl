@@ -56,6 +56,7 @@ TbxCommandStreamReceiverHw<GfxFamily>::TbxCommandStreamReceiverHw(ExecutionEnvir
 
 template <typename GfxFamily>
 TbxCommandStreamReceiverHw<GfxFamily>::~TbxCommandStreamReceiverHw() {
+    this->stopAdaptiveBatchingTimer();
     if (streamInitialized) {
         tbxStream.close();
     }
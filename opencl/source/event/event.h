@@ -271,6 +271,10 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
         return this->taskCount;
     }
 
+    // Blitter work the event covers, which gpgpu task count does not wait for.
+    void setBcsTaskCount(uint32_t bcsTaskCount) { this->bcsTaskCount = bcsTaskCount; }
+    uint32_t peekBcsTaskCount() const { return bcsTaskCount; }
+
     void setQueueTimeStamp(TimeStampData *queueTimeStamp) {
         this->queueTimeStamp = *queueTimeStamp;
     };
@@ -371,6 +375,7 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     std::atomic<int> parentCount;
     //event parents
     std::vector<Event *> parentEvents;
+    uint32_t bcsTaskCount = 0;
 
   private:
     // can be accessed only with updateTaskCount
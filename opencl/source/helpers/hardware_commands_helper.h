@@ -87,6 +87,8 @@ struct HardwareCommandsHelper : public PerThreadDataHelper {
                                                    const void *srcKernelSsh, size_t srcKernelSshSize,
                                                    size_t numberOfBindingTableStates, size_t offsetOfBindingTable);
 
+    static size_t pushKernelBindingTableAndSurfaceStates(IndirectHeap &dstHeap, Kernel &kernel);
+
     static size_t sendIndirectState(
         LinearStream &commandStream,
         IndirectHeap &dsh,
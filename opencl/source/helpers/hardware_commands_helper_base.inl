@@ -100,19 +100,29 @@ size_t getSizeRequired(const MultiDispatchInfo &multiDispatchInfo, SizeGetterT &
 template <typename GfxFamily>
 size_t HardwareCommandsHelper<GfxFamily>::getTotalSizeRequiredDSH(
     const MultiDispatchInfo &multiDispatchInfo) {
-    return getSizeRequired(multiDispatchInfo, [](const DispatchInfo &dispatchInfo) { return getSizeRequiredDSH(*dispatchInfo.getKernel()); });
+    return getSizeRequired(multiDispatchInfo, [](const DispatchInfo &dispatchInfo) {
+        auto &kernel = *dispatchInfo.getKernel();
+        return kernel.getSizeEstimateCache().getDshSize([&kernel]() { return getSizeRequiredDSH(kernel); });
+    });
 }
 
 template <typename GfxFamily>
 size_t HardwareCommandsHelper<GfxFamily>::getTotalSizeRequiredIOH(
     const MultiDispatchInfo &multiDispatchInfo) {
-    return getSizeRequired(multiDispatchInfo, [](const DispatchInfo &dispatchInfo) { return getSizeRequiredIOH(*dispatchInfo.getKernel(), Math::computeTotalElementsCount(dispatchInfo.getLocalWorkgroupSize())); });
+    return getSizeRequired(multiDispatchInfo, [](const DispatchInfo &dispatchInfo) {
+        auto &kernel = *dispatchInfo.getKernel();
+        auto localWorkSize = Math::computeTotalElementsCount(dispatchInfo.getLocalWorkgroupSize());
+        return kernel.getSizeEstimateCache().getIohSize(localWorkSize, [&kernel, localWorkSize]() { return getSizeRequiredIOH(kernel, localWorkSize); });
+    });
 }
 
 template <typename GfxFamily>
 size_t HardwareCommandsHelper<GfxFamily>::getTotalSizeRequiredSSH(
     const MultiDispatchInfo &multiDispatchInfo) {
-    return getSizeRequired(multiDispatchInfo, [](const DispatchInfo &dispatchInfo) { return getSizeRequiredSSH(*dispatchInfo.getKernel()); });
+    return getSizeRequired(multiDispatchInfo, [](const DispatchInfo &dispatchInfo) {
+        auto &kernel = *dispatchInfo.getKernel();
+        return kernel.getSizeEstimateCache().getSshSize([&kernel]() { return getSizeRequiredSSH(kernel); });
+    });
 }
 
 template <typename GfxFamily>
@@ -252,6 +262,46 @@ size_t HardwareCommandsHelper<GfxFamily>::pushBindingTableAndSurfaceStates(Indir
     return ptrDiff(dstBtiTableBase, dstHeap.getCpuBase());
 }
 
+template <typename GfxFamily>
+size_t HardwareCommandsHelper<GfxFamily>::pushKernelBindingTableAndSurfaceStates(IndirectHeap &dstHeap, Kernel &kernel) {
+    const auto &patchInfo = kernel.getKernelInfo().patchInfo;
+    const size_t bindingTableCount = (patchInfo.bindingTableState != nullptr) ? patchInfo.bindingTableState->Count : 0;
+    const bool useCache = DebugManager.flags.EnableSurfaceStateHeapCache.get() == 1 && bindingTableCount != 0;
+
+    auto srcSsh = kernel.getSurfaceStateHeap();
+    auto srcSshSize = kernel.getSurfaceStateHeapSize();
+    auto offsetOfBindingTable = kernel.getBindingTableOffset();
+    auto numberOfBindingTableStates = kernel.getNumberOfBindingTableStates();
+
+    if (useCache) {
+        auto entry = kernel.getSurfaceStateHeapCache().find(dstHeap, srcSsh, srcSshSize, offsetOfBindingTable);
+        if (entry != nullptr) {
+            auto srcBindingTable = reinterpret_cast<const BINDING_TABLE_STATE *>(ptrOffset(srcSsh, offsetOfBindingTable));
+            auto dstBindingTable = reinterpret_cast<const BINDING_TABLE_STATE *>(ptrOffset(dstHeap.getCpuBase(), entry->bindingTableOffset));
+            bool bindingTableMatches = true;
+            for (size_t i = 0; i < numberOfBindingTableStates && bindingTableMatches; i++) {
+                bindingTableMatches = dstBindingTable[i].getSurfaceStatePointer() ==
+                                      srcBindingTable[i].getSurfaceStatePointer() + static_cast<uint32_t>(entry->surfaceStatesOffset);
+            }
+            if (bindingTableMatches) {
+                kernel.patchBindlessSurfaceStateOffsets(entry->surfaceStatesOffset);
+                return entry->bindingTableOffset;
+            }
+        }
+    }
+
+    dstHeap.align(BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE);
+    auto surfaceStatesOffset = dstHeap.getUsed();
+    kernel.patchBindlessSurfaceStateOffsets(surfaceStatesOffset);
+
+    auto dstBindingTablePointer = pushBindingTableAndSurfaceStates(dstHeap, bindingTableCount, srcSsh, srcSshSize,
+                                                                   numberOfBindingTableStates, offsetOfBindingTable);
+    if (useCache) {
+        kernel.getSurfaceStateHeapCache().add(dstHeap, surfaceStatesOffset, dstBindingTablePointer, srcSshSize);
+    }
+    return dstBindingTablePointer;
+}
+
 template <typename GfxFamily>
 size_t HardwareCommandsHelper<GfxFamily>::sendIndirectState(
     LinearStream &commandStream,
@@ -278,12 +328,7 @@ size_t HardwareCommandsHelper<GfxFamily>::sendIndirectState(
     const auto &kernelInfo = kernel.getKernelInfo();
     const auto &patchInfo = kernelInfo.patchInfo;
 
-    ssh.align(BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE);
-    kernel.patchBindlessSurfaceStateOffsets(ssh.getUsed());
-
-    auto dstBindingTablePointer = pushBindingTableAndSurfaceStates(ssh, (kernelInfo.patchInfo.bindingTableState != nullptr) ? kernelInfo.patchInfo.bindingTableState->Count : 0,
-                                                                   kernel.getSurfaceStateHeap(), kernel.getSurfaceStateHeapSize(),
-                                                                   kernel.getNumberOfBindingTableStates(), kernel.getBindingTableOffset());
+    auto dstBindingTablePointer = pushKernelBindingTableAndSurfaceStates(ssh, kernel);
 
     // Copy our sampler state if it exists
     uint32_t samplerStateOffset = 0;
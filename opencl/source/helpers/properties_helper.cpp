@@ -17,7 +17,34 @@
 
 namespace NEO {
 
+namespace {
+// Enqueue on in order queue waits for nodes of the previous one, so its nodes complete only after nodes of all
+// previous enqueues of the queue and waiting for the latest event of the queue in the wait list is enough.
+bool isImpliedByLaterEvent(Event &event, const cl_event *eventWaitList, cl_uint numEventsInWaitList) {
+    auto commandQueue = event.getCommandQueue();
+    auto taskCount = event.peekTaskCount();
+    if (commandQueue == nullptr || commandQueue->queueDependenciesClearRequired() || taskCount == CompletionStamp::notReady) {
+        return false;
+    }
+
+    for (cl_uint i = 0; i < numEventsInWaitList; i++) {
+        auto otherEvent = castToObjectOrAbort<Event>(eventWaitList[i]);
+        if (otherEvent == &event || otherEvent->isUserEvent() || otherEvent->getCommandQueue() != commandQueue) {
+            continue;
+        }
+        auto otherTaskCount = otherEvent->peekTaskCount();
+        auto otherTimestampPacketContainer = otherEvent->getTimestampPacketNodes();
+        if (otherTaskCount != CompletionStamp::notReady && otherTaskCount > taskCount &&
+            otherTimestampPacketContainer && !otherTimestampPacketContainer->peekNodes().empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace
+
 void EventsRequest::fillCsrDependencies(CsrDependencies &csrDeps, CommandStreamReceiver &currentCsr, CsrDependencies::DependenciesType depsType) const {
+    auto pruneDependencies = TimestampPacketHelper::isDependencyPruningEnabled();
     for (cl_uint i = 0; i < this->numEventsInWaitList; i++) {
         auto event = castToObjectOrAbort<Event>(this->eventWaitList[i]);
         if (event->isUserEvent()) {
@@ -34,6 +61,10 @@ void EventsRequest::fillCsrDependencies(CsrDependencies &csrDeps, CommandStreamR
                               (CsrDependencies::DependenciesType::OutOfCsr == depsType && !sameCsr) ||
                               (CsrDependencies::DependenciesType::All == depsType);
 
+        if (pushDependency && pruneDependencies && isImpliedByLaterEvent(*event, this->eventWaitList, this->numEventsInWaitList)) {
+            continue;
+        }
+
         if (pushDependency) {
             csrDeps.push_back(timestampPacketContainer);
         }
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/helpers/size_estimate_cache.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+namespace NEO {
+
+constexpr size_t SizeEstimateCache::iohSlotCount;
+
+bool SizeEstimateCache::isEnabled() {
+    return DebugManager.flags.EnableSizeEstimateCache.get() >= 1;
+}
+
+bool SizeEstimateCache::isVerificationEnabled() {
+    return DebugManager.flags.EnableSizeEstimateCache.get() == 2;
+}
+
+void SizeEstimateCache::invalidate() {
+    dshSize.store(0u, std::memory_order_relaxed);
+    sshSize.store(0u, std::memory_order_relaxed);
+    for (auto &iohSize : iohSizes) {
+        iohSize.store(0u, std::memory_order_relaxed);
+    }
+    kernelCommandsSize.store(0u, std::memory_order_relaxed);
+}
+
+} // namespace NEO
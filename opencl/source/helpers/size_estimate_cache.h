@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace NEO {
+
+// Memoises size estimates of a kernel that depend only on kernel state and dispatch shape, so enqueues do not
+// recompute them. Estimates depending on kernel arguments or enqueue parameters are not cached.
+// Every slot packs its key in upper and estimate + 1 in lower half, so concurrent enqueues read a consistent pair.
+class SizeEstimateCache {
+  public:
+    static constexpr size_t iohSlotCount = 4u;
+
+    static bool isEnabled();
+    // Cached estimates are compared with fresh ones, mismatch means missing invalidation.
+    static bool isVerificationEnabled();
+
+    template <typename EstimateT>
+    size_t getDshSize(EstimateT &&estimate) { return get(dshSize, 0u, estimate); }
+
+    template <typename EstimateT>
+    size_t getSshSize(EstimateT &&estimate) { return get(sshSize, 0u, estimate); }
+
+    template <typename EstimateT>
+    size_t getIohSize(size_t localWorkSize, EstimateT &&estimate) {
+        if (localWorkSize > std::numeric_limits<uint32_t>::max()) {
+            return estimate();
+        }
+        return get(iohSizes[localWorkSize % iohSlotCount], static_cast<uint32_t>(localWorkSize), estimate);
+    }
+
+    // Walker and commands programmed around it for every dispatch of the kernel.
+    template <typename EstimateT>
+    size_t getKernelCommandsSize(EstimateT &&estimate) { return get(kernelCommandsSize, 0u, estimate); }
+
+    void invalidate();
+
+    uint64_t getHitCount() const { return hitCount.load(std::memory_order_relaxed); }
+    uint64_t getMissCount() const { return missCount.load(std::memory_order_relaxed); }
+
+  protected:
+    using Slot = std::atomic<uint64_t>;
+
+    template <typename EstimateT>
+    size_t get(Slot &slot, uint32_t key, EstimateT &estimate) {
+        if (!isEnabled()) {
+            return estimate();
+        }
+
+        auto value = slot.load(std::memory_order_relaxed);
+        if (value != 0u && static_cast<uint32_t>(value >> 32) == key) {
+            size_t size = static_cast<uint32_t>(value) - 1u;
+            hitCount.fetch_add(1u, std::memory_order_relaxed);
+            if (isVerificationEnabled()) {
+                UNRECOVERABLE_IF(size != estimate());
+            }
+            return size;
+        }
+
+        missCount.fetch_add(1u, std::memory_order_relaxed);
+        size_t size = estimate();
+        if (size < std::numeric_limits<uint32_t>::max()) {
+            slot.store((static_cast<uint64_t>(key) << 32) | static_cast<uint64_t>(size + 1u), std::memory_order_relaxed);
+        }
+        return size;
+    }
+
+    Slot dshSize{0u};
+    Slot sshSize{0u};
+    std::array<Slot, iohSlotCount> iohSizes{};
+    Slot kernelCommandsSize{0u};
+    std::atomic<uint64_t> hitCount{0u};
+    std::atomic<uint64_t> missCount{0u};
+};
+} // namespace NEO
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/helpers/surface_state_heap_cache.h"
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/indirect_heap/indirect_heap.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NEO {
+
+constexpr size_t SurfaceStateHeapCache::maxEntries;
+
+const SurfaceStateHeapCache::Entry *SurfaceStateHeapCache::find(const IndirectHeap &heap, const void *srcSsh, size_t srcSshSize, size_t offsetOfBindingTable) {
+    for (size_t i = 0; i < entryCount; i++) {
+        const auto &entry = entries[i];
+        // Anything below the used size of the current heap generation is not overwritten until the heap is replaced.
+        if (entry.heap != &heap || entry.heapGeneration != heap.getGeneration() || entry.sshSize != srcSshSize ||
+            entry.surfaceStatesOffset + entry.sshSize > heap.getUsed() ||
+            entry.bindingTableOffset != entry.surfaceStatesOffset + offsetOfBindingTable) {
+            continue;
+        }
+        if (memcmp(ptrOffset(heap.getCpuBase(), entry.surfaceStatesOffset), srcSsh, offsetOfBindingTable) != 0) {
+            continue;
+        }
+        // Most recently used entry goes first, dispatches in a loop hit it on the first compare.
+        std::rotate(entries.begin(), entries.begin() + i, entries.begin() + i + 1);
+        hitCount++;
+        reusedHeapSize += entries[0].sshSize;
+        return &entries[0];
+    }
+    return nullptr;
+}
+
+void SurfaceStateHeapCache::add(const IndirectHeap &heap, size_t surfaceStatesOffset, size_t bindingTableOffset, size_t sshSize) {
+    entryCount = std::min(entryCount + 1, maxEntries);
+    std::rotate(entries.begin(), entries.begin() + entryCount - 1, entries.begin() + entryCount);
+
+    auto &entry = entries[0];
+    entry.heap = &heap;
+    entry.heapGeneration = heap.getGeneration();
+    entry.surfaceStatesOffset = surfaceStatesOffset;
+    entry.bindingTableOffset = bindingTableOffset;
+    entry.sshSize = sshSize;
+}
+
+} // namespace NEO
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+class IndirectHeap;
+
+// Remembers where surface states and binding table of a kernel were pushed to surface state heaps.
+// A block is reused for a later dispatch when the heap still holds exactly the surface states
+// the kernel would push now, so unchanged arguments do not consume new heap space.
+class SurfaceStateHeapCache {
+  public:
+    static constexpr size_t maxEntries = 4u;
+
+    struct Entry {
+        const IndirectHeap *heap = nullptr;
+        uint32_t heapGeneration = 0u;
+        size_t surfaceStatesOffset = 0u;
+        size_t bindingTableOffset = 0u;
+        size_t sshSize = 0u;
+    };
+
+    // Returns block holding the same surface states as srcSsh, binding table has to be verified by the caller.
+    const Entry *find(const IndirectHeap &heap, const void *srcSsh, size_t srcSshSize, size_t offsetOfBindingTable);
+    void add(const IndirectHeap &heap, size_t surfaceStatesOffset, size_t bindingTableOffset, size_t sshSize);
+    void clear() { entryCount = 0u; }
+
+    size_t getEntryCount() const { return entryCount; }
+    uint64_t getHitCount() const { return hitCount; }
+    uint64_t getReusedHeapSize() const { return reusedHeapSize; }
+
+  protected:
+    std::array<Entry, maxEntries> entries;
+    size_t entryCount = 0u;
+    uint64_t hitCount = 0u;
+    uint64_t reusedHeapSize = 0u;
+};
+} // namespace NEO
@@ -808,6 +808,8 @@ void Kernel::resizeSurfaceStateHeap(void *pNewSsh, size_t newSshSize, size_t new
     sshLocalSize = static_cast<uint32_t>(newSshSize);
     numberOfBindingTableStates = newBindingTableCount;
     localBindingTableOffset = newBindingTableOffset;
+    surfaceStateHeapCache.clear();
+    sizeEstimateCache.invalidate();
 }
 
 uint32_t Kernel::getScratchSizeValueToProgramMediaVfeState(int scratchSize) {
@@ -20,6 +20,8 @@
 #include "opencl/source/device_queue/device_queue.h"
 #include "opencl/source/helpers/base_object.h"
 #include "opencl/source/helpers/properties_helper.h"
+#include "opencl/source/helpers/size_estimate_cache.h"
+#include "opencl/source/helpers/surface_state_heap_cache.h"
 #include "opencl/source/kernel/kernel_execution_type.h"
 #include "opencl/source/program/kernel_info.h"
 #include "opencl/source/program/program.h"
@@ -163,6 +165,8 @@ class Kernel : public BaseObject<_cl_kernel> {
     }
 
     void resizeSurfaceStateHeap(void *pNewSsh, size_t newSshSize, size_t newBindingTableCount, size_t newBindingTableOffset);
+    SurfaceStateHeapCache &getSurfaceStateHeapCache() { return surfaceStateHeapCache; }
+    SizeEstimateCache &getSizeEstimateCache() const { return sizeEstimateCache; }
 
     void substituteKernelHeap(void *newKernelHeap, size_t newKernelHeapSize);
     bool isKernelHeapSubstituted() const;
@@ -521,6 +525,8 @@ class Kernel : public BaseObject<_cl_kernel> {
     size_t localBindingTableOffset;
     std::unique_ptr<char[]> pSshLocal;
     uint32_t sshLocalSize;
+    SurfaceStateHeapCache surfaceStateHeapCache;
+    mutable SizeEstimateCache sizeEstimateCache;
 
     char *crossThreadData;
     uint32_t crossThreadDataSize;
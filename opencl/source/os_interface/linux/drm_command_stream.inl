@@ -22,6 +22,7 @@
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/linux/os_interface.h"
+#include "shared/source/utilities/enqueue_phase_profiler.h"
 
 #include "opencl/source/os_interface/linux/drm_command_stream.h"
 
@@ -50,6 +51,11 @@ DrmCommandStreamReceiver<GfxFamily>::DrmCommandStreamReceiver(ExecutionEnvironme
     }
 }
 
+template <typename GfxFamily>
+DrmCommandStreamReceiver<GfxFamily>::~DrmCommandStreamReceiver() {
+    this->stopAdaptiveBatchingTimer();
+}
+
 template <typename GfxFamily>
 bool DrmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) {
     this->printDeviceIndex();
@@ -133,6 +139,7 @@ void DrmCommandStreamReceiver<GfxFamily>::makeResident(BufferObject *bo) {
 
 template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::processResidency(const ResidencyContainer &inputAllocationsForResidency, uint32_t handleId) {
+    ENQUEUE_PHASE(Residency);
     for (auto &alloc : inputAllocationsForResidency) {
         auto drmAlloc = static_cast<const DrmAllocation *>(alloc);
         if (drmAlloc->fragmentsStorage.fragmentCount) {
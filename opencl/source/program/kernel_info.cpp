@@ -11,6 +11,7 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/program/print_formatter.h"
 
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/helpers/dispatch_info.h"
@@ -175,6 +176,7 @@ KernelInfo::~KernelInfo() {
     kernelArgInfo.clear();
 
     patchInfo.stringDataMap.clear();
+    patchInfo.printfFormatPrograms.clear();
     delete[] crossThreadData;
 }
 
@@ -351,7 +353,8 @@ void KernelInfo::storePatchToken(const SPatchString *pStringArg) {
     uint32_t stringIndex = pStringArg->Index;
     if (pStringArg->StringSize > 0) {
         const char *stringData = reinterpret_cast<const char *>(pStringArg + 1);
-        patchInfo.stringDataMap.emplace(stringIndex, std::string(stringData, stringData + pStringArg->StringSize));
+        auto printfString = patchInfo.stringDataMap.emplace(stringIndex, std::string(stringData, stringData + pStringArg->StringSize)).first;
+        patchInfo.printfFormatPrograms[stringIndex] = PrintFormatter::compileFormatString(printfString->second.c_str());
     }
 }
 
@@ -6,6 +6,8 @@
  */
 
 #pragma once
+#include "shared/source/program/printf_format_program.h"
+
 #include "patch_g7.h"
 #include "patch_list.h"
 
@@ -73,6 +75,7 @@ struct PatchInfo {
     const SPatchAllocateStatelessDefaultDeviceQueueSurface *pAllocateStatelessDefaultDeviceQueueSurface = nullptr;
     const SPatchAllocateSystemThreadSurface *pAllocateSystemThreadSurface = nullptr;
     ::std::unordered_map<uint32_t, std::string> stringDataMap;
+    PrintfFormatProgramMap printfFormatPrograms;
 };
 
 } // namespace NEO
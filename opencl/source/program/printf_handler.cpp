@@ -65,7 +65,8 @@ void PrintfHandler::makeResident(CommandStreamReceiver &commandStreamReceiver) {
 
 void PrintfHandler::printEnqueueOutput() {
     PrintFormatter printFormatter(reinterpret_cast<const uint8_t *>(printfSurface->getUnderlyingBuffer()), static_cast<uint32_t>(printfSurface->getUnderlyingBufferSize()),
-                                  kernel->is32Bit(), kernel->getKernelInfo().patchInfo.stringDataMap);
+                                  kernel->is32Bit(), kernel->getKernelInfo().patchInfo.stringDataMap,
+                                  &kernel->getKernelInfo().patchInfo.printfFormatPrograms);
     printFormatter.printKernelOutput();
 }
 } // namespace NEO
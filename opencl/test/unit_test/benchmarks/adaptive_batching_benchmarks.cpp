@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/adaptive_batching_controller.h"
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/test/unit_test/helpers/benchmark_runner.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+#include "shared/test/unit_test/helpers/memory_management.h"
+
+#include "opencl/source/api/api.h"
+#include "opencl/source/command_queue/command_queue.h"
+#include "opencl/test/unit_test/mocks/mock_context.h"
+#include "opencl/test/unit_test/mocks/mock_kernel.h"
+#include "test.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace NEO;
+
+// Throughput versus latency of dispatch modes. Throughput is host cost of an enqueue, latency is time from enqueue
+// until its command buffer is submitted. Batched dispatch without adaptive batching submits only on explicit flush,
+// so its latency is unbounded and not measured.
+struct AdaptiveBatchingBenchmark : public ::testing::Test {
+    struct Variant {
+        const char *name;
+        DispatchMode dispatchMode;
+        int32_t maxCommandBuffers;
+        int32_t deadlineUs;
+    };
+
+    void SetUp() override {
+        // Benchmark results outlive the test.
+        MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+    }
+
+    // Dispatch mode and adaptive batching are chosen when command stream receiver is created.
+    void createContext(const Variant &variant) {
+        DebugManager.flags.CsrDispatchMode.set(static_cast<int32_t>(variant.dispatchMode));
+        DebugManager.flags.CsrAdaptiveBatchingMaxCommandBuffers.set(variant.maxCommandBuffers);
+        DebugManager.flags.CsrAdaptiveBatchingDeadlineUs.set(variant.deadlineUs);
+
+        context = std::make_unique<MockContext>();
+        auto device = context->getDevice(0);
+        kernel = std::make_unique<MockKernelWithInternals>(*device, context.get(), true);
+        cl_int retVal = CL_SUCCESS;
+        buffer = clCreateBuffer(context.get(), CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, &retVal);
+        ASSERT_EQ(CL_SUCCESS, retVal);
+        for (cl_uint argIndex = 0; argIndex < 2; argIndex++) {
+            ASSERT_EQ(CL_SUCCESS, clSetKernelArg(kernel->mockKernel, argIndex, sizeof(cl_mem), &buffer));
+        }
+        queue = clCreateCommandQueueWithProperties(context.get(), device, nullptr, &retVal);
+        ASSERT_EQ(CL_SUCCESS, retVal);
+        csr = &castToObject<CommandQueue>(queue)->getGpgpuCommandStreamReceiver();
+    }
+
+    void releaseContext() {
+        clFinish(queue);
+        clReleaseCommandQueue(queue);
+        clReleaseMemObject(buffer);
+        kernel.reset();
+        context.reset();
+        csr = nullptr;
+    }
+
+    void enqueue() {
+        const size_t globalWorkSize[3] = {64, 1, 1};
+        failures += (clEnqueueNDRangeKernel(queue, kernel->mockKernel, 1, nullptr, globalWorkSize, nullptr, 0, nullptr, nullptr) != CL_SUCCESS);
+    }
+
+    void waitForSubmission() {
+        while (csr->peekLatestFlushedTaskCount() < csr->peekTaskCount()) {
+            std::this_thread::yield();
+        }
+    }
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<MockContext> context;
+    std::unique_ptr<MockKernelWithInternals> kernel;
+    cl_mem buffer = nullptr;
+    cl_command_queue queue = nullptr;
+    CommandStreamReceiver *csr = nullptr;
+    std::atomic<uint32_t> failures{0u};
+};
+
+TEST_F(AdaptiveBatchingBenchmark, DISABLED_clEnqueueNDRangeKernelThroughputAndLatencyPerDispatchMode) {
+    const Variant variants[] = {
+        {"immediate", DispatchMode::ImmediateDispatch, -1, -1},
+        {"batched", DispatchMode::BatchedDispatch, -1, -1},
+        {"batched, 16 command buffers", DispatchMode::BatchedDispatch, 16, -1},
+        {"batched, 100us deadline", DispatchMode::BatchedDispatch, -1, 100},
+        {"batched, 16 command buffers or 100us deadline", DispatchMode::BatchedDispatch, 16, 100}};
+
+    for (auto &variant : variants) {
+        createContext(variant);
+        BenchmarkRunner::run(std::string("clEnqueueNDRangeKernel(") + variant.name + ")", 1u, [&](uint32_t thread, uint32_t iteration) {
+            enqueue();
+        });
+        if (variant.dispatchMode == DispatchMode::ImmediateDispatch || variant.deadlineUs > 0) {
+            BenchmarkRunner::run(std::string("clEnqueueNDRangeKernel+submission(") + variant.name + ")", 1u, [&](uint32_t thread, uint32_t iteration) {
+                enqueue();
+                waitForSubmission();
+            });
+        }
+
+        // achieved batch sizes are printed with PrintDebugMessages when command stream receiver is destroyed
+        auto adaptiveBatchingController = csr->getAdaptiveBatchingController();
+        if (adaptiveBatchingController) {
+            auto statistics = adaptiveBatchingController->getStatistics();
+            EXPECT_LT(statistics.batchesFlushed, statistics.commandBuffersFlushed);
+        }
+        releaseContext();
+    }
+    EXPECT_EQ(0u, failures.load());
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/helpers/blit_commands_helper.h"
+#include "shared/test/unit_test/helpers/benchmark_runner.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+#include "shared/test/unit_test/helpers/default_hw_info.h"
+#include "shared/test/unit_test/helpers/memory_management.h"
+#include "shared/test/unit_test/mocks/mock_device.h"
+
+#include "test.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+// Host cost, blit command count and command stream size of buffer copies of common shapes, with and without blitter copy planner.
+// Addresses are not backed by memory, only commands are programmed.
+struct BlitPlannerBenchmark : public ::testing::Test {
+    struct CopyShape {
+        const char *name;
+        uint64_t srcGpuAddress;
+        uint64_t dstGpuAddress;
+        Vec3<size_t> copySize;
+        size_t rowPitch;
+        size_t slicePitch;
+    };
+
+    void SetUp() override {
+        // Benchmark results outlive the test.
+        MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+        device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    }
+
+    template <typename FamilyType>
+    void runForAllShapes(const std::string &variant) {
+        const CopyShape copyShapes[] = {
+            {"1MB", 0x100000, 0x400000, {MemoryConstants::megaByte, 1, 1}, 0, 0},
+            {"1MB unaligned", 0x100001, 0x400003, {MemoryConstants::megaByte, 1, 1}, 0, 0},
+            {"64MB", 0x100000, 0x8000000, {64 * MemoryConstants::megaByte, 1, 1}, 0, 0},
+            {"256x256 rect, 4KB row pitch", 0x100000, 0x400000, {256, 256, 1}, MemoryConstants::pageSize, 0},
+            {"64x64x16 region, 1KB row pitch, 64KB slice pitch", 0x100000, 0x400000, {64, 64, 16}, 1024, MemoryConstants::pageSize64k}};
+
+        for (auto &copyShape : copyShapes) {
+            BlitProperties properties = {};
+            properties.srcGpuAddress = copyShape.srcGpuAddress;
+            properties.dstGpuAddress = copyShape.dstGpuAddress;
+            properties.copySize = copyShape.copySize;
+            properties.srcRowPitch = properties.dstRowPitch = copyShape.rowPitch ? copyShape.rowPitch : copyShape.copySize.x;
+            properties.srcSlicePitch = properties.dstSlicePitch = copyShape.slicePitch ? copyShape.slicePitch : properties.srcRowPitch * copyShape.copySize.y;
+
+            auto numberOfBlits = BlitCommandsHelper<FamilyType>::getNumberOfBlitCommandsForBuffer(properties);
+            std::vector<uint8_t> streamBuffer(numberOfBlits * (sizeof(typename FamilyType::XY_COPY_BLT) + BlitCommandsHelper<FamilyType>::estimatePostBlitCommandSize()));
+            size_t commandStreamSize = 0u;
+            BenchmarkRunner::run("dispatchBlitCommandsForBuffer(" + std::string(copyShape.name) + variant, 1u, [&](uint32_t thread, uint32_t iteration) {
+                LinearStream stream(streamBuffer.data(), streamBuffer.size());
+                BlitCommandsHelper<FamilyType>::dispatchBlitCommandsForBuffer(properties, stream, device->getRootDeviceEnvironment());
+                commandStreamSize = stream.getUsed();
+            },
+                                 100u);
+            BenchmarkResults::getInstance().addMetric("blits", static_cast<double>(numberOfBlits));
+            BenchmarkResults::getInstance().addMetric("command_stream_bytes", static_cast<double>(commandStreamSize));
+            EXPECT_EQ(streamBuffer.size(), commandStreamSize);
+        }
+    }
+
+    std::unique_ptr<MockDevice> device;
+};
+
+HWTEST_F(BlitPlannerBenchmark, DISABLED_dispatchBlitCommandsForBufferWithAndWithoutCopyPlanner) {
+    DebugManagerStateRestore restorer;
+    for (auto copyPlanner : {0, 1}) {
+        DebugManager.flags.EnableBlitterCopyPlanner.set(copyPlanner);
+        runForAllShapes<FamilyType>(copyPlanner ? ", copy planner)" : ")");
+    }
+}
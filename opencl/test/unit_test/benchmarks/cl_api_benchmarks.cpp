@@ -0,0 +1,261 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/unit_test/helpers/benchmark_runner.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+#include "shared/test/unit_test/helpers/memory_management.h"
+
+#include "opencl/source/api/api.h"
+#include "opencl/test/unit_test/mocks/mock_context.h"
+#include "opencl/test/unit_test/mocks/mock_kernel.h"
+#include "test.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+::testing::Environment *const benchmarkEnvironment = ::testing::AddGlobalTestEnvironment(new BenchmarkEnvironment);
+} // namespace
+
+// Host side cost of OpenCL API calls on the ULT device, command stream receivers submit nothing.
+// Benchmarks are disabled in regular runs, run_<product>_benchmarks targets enable them and collect json results.
+struct ClApiBenchmark : public ::testing::Test {
+    void SetUp() override {
+        // Benchmark results outlive the test.
+        MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+
+        context = std::make_unique<MockContext>();
+        device = context->getDevice(0);
+
+        // Every thread works on its own queue and kernel, as multithreaded applications do.
+        auto threadCounts = BenchmarkRunner::getThreadCounts();
+        auto maxThreadCount = *std::max_element(threadCounts.begin(), threadCounts.end());
+        for (uint32_t thread = 0; thread < maxThreadCount; thread++) {
+            cl_int retVal = CL_SUCCESS;
+            queues.push_back(clCreateCommandQueueWithProperties(context.get(), device, nullptr, &retVal));
+            ASSERT_EQ(CL_SUCCESS, retVal);
+            buffers.push_back(clCreateBuffer(context.get(), CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, &retVal));
+            ASSERT_EQ(CL_SUCCESS, retVal);
+            kernels.push_back(std::make_unique<MockKernelWithInternals>(*device, context.get(), true));
+            for (cl_uint argIndex = 0; argIndex < 2; argIndex++) {
+                ASSERT_EQ(CL_SUCCESS, clSetKernelArg(kernels[thread]->mockKernel, argIndex, sizeof(cl_mem), &buffers[thread]));
+            }
+        }
+    }
+
+    void TearDown() override {
+        for (auto queue : queues) {
+            clFinish(queue);
+            clReleaseCommandQueue(queue);
+        }
+        kernels.clear();
+        for (auto buffer : buffers) {
+            clReleaseMemObject(buffer);
+        }
+    }
+
+    void runForAllThreadCounts(const std::string &name, const BenchmarkRunner::Operation &operation) {
+        for (auto threadCount : BenchmarkRunner::getThreadCounts()) {
+            BenchmarkRunner::run(name, threadCount, operation);
+        }
+        EXPECT_EQ(0u, failures.load());
+    }
+
+    std::unique_ptr<MockContext> context;
+    ClDevice *device = nullptr;
+    std::vector<cl_command_queue> queues;
+    std::vector<cl_mem> buffers;
+    std::vector<std::unique_ptr<MockKernelWithInternals>> kernels;
+    std::atomic<uint32_t> failures{0u};
+};
+
+TEST_F(ClApiBenchmark, DISABLED_clEnqueueNDRangeKernel) {
+    const size_t globalWorkSize[3] = {64, 1, 1};
+    runForAllThreadCounts("clEnqueueNDRangeKernel", [&](uint32_t thread, uint32_t iteration) {
+        auto retVal = clEnqueueNDRangeKernel(queues[thread], kernels[thread]->mockKernel, 1, nullptr, globalWorkSize, nullptr, 0, nullptr, nullptr);
+        failures += (retVal != CL_SUCCESS);
+    });
+}
+
+TEST_F(ClApiBenchmark, DISABLED_clEnqueueNDRangeKernelWithAndWithoutSizeEstimateCache) {
+    const size_t globalWorkSize[3] = {64, 1, 1};
+    DebugManagerStateRestore restorer;
+    for (auto sizeEstimateCache : {0, 1}) {
+        DebugManager.flags.EnableSizeEstimateCache.set(sizeEstimateCache);
+        std::string variant = sizeEstimateCache ? "(size estimate cache)" : "";
+        runForAllThreadCounts("clEnqueueNDRangeKernel" + variant, [&](uint32_t thread, uint32_t iteration) {
+            auto retVal = clEnqueueNDRangeKernel(queues[thread], kernels[thread]->mockKernel, 1, nullptr, globalWorkSize, nullptr, 0, nullptr, nullptr);
+            failures += (retVal != CL_SUCCESS);
+        });
+    }
+}
+
+HWTEST_F(ClApiBenchmark, DISABLED_clEnqueueNDRangeKernelWithAndWithoutSurfaceStateHeapCache) {
+    using BINDING_TABLE_STATE = typename FamilyType::BINDING_TABLE_STATE;
+    using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+
+    // Buffer arguments are accessed through binding table, as in kernels built by the compiler.
+    constexpr uint32_t surfaceCount = 2u;
+    const size_t bindingTableOffset = surfaceCount * sizeof(RENDER_SURFACE_STATE);
+    const size_t sshSize = bindingTableOffset + surfaceCount * sizeof(BINDING_TABLE_STATE);
+    SPatchBindingTableState bindingTableState = {};
+    bindingTableState.Count = surfaceCount;
+    bindingTableState.Offset = static_cast<uint32_t>(bindingTableOffset);
+    for (uint32_t thread = 0; thread < kernels.size(); thread++) {
+        auto &kernel = *kernels[thread];
+        kernel.kernelInfo.patchInfo.bindingTableState = &bindingTableState;
+        kernel.kernelInfo.usesSsh = true;
+        kernel.kernelInfo.requiresSshForBuffers = true;
+        auto ssh = new char[sshSize]{};
+        auto bindingTable = reinterpret_cast<BINDING_TABLE_STATE *>(ptrOffset(ssh, bindingTableOffset));
+        for (uint32_t argIndex = 0; argIndex < surfaceCount; argIndex++) {
+            kernel.kernelInfo.kernelArgInfo[argIndex].offsetHeap = static_cast<uint32_t>(argIndex * sizeof(RENDER_SURFACE_STATE));
+            bindingTable[argIndex] = FamilyType::cmdInitBindingTableState;
+            bindingTable[argIndex].setSurfaceStatePointer(static_cast<uint32_t>(argIndex * sizeof(RENDER_SURFACE_STATE)));
+        }
+        kernel.mockKernel->resizeSurfaceStateHeap(ssh, sshSize, surfaceCount, bindingTableOffset);
+        for (cl_uint argIndex = 0; argIndex < surfaceCount; argIndex++) {
+            ASSERT_EQ(CL_SUCCESS, clSetKernelArg(kernel.mockKernel, argIndex, sizeof(cl_mem), &buffers[thread]));
+        }
+    }
+
+    const size_t globalWorkSize[3] = {64, 1, 1};
+    DebugManagerStateRestore restorer;
+    for (auto surfaceStateHeapCache : {0, 1}) {
+        DebugManager.flags.EnableSurfaceStateHeapCache.set(surfaceStateHeapCache);
+        std::string variant = surfaceStateHeapCache ? "(surface state heap cache)" : "";
+        runForAllThreadCounts("clEnqueueNDRangeKernel" + variant, [&](uint32_t thread, uint32_t iteration) {
+            auto retVal = clEnqueueNDRangeKernel(queues[thread], kernels[thread]->mockKernel, 1, nullptr, globalWorkSize, nullptr, 0, nullptr, nullptr);
+            failures += (retVal != CL_SUCCESS);
+        });
+    }
+    // arguments do not change between enqueues, so every enqueue but the first one on a heap reuses surface states
+    EXPECT_NE(0u, kernels[0]->mockKernel->getSurfaceStateHeapCache().getHitCount());
+}
+
+TEST_F(ClApiBenchmark, DISABLED_clSetKernelArg) {
+    runForAllThreadCounts("clSetKernelArg", [&](uint32_t thread, uint32_t iteration) {
+        auto retVal = clSetKernelArg(kernels[thread]->mockKernel, iteration % 2, sizeof(cl_mem), &buffers[thread]);
+        failures += (retVal != CL_SUCCESS);
+    });
+}
+
+TEST_F(ClApiBenchmark, DISABLED_clCreateUserEventAndRelease) {
+    runForAllThreadCounts("clCreateUserEvent+clReleaseEvent", [&](uint32_t thread, uint32_t iteration) {
+        cl_int retVal = CL_SUCCESS;
+        auto event = clCreateUserEvent(context.get(), &retVal);
+        failures += (retVal != CL_SUCCESS);
+        failures += (clReleaseEvent(event) != CL_SUCCESS);
+    });
+}
+
+TEST_F(ClApiBenchmark, DISABLED_clEnqueueMarkerEventAndRelease) {
+    runForAllThreadCounts("clEnqueueMarkerWithWaitList+clReleaseEvent", [&](uint32_t thread, uint32_t iteration) {
+        cl_event event = nullptr;
+        failures += (clEnqueueMarkerWithWaitList(queues[thread], 0, nullptr, &event) != CL_SUCCESS);
+        failures += (clReleaseEvent(event) != CL_SUCCESS);
+    });
+}
+
+TEST_F(ClApiBenchmark, DISABLED_clHostMemAllocAndFree) {
+    runForAllThreadCounts("clHostMemAllocINTEL+clMemFreeINTEL", [&](uint32_t thread, uint32_t iteration) {
+        cl_int retVal = CL_SUCCESS;
+        auto ptr = clHostMemAllocINTEL(context.get(), nullptr, MemoryConstants::pageSize, 0, &retVal);
+        failures += (retVal != CL_SUCCESS);
+        failures += (clMemFreeINTEL(context.get(), ptr) != CL_SUCCESS);
+    });
+}
+
+TEST_F(ClApiBenchmark, DISABLED_clDeviceMemAllocAndFree) {
+    runForAllThreadCounts("clDeviceMemAllocINTEL+clMemFreeINTEL", [&](uint32_t thread, uint32_t iteration) {
+        cl_int retVal = CL_SUCCESS;
+        auto ptr = clDeviceMemAllocINTEL(context.get(), device, nullptr, MemoryConstants::pageSize, 0, &retVal);
+        failures += (retVal != CL_SUCCESS);
+        failures += (clMemFreeINTEL(context.get(), ptr) != CL_SUCCESS);
+    });
+}
+
+TEST_F(ClApiBenchmark, DISABLED_clHostAndDeviceMemAllocAndFreeWithAndWithoutPooling) {
+    constexpr size_t allocationSize = 256u;
+    DebugManagerStateRestore restorer;
+    for (auto pooling : {0, 1}) {
+        DebugManager.flags.EnableUnifiedMemoryPooling.set(pooling);
+        std::string variant = pooling ? "(256B, pooled)" : "(256B)";
+        runForAllThreadCounts("clHostMemAllocINTEL+clMemFreeINTEL" + variant, [&](uint32_t thread, uint32_t iteration) {
+            cl_int retVal = CL_SUCCESS;
+            auto ptr = clHostMemAllocINTEL(context.get(), nullptr, allocationSize, 0, &retVal);
+            failures += (retVal != CL_SUCCESS);
+            failures += (clMemFreeINTEL(context.get(), ptr) != CL_SUCCESS);
+        });
+        runForAllThreadCounts("clDeviceMemAllocINTEL+clMemFreeINTEL" + variant, [&](uint32_t thread, uint32_t iteration) {
+            cl_int retVal = CL_SUCCESS;
+            auto ptr = clDeviceMemAllocINTEL(context.get(), device, nullptr, allocationSize, 0, &retVal);
+            failures += (retVal != CL_SUCCESS);
+            failures += (clMemFreeINTEL(context.get(), ptr) != CL_SUCCESS);
+        });
+    }
+}
+
+TEST_F(ClApiBenchmark, DISABLED_clEnqueueReadWriteBufferWithAndWithoutHostPtrStaging) {
+    constexpr size_t maxTransferSize = static_cast<size_t>(64 * MemoryConstants::kiloByte);
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DoCpuCopyOnReadBuffer.set(0);
+    DebugManager.flags.DoCpuCopyOnWriteBuffer.set(0);
+
+    cl_int retVal = CL_SUCCESS;
+    auto buffer = clCreateBuffer(context.get(), CL_MEM_READ_WRITE, maxTransferSize, nullptr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    std::vector<uint8_t> hostData(maxTransferSize);
+
+    // Transfers go through the same queue, staging ring and pinned host pointers belong to its command stream receiver.
+    for (auto stagingThreshold : {-1, static_cast<int32_t>(maxTransferSize)}) {
+        DebugManager.flags.HostPtrStagingThreshold.set(stagingThreshold);
+        std::string variant = stagingThreshold > 0 ? ", staged)" : ")";
+        for (size_t size = 64u; size <= maxTransferSize; size *= 4) {
+            BenchmarkRunner::run("clEnqueueWriteBuffer(" + std::to_string(size) + variant, 1u, [&](uint32_t thread, uint32_t iteration) {
+                failures += (clEnqueueWriteBuffer(queues[0], buffer, CL_FALSE, 0, size, hostData.data(), 0, nullptr, nullptr) != CL_SUCCESS);
+            });
+            BenchmarkRunner::run("clEnqueueReadBuffer(" + std::to_string(size) + variant, 1u, [&](uint32_t thread, uint32_t iteration) {
+                failures += (clEnqueueReadBuffer(queues[0], buffer, CL_TRUE, 0, size, hostData.data(), 0, nullptr, nullptr) != CL_SUCCESS);
+            });
+        }
+    }
+
+    clFinish(queues[0]);
+    clReleaseMemObject(buffer);
+    EXPECT_EQ(0u, failures.load());
+}
+
+TEST_F(ClApiBenchmark, DISABLED_clEnqueueWriteBufferFromHostPtrOnManyThreads) {
+    constexpr size_t transferSize = static_cast<size_t>(16 * MemoryConstants::kiloByte);
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DoCpuCopyOnWriteBuffer.set(0);
+
+    // Every thread transfers from its own host memory, so host pointers are tracked concurrently by the host ptr manager.
+    std::vector<cl_mem> transferBuffers;
+    std::vector<std::vector<uint8_t>> hostData;
+    for (size_t thread = 0; thread < queues.size(); thread++) {
+        cl_int retVal = CL_SUCCESS;
+        transferBuffers.push_back(clCreateBuffer(context.get(), CL_MEM_READ_WRITE, transferSize, nullptr, &retVal));
+        ASSERT_EQ(CL_SUCCESS, retVal);
+        hostData.emplace_back(transferSize);
+    }
+
+    runForAllThreadCounts("clEnqueueWriteBuffer(host ptr, 16KB)", [&](uint32_t thread, uint32_t iteration) {
+        failures += (clEnqueueWriteBuffer(queues[thread], transferBuffers[thread], CL_TRUE, 0, transferSize, hostData[thread].data(), 0, nullptr, nullptr) != CL_SUCCESS);
+    });
+
+    for (auto buffer : transferBuffers) {
+        clReleaseMemObject(buffer);
+    }
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_interface.h"
+#include "shared/test/unit_test/helpers/benchmark_runner.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+#include "shared/test/unit_test/helpers/memory_management.h"
+#include "shared/test/unit_test/mocks/mock_device.h"
+
+#include "opencl/test/unit_test/global_environment.h"
+#include "test.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+// Host cost of builds of the same source issued from many threads at once, as thread pools starting up do.
+// Every call of a thread builds new source, calls with the same number on other threads build the same source
+// concurrently and miss all caches but the in-memory one.
+// Disk cache is left out, its file access would dominate both variants.
+struct CompilerCacheBenchmark : public ::testing::Test {
+    class DiskCacheMiss : public CompilerCache {
+      public:
+        DiskCacheMiss() : CompilerCache(CompilerCacheConfig{}) {}
+
+        bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) override {
+            return false;
+        }
+
+        std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) override {
+            return nullptr;
+        }
+    };
+
+    void SetUp() override {
+        // Benchmark results outlive the test.
+        MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+
+        fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+        gEnvironment->fclPushDebugVars(fclDebugVars);
+        igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+        gEnvironment->igcPushDebugVars(igcDebugVars);
+    }
+
+    void TearDown() override {
+        gEnvironment->fclPopDebugVars();
+        gEnvironment->igcPopDebugVars();
+    }
+
+    DebugManagerStateRestore restorer;
+    MockCompilerDebugVars fclDebugVars;
+    MockCompilerDebugVars igcDebugVars;
+    MockDevice device;
+    std::atomic<uint32_t> failures{0u};
+};
+
+TEST_F(CompilerCacheBenchmark, DISABLED_concurrentBuildsOfSameSourceWithAndWithoutInMemoryCompilerCache) {
+    for (auto inMemoryCompilerCache : {0, 1}) {
+        DebugManager.flags.EnableInMemoryCompilerCache.set(inMemoryCompilerCache);
+        auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::make_unique<DiskCacheMiss>(), true));
+        ASSERT_NE(nullptr, compilerInterface);
+
+        std::string variant = inMemoryCompilerCache ? ", in-memory cache)" : ")";
+        for (auto threadCount : BenchmarkRunner::getThreadCounts()) {
+            // sources of previous runs are in the in-memory cache already
+            std::string sourcePrefix = "__kernel void k" + std::to_string(threadCount) + "_";
+            std::vector<uint32_t> buildCounts(threadCount, 0u);
+            BenchmarkRunner::run("CompilerInterface::build(same source" + variant, threadCount, [&](uint32_t thread, uint32_t iteration) {
+                std::string src = sourcePrefix + std::to_string(buildCounts[thread]++) + "() {}";
+                TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+                inputArgs.src = ArrayRef<const char>(src.c_str(), src.size());
+                inputArgs.allowCaching = true;
+                TranslationOutput output;
+                failures += (TranslationOutput::ErrorCode::Success != compilerInterface->build(device, inputArgs, output));
+            });
+        }
+    }
+    EXPECT_EQ(0u, failures.load());
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/program/program_info.h"
+#include "shared/test/unit_test/device_binary_format/patchtokens_tests.h"
+#include "shared/test/unit_test/helpers/benchmark_runner.h"
+#include "shared/test/unit_test/helpers/memory_management.h"
+
+#include "test.h"
+
+#include <atomic>
+#include <string>
+
+using namespace NEO;
+
+// Host cost of loading patchtokens binary into program info: token decoding, validation and kernel info population,
+// as clCreateProgramWithBinary does once the binary is unpacked.
+struct PatchtokensLoadBenchmark : public ::testing::Test {
+    void SetUp() override {
+        // Benchmark results outlive the test.
+        MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+        singleBinary.format = DeviceBinaryFormat::Patchtokens;
+        singleBinary.deviceBinary = programTokens.storage;
+    }
+
+    PatchTokensTestData::ValidProgramWithKernelAndArg programTokens;
+    SingleDeviceBinary singleBinary;
+    std::atomic<uint32_t> failures{0u};
+};
+
+TEST_F(PatchtokensLoadBenchmark, DISABLED_decodeSingleDeviceBinary) {
+    BenchmarkRunner::run("decodeSingleDeviceBinary(patchtokens)", 1u, [&](uint32_t thread, uint32_t iteration) {
+        ProgramInfo programInfo;
+        std::string errors, warnings;
+        failures += (DecodeError::Success != decodeSingleDeviceBinary<DeviceBinaryFormat::Patchtokens>(programInfo, singleBinary, errors, warnings));
+    });
+    EXPECT_EQ(0u, failures.load());
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/program/print_formatter.h"
+#include "shared/test/unit_test/helpers/benchmark_runner.h"
+#include "shared/test/unit_test/helpers/memory_management.h"
+
+#include "test.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+// Host cost of formatting printf surface written by a kernel, records are synthesized as the compiler emits them.
+struct PrintfBenchmark : public ::testing::Test {
+    static constexpr uint32_t recordCount = 1000u;
+
+    void SetUp() override {
+        // Benchmark results outlive the test.
+        MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+
+        strings[formatIndex] = "gid=%d value=%f vector=%v4d name=%s\\n";
+        strings[nameIndex] = "kernel";
+
+        store(0u);
+        for (uint32_t record = 0; record < recordCount; record++) {
+            store(formatIndex);
+            store(PRINTF_DATA_TYPE::INT);
+            store(static_cast<int>(record));
+            store(PRINTF_DATA_TYPE::FLOAT);
+            store(record * 0.5f);
+            store(PRINTF_DATA_TYPE::VECTOR_INT);
+            store(4);
+            for (int element = 0; element < 4; element++) {
+                store(element);
+            }
+            store(PRINTF_DATA_TYPE::STRING);
+            store(nameIndex);
+        }
+        auto bufferSize = static_cast<uint32_t>(buffer.size());
+        memcpy(buffer.data(), &bufferSize, sizeof(bufferSize));
+
+        for (auto &string : strings) {
+            formatPrograms[string.first] = PrintFormatter::compileFormatString(string.second.c_str());
+        }
+    }
+
+    template <typename T>
+    void store(T value) {
+        auto offset = buffer.size();
+        buffer.resize(offset + sizeof(T));
+        memcpy(buffer.data() + offset, &value, sizeof(T));
+    }
+
+    void runPrintKernelOutput(const std::string &name, const PrintfFormatProgramMap *programs) {
+        size_t printedCharacters = 0u;
+        BenchmarkRunner::run(name, 1u, [&](uint32_t thread, uint32_t iteration) {
+            PrintFormatter printFormatter(buffer.data(), static_cast<uint32_t>(buffer.size()), false, strings, programs);
+            printFormatter.printKernelOutput([&printedCharacters](char *str) { printedCharacters += strlen(str); });
+        },
+                             100u);
+        EXPECT_NE(0u, printedCharacters);
+    }
+
+    const uint32_t formatIndex = 0u;
+    const uint32_t nameIndex = 1u;
+    StringMap strings;
+    PrintfFormatProgramMap formatPrograms;
+    std::vector<uint8_t> buffer;
+};
+
+TEST_F(PrintfBenchmark, DISABLED_printKernelOutputOf1000Records) {
+    runPrintKernelOutput("PrintFormatter::printKernelOutput(1000 records, formats compiled at load)", &formatPrograms);
+    runPrintKernelOutput("PrintFormatter::printKernelOutput(1000 records, formats compiled on first use)", nullptr);
+}
+
+TEST_F(PrintfBenchmark, DISABLED_compileFormatString) {
+    size_t tokenCount = 0u;
+    BenchmarkRunner::run("PrintFormatter::compileFormatString", 1u, [&](uint32_t thread, uint32_t iteration) {
+        tokenCount += PrintFormatter::compileFormatString(strings[formatIndex].c_str()).size();
+    });
+    EXPECT_NE(0u, tokenCount);
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/scratch_space_controller_base.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/test/unit_test/helpers/benchmark_runner.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+#include "shared/test/unit_test/helpers/default_hw_info.h"
+#include "shared/test/unit_test/helpers/memory_management.h"
+#include "shared/test/unit_test/mocks/mock_device.h"
+
+#include "test.h"
+
+#include <limits>
+#include <memory>
+#include <string>
+
+using namespace NEO;
+
+// Host cost of scratch space reallocations when kernels with different spill sizes are dispatched one after another.
+// Every iteration starts with a new scratch space controller, as a new command stream receiver would.
+struct ScratchSpaceBenchmark : public ::testing::Test {
+    void SetUp() override {
+        // Benchmark results outlive the test.
+        MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+        device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    }
+
+    // Returns number of scratch space reallocations done by one iteration.
+    uint64_t runAlternatingKernels(const std::string &name, uint32_t reservedPerThreadScratchSize) {
+        auto &csr = device->getGpgpuCommandStreamReceiver();
+        uint64_t reallocations = 0u;
+        BenchmarkRunner::run(name, 1u, [&](uint32_t thread, uint32_t iteration) {
+            ScratchSpaceControllerBase scratchSpaceController(device->getRootDeviceIndex(), *device->getExecutionEnvironment(), *csr.getInternalAllocationStorage());
+            scratchSpaceController.reserveScratchSpace(reservedPerThreadScratchSize);
+            bool stateBaseAddressDirty = false;
+            bool vfeStateDirty = false;
+            for (auto perThreadScratchSize : {1024u, 2048u, 1024u, 3072u, 2048u, 5120u, 1024u, 8192u, 4096u, 12288u}) {
+                scratchSpaceController.setRequiredScratchSpace(nullptr, perThreadScratchSize, 0u, 0u, csr.getOsContext(), stateBaseAddressDirty, vfeStateDirty);
+            }
+            reallocations = scratchSpaceController.getCounters().reallocations;
+            csr.getInternalAllocationStorage()->cleanAllocationList(std::numeric_limits<uint32_t>::max(), TEMPORARY_ALLOCATION);
+        },
+                             20u);
+        return reallocations;
+    }
+
+    std::unique_ptr<MockDevice> device;
+};
+
+TEST_F(ScratchSpaceBenchmark, DISABLED_setRequiredScratchSpaceForAlternatingKernels) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableGeometricScratchSpaceGrowth.set(0);
+    auto reallocations = runAlternatingKernels("setRequiredScratchSpace(10 kernels)", 0u);
+
+    DebugManager.flags.EnableGeometricScratchSpaceGrowth.set(1);
+    auto reallocationsWithGrowth = runAlternatingKernels("setRequiredScratchSpace(10 kernels, geometric growth)", 0u);
+    auto reallocationsWithReservation = runAlternatingKernels("setRequiredScratchSpace(10 kernels, geometric growth, reserved at module load)", 12288u);
+
+    EXPECT_LT(reallocationsWithGrowth, reallocations);
+    EXPECT_EQ(0u, reallocationsWithReservation);
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/timestamp_packet.h"
+#include "shared/test/unit_test/helpers/benchmark_runner.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+#include "shared/test/unit_test/helpers/memory_management.h"
+
+#include "opencl/source/api/api.h"
+#include "opencl/source/command_queue/command_queue.h"
+#include "opencl/source/helpers/properties_helper.h"
+#include "opencl/test/unit_test/mocks/mock_context.h"
+#include "opencl/test/unit_test/mocks/mock_kernel.h"
+#include "test.h"
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+// Host cost of enqueues forming dependency heavy graph: kernels are enqueued round robin to in order queues and every
+// kernel waits for events of all recently enqueued kernels, as task graph runtimes do.
+struct TimestampPacketDependencyBenchmark : public ::testing::Test {
+    static constexpr uint32_t queueCount = 4u;
+    static constexpr size_t waitListSize = 16u;
+
+    void SetUp() override {
+        // Benchmark results outlive the test.
+        MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+        DebugManager.flags.EnableTimestampPacket.set(1);
+
+        context = std::make_unique<MockContext>();
+        device = context->getDevice(0);
+        kernel = std::make_unique<MockKernelWithInternals>(*device, context.get(), true);
+        cl_int retVal = CL_SUCCESS;
+        buffer = clCreateBuffer(context.get(), CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, &retVal);
+        ASSERT_EQ(CL_SUCCESS, retVal);
+        for (cl_uint argIndex = 0; argIndex < 2; argIndex++) {
+            ASSERT_EQ(CL_SUCCESS, clSetKernelArg(kernel->mockKernel, argIndex, sizeof(cl_mem), &buffer));
+        }
+        for (uint32_t i = 0; i < queueCount; i++) {
+            queues.push_back(clCreateCommandQueueWithProperties(context.get(), device, nullptr, &retVal));
+            ASSERT_EQ(CL_SUCCESS, retVal);
+        }
+    }
+
+    void TearDown() override {
+        releaseEvents();
+        for (auto queue : queues) {
+            clFinish(queue);
+            clReleaseCommandQueue(queue);
+        }
+        clReleaseMemObject(buffer);
+        kernel.reset();
+    }
+
+    void releaseEvents() {
+        for (auto event : recentEvents) {
+            clReleaseEvent(event);
+        }
+        recentEvents.clear();
+    }
+
+    void enqueueWithRecentEvents(uint32_t iteration) {
+        const size_t globalWorkSize[3] = {64, 1, 1};
+        std::vector<cl_event> waitList(recentEvents.begin(), recentEvents.end());
+        cl_event event = nullptr;
+        failures += (clEnqueueNDRangeKernel(queues[iteration % queueCount], kernel->mockKernel, 1, nullptr, globalWorkSize, nullptr,
+                                            static_cast<cl_uint>(waitList.size()), waitList.empty() ? nullptr : waitList.data(), &event) != CL_SUCCESS);
+        recentEvents.push_back(event);
+        if (recentEvents.size() > waitListSize) {
+            clReleaseEvent(recentEvents.front());
+            recentEvents.pop_front();
+        }
+    }
+
+    // Size of semaphores programmed for wait list of recent events.
+    template <typename FamilyType>
+    size_t getDependenciesCmdStreamSize() {
+        std::vector<cl_event> waitList(recentEvents.begin(), recentEvents.end());
+        EventsRequest eventsRequest(static_cast<cl_uint>(waitList.size()), waitList.data(), nullptr);
+        CsrDependencies csrDeps;
+        auto commandQueue = castToObject<CommandQueue>(queues[0]);
+        eventsRequest.fillCsrDependencies(csrDeps, commandQueue->getGpgpuCommandStreamReceiver(), CsrDependencies::DependenciesType::All);
+        return TimestampPacketHelper::getRequiredCmdStreamSize<FamilyType>(csrDeps);
+    }
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<MockContext> context;
+    ClDevice *device = nullptr;
+    std::unique_ptr<MockKernelWithInternals> kernel;
+    cl_mem buffer = nullptr;
+    std::vector<cl_command_queue> queues;
+    std::deque<cl_event> recentEvents;
+    std::atomic<uint32_t> failures{0u};
+};
+
+HWTEST_F(TimestampPacketDependencyBenchmark, DISABLED_clEnqueueNDRangeKernelWithWideWaitList) {
+    size_t dependenciesSize[2] = {};
+    for (auto pruneDependencies : {0, 1}) {
+        DebugManager.flags.EnableTimestampPacketDependencyPruning.set(pruneDependencies);
+        std::string variant = pruneDependencies ? ", pruned)" : ")";
+        BenchmarkRunner::run("clEnqueueNDRangeKernel(" + std::to_string(waitListSize) + " events" + variant, 1u, [&](uint32_t thread, uint32_t iteration) {
+            enqueueWithRecentEvents(iteration);
+        });
+        dependenciesSize[pruneDependencies] = getDependenciesCmdStreamSize<FamilyType>();
+        releaseEvents();
+    }
+
+    // Without pruning every event is waited for, with pruning only the latest event of every queue.
+    size_t semaphoreSize = dependenciesSize[0] / waitListSize;
+    EXPECT_EQ(waitListSize * semaphoreSize, dependenciesSize[0]);
+    EXPECT_EQ(queueCount * semaphoreSize, dependenciesSize[1]);
+    EXPECT_EQ(0u, failures.load());
+}
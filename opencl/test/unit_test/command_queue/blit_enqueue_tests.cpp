@@ -938,3 +938,99 @@ HWTEST_TEMPLATED_F(BlitEnqueueWithDebugCapabilityTests, givenDebugFlagSetWhenCre
 
     EXPECT_NE(nullptr, ultCsr->userPauseConfirmation.get());
 }
+
+using BlitHybridCopyTests = BlitEnqueueTests<1>;
+
+HWTEST_TEMPLATED_F(BlitHybridCopyTests, givenHybridBufferCopyEnabledWhenCopyingBufferThenBlitterAndComputePartsDoNotWaitForEachOther) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    using MI_FLUSH_DW = typename FamilyType::MI_FLUSH_DW;
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    using XY_COPY_BLT = typename FamilyType::XY_COPY_BLT;
+
+    DebugManager.flags.EnableHybridBufferCopy.set(1);
+    DebugManager.flags.HybridBufferCopyMinSize.set(0);
+    DebugManager.flags.HybridBufferCopyBlitterPercentage.set(50);
+
+    auto mockCmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(bcsMockContext.get(), device.get(), nullptr);
+    ASSERT_NE(nullptr, mockCmdQ->hybridCopyBalancer.get());
+
+    const size_t copySize = 4 * MemoryConstants::kiloByte;
+    auto srcBuffer = createBuffer(copySize, false);
+    auto dstBuffer = createBuffer(copySize, false);
+    auto initialBcsTaskCount = mockCmdQ->bcsTaskCount;
+
+    cl_event event = nullptr;
+    mockCmdQ->enqueueCopyBuffer(srcBuffer.get(), dstBuffer.get(), 0, 0, copySize, 0, nullptr, &event);
+    EXPECT_EQ(initialBcsTaskCount + 1, mockCmdQ->bcsTaskCount);
+
+    auto bcsCommands = getCmdList<FamilyType>(bcsCsr->getCS(0));
+    auto cmdFound = expectCommand<XY_COPY_BLT>(bcsCommands.begin(), bcsCommands.end());
+    cmdFound = expectMiFlush<MI_FLUSH_DW>(++cmdFound, bcsCommands.end());
+    auto blitterSignalAddress = genCmdCast<MI_FLUSH_DW *>(*cmdFound)->getDestinationAddress();
+
+    auto ccsCommands = getCmdList<FamilyType>(mockCmdQ->getCS(0));
+    auto walkerFound = expectCommand<WALKER_TYPE>(ccsCommands.begin(), ccsCommands.end());
+    for (auto semaphoreFound = find<MI_SEMAPHORE_WAIT *>(ccsCommands.begin(), walkerFound); semaphoreFound != walkerFound;
+         semaphoreFound = find<MI_SEMAPHORE_WAIT *>(++semaphoreFound, walkerFound)) {
+        EXPECT_NE(blitterSignalAddress, genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphoreFound)->getSemaphoreGraphicsAddress());
+    }
+
+    auto isBlitterNodeJoined = [blitterSignalAddress](const TimestampPacketContainer &timestampPacketNodes) {
+        for (auto node : timestampPacketNodes.peekNodes()) {
+            if (TimestampPacketHelper::getContextEndGpuAddress(*node) == blitterSignalAddress) {
+                return true;
+            }
+        }
+        return false;
+    };
+    EXPECT_TRUE(isBlitterNodeJoined(*mockCmdQ->timestampPacketContainer));
+    EXPECT_TRUE(isBlitterNodeJoined(*castToObject<Event>(event)->getTimestampPacketNodes()));
+    EXPECT_LT(1u, mockCmdQ->timestampPacketContainer->peekNodes().size());
+
+    clReleaseEvent(event);
+}
+
+HWTEST_TEMPLATED_F(BlitHybridCopyTests, givenHybridBufferCopyWhenComputePartIsCompletedBeforeBlitterPartThenEventIsNotCompleted) {
+    DebugManager.flags.EnableHybridBufferCopy.set(1);
+    DebugManager.flags.HybridBufferCopyMinSize.set(0);
+    DebugManager.flags.HybridBufferCopyBlitterPercentage.set(50);
+
+    auto mockCmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(bcsMockContext.get(), device.get(), nullptr);
+    const size_t copySize = 4 * MemoryConstants::kiloByte;
+    auto srcBuffer = createBuffer(copySize, false);
+    auto dstBuffer = createBuffer(copySize, false);
+
+    cl_event event = nullptr;
+    mockCmdQ->enqueueCopyBuffer(srcBuffer.get(), dstBuffer.get(), 0, 0, copySize, 0, nullptr, &event);
+    auto outEvent = castToObject<Event>(event);
+    EXPECT_EQ(mockCmdQ->bcsTaskCount, outEvent->peekBcsTaskCount());
+
+    auto gpgpuTagAddress = mockCmdQ->getGpgpuCommandStreamReceiver().getTagAddress();
+    auto bcsTagAddress = mockCmdQ->getBcsCommandStreamReceiver()->getTagAddress();
+    *gpgpuTagAddress = outEvent->peekTaskCount();
+    *bcsTagAddress = outEvent->peekBcsTaskCount() - 1;
+    EXPECT_NE(CL_COMPLETE, outEvent->updateEventAndReturnCurrentStatus());
+
+    *bcsTagAddress = outEvent->peekBcsTaskCount();
+    EXPECT_EQ(CL_COMPLETE, outEvent->updateEventAndReturnCurrentStatus());
+
+    clReleaseEvent(event);
+}
+
+HWTEST_TEMPLATED_F(BlitHybridCopyTests, givenHybridBufferCopyEnabledWhenCopyIsSmallerThanMinSizeThenOnlyBlitterIsUsed) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+
+    DebugManager.flags.EnableHybridBufferCopy.set(1);
+    DebugManager.flags.HybridBufferCopyMinSize.set(MemoryConstants::pageSize + 1);
+
+    auto mockCmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(bcsMockContext.get(), device.get(), nullptr);
+    auto srcBuffer = createBuffer(MemoryConstants::pageSize, false);
+    auto dstBuffer = createBuffer(MemoryConstants::pageSize, false);
+    auto initialBcsTaskCount = mockCmdQ->bcsTaskCount;
+
+    mockCmdQ->enqueueCopyBuffer(srcBuffer.get(), dstBuffer.get(), 0, 0, MemoryConstants::pageSize, 0, nullptr, nullptr);
+    EXPECT_EQ(initialBcsTaskCount + 1, mockCmdQ->bcsTaskCount);
+
+    auto ccsCommands = getCmdList<FamilyType>(mockCmdQ->getCS(0));
+    EXPECT_EQ(ccsCommands.end(), find<WALKER_TYPE *>(ccsCommands.begin(), ccsCommands.end()));
+}
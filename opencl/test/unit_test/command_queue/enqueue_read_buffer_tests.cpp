@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/command_stream/host_staging_ring.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/cache_policy.h"
 #include "shared/source/memory_manager/allocations_list.h"
@@ -668,6 +669,39 @@ HWTEST_F(EnqueueReadBufferTypeTest, givenEnqueueReadBufferNonBlockingWhenAUBDump
     EXPECT_FALSE(srcBuffer->forceDisallowCPUCopy);
 }
 
+HWTEST_F(EnqueueReadBufferTypeTest, givenHostPtrStagingEnabledWhenBlockingReadOfSmallBufferThenDataIsCopiedFromStagingRingToHostPtr) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.DoCpuCopyOnReadBuffer.set(0);
+    DebugManager.flags.HostPtrStagingThreshold.set(static_cast<int32_t>(MemoryConstants::pageSize));
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto stagingRing = csr.getHostStagingRing();
+    ASSERT_NE(nullptr, stagingRing);
+    memset(stagingRing->getAllocation()->getUnderlyingBuffer(), 0x5a, MemoryConstants::cacheLineSize);
+
+    uint8_t hostData[MemoryConstants::cacheLineSize] = {};
+    auto retVal = pCmdQ->enqueueReadBuffer(srcBuffer.get(), CL_TRUE, 0, sizeof(hostData), hostData, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    for (auto value : hostData) {
+        EXPECT_EQ(0x5a, value);
+    }
+    EXPECT_EQ(0u, stagingRing->getUsedSize());
+    EXPECT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
+}
+
+HWTEST_F(EnqueueReadBufferTypeTest, givenHostPtrStagingEnabledWhenNonBlockingReadOfSmallBufferThenStagingRingIsNotUsed) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.DoCpuCopyOnReadBuffer.set(0);
+    DebugManager.flags.HostPtrStagingThreshold.set(static_cast<int32_t>(MemoryConstants::pageSize));
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    uint8_t hostData[MemoryConstants::cacheLineSize] = {};
+    auto retVal = pCmdQ->enqueueReadBuffer(srcBuffer.get(), CL_FALSE, 0, sizeof(hostData), hostData, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(nullptr, csr.hostStagingRing.get());
+}
+
 using NegativeFailAllocationTest = Test<NegativeFailAllocationCommandEnqueueBaseFixture>;
 
 HWTEST_F(NegativeFailAllocationTest, givenEnqueueReadBufferWhenHostPtrAllocationCreationFailsThenReturnOutOfResource) {
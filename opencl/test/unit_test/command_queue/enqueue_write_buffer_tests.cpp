@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/command_stream/host_staging_ring.h"
 #include "shared/source/memory_manager/allocations_list.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
@@ -476,6 +477,38 @@ HWTEST_F(EnqueueWriteBufferTypeTest, givenEnqueueWriteBufferCalledWhenLockedPtrI
     EXPECT_EQ(0u, memoryManager.unlockResourceCalled);
 }
 
+HWTEST_F(EnqueueWriteBufferTypeTest, givenHostPtrStagingEnabledWhenWritingSmallBufferThenHostPtrIsCopiedToStagingRingInsteadOfBeingPinned) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.DoCpuCopyOnWriteBuffer.set(0);
+    DebugManager.flags.HostPtrStagingThreshold.set(static_cast<int32_t>(MemoryConstants::pageSize));
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    uint8_t hostData[MemoryConstants::cacheLineSize];
+    memset(hostData, 0x5a, sizeof(hostData));
+
+    auto retVal = pCmdQ->enqueueWriteBuffer(srcBuffer.get(), CL_FALSE, 0, sizeof(hostData), hostData, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto stagingRing = csr.hostStagingRing.get();
+    ASSERT_NE(nullptr, stagingRing);
+    EXPECT_EQ(0, memcmp(hostData, stagingRing->getAllocation()->getUnderlyingBuffer(), sizeof(hostData)));
+    EXPECT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
+}
+
+HWTEST_F(EnqueueWriteBufferTypeTest, givenHostPtrStagingEnabledWhenWritingBufferAboveThresholdThenStagingRingIsNotUsed) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.DoCpuCopyOnWriteBuffer.set(0);
+    DebugManager.flags.HostPtrStagingThreshold.set(static_cast<int32_t>(MemoryConstants::cacheLineSize));
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    uint8_t hostData[2 * MemoryConstants::cacheLineSize] = {};
+
+    auto retVal = pCmdQ->enqueueWriteBuffer(srcBuffer.get(), CL_FALSE, 0, sizeof(hostData), hostData, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(nullptr, csr.hostStagingRing.get());
+    EXPECT_FALSE(csr.getTemporaryAllocations().peekIsEmpty());
+}
+
 using NegativeFailAllocationTest = Test<NegativeFailAllocationCommandEnqueueBaseFixture>;
 
 HWTEST_F(NegativeFailAllocationTest, givenEnqueueWriteBufferWhenHostPtrAllocationCreationFailsThenReturnOutOfResource) {
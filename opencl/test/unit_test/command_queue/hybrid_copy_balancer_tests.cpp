@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "opencl/source/command_queue/hybrid_copy_balancer.h"
+#include "opencl/test/unit_test/mocks/mock_execution_environment.h"
+#include "opencl/test/unit_test/mocks/mock_memory_manager.h"
+#include "opencl/test/unit_test/mocks/mock_timestamp_container.h"
+#include "test.h"
+
+using namespace NEO;
+
+struct HybridCopyBalancerTests : public ::testing::Test {
+    void completeNode(TagNode<TimestampPacketStorage> *node, uint32_t globalStart, uint32_t globalEnd) {
+        auto &packet = node->tagForCpuAccess->packets[0];
+        packet.contextStart = globalStart;
+        packet.globalStart = globalStart;
+        packet.contextEnd = globalEnd;
+        packet.globalEnd = globalEnd;
+    }
+
+    MockExecutionEnvironment executionEnvironment{defaultHwInfo.get()};
+    MockMemoryManager memoryManager{executionEnvironment};
+    MockTagAllocator<TimestampPacketStorage> allocator{0, &memoryManager, 10};
+};
+
+TEST_F(HybridCopyBalancerTests, givenHybridBufferCopyFlagsWhenCreatingBalancerThenFlagsAreRespected) {
+    DebugManagerStateRestore restore{};
+    EXPECT_EQ(nullptr, HybridCopyBalancer::create());
+
+    DebugManager.flags.EnableHybridBufferCopy.set(1);
+    auto balancer = HybridCopyBalancer::create();
+    ASSERT_NE(nullptr, balancer);
+    EXPECT_FALSE(balancer->isSplitRequired(HybridCopyBalancer::defaultMinSplitSize - 1));
+    EXPECT_TRUE(balancer->isSplitRequired(HybridCopyBalancer::defaultMinSplitSize));
+    EXPECT_EQ(HybridCopyBalancer::initialBlitterShare, balancer->getBlitterShare());
+
+    DebugManager.flags.HybridBufferCopyMinSize.set(4096);
+    DebugManager.flags.HybridBufferCopyBlitterPercentage.set(25);
+    balancer = HybridCopyBalancer::create();
+    EXPECT_TRUE(balancer->isSplitRequired(4096));
+    EXPECT_EQ(0.25, balancer->getBlitterShare());
+}
+
+TEST_F(HybridCopyBalancerTests, givenBlitterShareWhenGettingBlitterPortionThenComputePortionIsAligned) {
+    HybridCopyBalancer balancer(0u, 30);
+    EXPECT_EQ(314624u, balancer.getBlitterPortion(MemoryConstants::megaByte));
+    EXPECT_EQ(HybridCopyBalancer::splitAlignment, balancer.getBlitterPortion(HybridCopyBalancer::splitAlignment));
+
+    HybridCopyBalancer blitterOnlyBalancer(0u, 100);
+    EXPECT_EQ(MemoryConstants::megaByte + 1, blitterOnlyBalancer.getBlitterPortion(MemoryConstants::megaByte + 1));
+
+    HybridCopyBalancer computeOnlyBalancer(0u, 0);
+    EXPECT_EQ(1u, computeOnlyBalancer.getBlitterPortion(MemoryConstants::megaByte + 1));
+}
+
+TEST_F(HybridCopyBalancerTests, givenCompletedCopiesOnBothEnginesWhenGettingBlitterShareThenItFollowsMeasuredThroughput) {
+    HybridCopyBalancer balancer(0u, -1);
+
+    MockTimestampPacketContainer blitterNodes(allocator, 1);
+    MockTimestampPacketContainer computeNodes(allocator, 1);
+    balancer.trackCopy(HybridCopyBalancer::Engine::Blitter, MemoryConstants::megaByte, blitterNodes);
+    balancer.trackCopy(HybridCopyBalancer::Engine::Compute, MemoryConstants::megaByte, computeNodes);
+
+    completeNode(blitterNodes.getNode(0), 1000, 1100);
+    EXPECT_EQ(HybridCopyBalancer::initialBlitterShare, balancer.getBlitterShare());
+    EXPECT_EQ(0.0, balancer.getThroughput(HybridCopyBalancer::Engine::Compute));
+
+    completeNode(computeNodes.getNode(0), 1000, 1300);
+    EXPECT_DOUBLE_EQ(0.75, balancer.getBlitterShare());
+    EXPECT_DOUBLE_EQ(MemoryConstants::megaByte / 100.0, balancer.getThroughput(HybridCopyBalancer::Engine::Blitter));
+    EXPECT_DOUBLE_EQ(MemoryConstants::megaByte / 300.0, balancer.getThroughput(HybridCopyBalancer::Engine::Compute));
+}
+
+TEST_F(HybridCopyBalancerTests, givenMuchFasterEngineWhenGettingBlitterShareThenOtherEngineKeepsMinimalShare) {
+    HybridCopyBalancer balancer(0u, -1);
+
+    MockTimestampPacketContainer blitterNodes(allocator, 1);
+    MockTimestampPacketContainer computeNodes(allocator, 1);
+    completeNode(blitterNodes.getNode(0), 0xFFFFFFF0u, 0x10u);
+    completeNode(computeNodes.getNode(0), 0, 100000);
+    balancer.trackCopy(HybridCopyBalancer::Engine::Blitter, MemoryConstants::megaByte, blitterNodes);
+    balancer.trackCopy(HybridCopyBalancer::Engine::Compute, MemoryConstants::megaByte, computeNodes);
+
+    EXPECT_DOUBLE_EQ(MemoryConstants::megaByte / 32.0, balancer.getThroughput(HybridCopyBalancer::Engine::Blitter));
+    EXPECT_DOUBLE_EQ(1.0 - HybridCopyBalancer::minEngineShare, balancer.getBlitterShare());
+}
+
+TEST_F(HybridCopyBalancerTests, givenFixedBlitterShareWhenTrackingCopiesThenShareIsNotUpdated) {
+    HybridCopyBalancer balancer(0u, 40);
+
+    MockTimestampPacketContainer blitterNodes(allocator, 1);
+    MockTimestampPacketContainer computeNodes(allocator, 1);
+    completeNode(blitterNodes.getNode(0), 0, 100);
+    completeNode(computeNodes.getNode(0), 0, 400);
+    balancer.trackCopy(HybridCopyBalancer::Engine::Blitter, MemoryConstants::megaByte, blitterNodes);
+    balancer.trackCopy(HybridCopyBalancer::Engine::Compute, MemoryConstants::megaByte, computeNodes);
+
+    EXPECT_EQ(0.4, balancer.getBlitterShare());
+}
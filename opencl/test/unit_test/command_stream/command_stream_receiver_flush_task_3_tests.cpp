@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/command_stream/adaptive_batching_controller.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
@@ -28,6 +29,8 @@
 #include "opencl/test/unit_test/mocks/mock_submissions_aggregator.h"
 #include "test.h"
 
+#include <thread>
+
 using namespace NEO;
 
 typedef UltCommandStreamReceiverTest CommandStreamReceiverFlushTaskTests;
@@ -1715,3 +1718,107 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCommandStreamReceiverWhenInit
     EXPECT_FALSE(csr->pageTableManagerInitialized);
     memoryManager->freeGraphicsMemory(graphicsAllocation);
 }
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveBatchingFlagsNotSetWhenCsrIsCreatedThenAdaptiveBatchingControllerIsNotCreated) {
+    MockCsrHw2<FamilyType> mockCsr(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
+    EXPECT_EQ(nullptr, mockCsr.getAdaptiveBatchingController());
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveBatchingWithMaxCommandBuffersWhenThresholdIsReachedThenRecordedCommandBuffersAreFlushedInOneBatch) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CsrAdaptiveBatchingMaxCommandBuffers.set(2);
+
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
+    pDevice->resetCommandStreamReceiver(mockCsr);
+    mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatch);
+    auto adaptiveBatchingController = mockCsr->getAdaptiveBatchingController();
+    ASSERT_NE(nullptr, adaptiveBatchingController);
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+    EXPECT_EQ(1u, adaptiveBatchingController->getPendingCommandBuffersCount());
+
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_TRUE(mockCsr->peekSubmissionAggregator()->peekCmdBufferList().peekIsEmpty());
+    EXPECT_EQ(0u, adaptiveBatchingController->getPendingCommandBuffersCount());
+
+    auto statistics = adaptiveBatchingController->getStatistics();
+    EXPECT_EQ(1u, statistics.batchesFlushed);
+    EXPECT_EQ(2u, statistics.commandBuffersFlushed);
+    EXPECT_EQ(2u, statistics.largestBatch);
+    EXPECT_EQ(1u, statistics.thresholdFlushes);
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveBatchingWithFlushOnGpuIdleWhenGpuIsBusyThenCommandBuffersAreBatchedUntilGpuIsIdle) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CsrAdaptiveBatchingFlushOnGpuIdle.set(1);
+
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
+    pDevice->resetCommandStreamReceiver(mockCsr);
+    mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatch);
+    auto adaptiveBatchingController = mockCsr->getAdaptiveBatchingController();
+    ASSERT_NE(nullptr, adaptiveBatchingController);
+    *mockCsr->getTagAddress() = 0u;
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_EQ(1u, mockCsr->peekLatestFlushedTaskCount());
+
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+
+    *mockCsr->getTagAddress() = 1u;
+    mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(2, mockCsr->flushCalledCount);
+
+    auto statistics = adaptiveBatchingController->getStatistics();
+    EXPECT_EQ(2u, statistics.batchesFlushed);
+    EXPECT_EQ(3u, statistics.commandBuffersFlushed);
+    EXPECT_EQ(2u, statistics.largestBatch);
+    EXPECT_EQ(2u, statistics.gpuIdleFlushes);
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenAdaptiveBatchingWithDeadlineWhenCommandBufferIsRecordedThenTimerFlushesItAfterDeadline) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CsrAdaptiveBatchingDeadlineUs.set(100);
+
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex());
+    pDevice->resetCommandStreamReceiver(mockCsr);
+    mockCsr->overrideDispatchPolicy(DispatchMode::BatchedDispatch);
+    auto adaptiveBatchingController = mockCsr->getAdaptiveBatchingController();
+    ASSERT_NE(nullptr, adaptiveBatchingController);
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+
+    {
+        auto lock = mockCsr->obtainUniqueOwnership();
+        mockCsr->flushTask(commandStream, 0, dsh, ioh, ssh, taskLevel, dispatchFlags, *pDevice);
+        EXPECT_EQ(0, mockCsr->flushCalledCount);
+    }
+
+    while (adaptiveBatchingController->getStatistics().deadlineFlushes == 0u) {
+        std::this_thread::yield();
+    }
+    mockCsr->stopAdaptiveBatchingTimer();
+
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_TRUE(mockCsr->peekSubmissionAggregator()->peekCmdBufferList().peekIsEmpty());
+    EXPECT_EQ(1u, adaptiveBatchingController->getStatistics().commandBuffersFlushed);
+}
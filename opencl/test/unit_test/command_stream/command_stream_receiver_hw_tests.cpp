@@ -1785,6 +1785,7 @@ HWTEST_F(BcsTests, givenInvalidBlitDirectionWhenConstructPropertiesThenException
 }
 
 struct MockScratchSpaceController : ScratchSpaceControllerBase {
+    using ScratchSpaceControllerBase::computeUnitsUsedForScratch;
     using ScratchSpaceControllerBase::privateScratchAllocation;
     using ScratchSpaceControllerBase::ScratchSpaceControllerBase;
 };
@@ -1798,6 +1799,67 @@ TEST_F(ScratchSpaceControllerTest, whenScratchSpaceControllerIsDestroyedThenItRe
     //no memory leak is expected
 }
 
+TEST_F(ScratchSpaceControllerTest, givenGeometricGrowthDisabledWhenRequiredScratchSpaceGrowsThenScratchSpaceIsReallocatedToRequiredSize) {
+    MockScratchSpaceController scratchSpaceController(pDevice->getRootDeviceIndex(), *pDevice->getExecutionEnvironment(), *pDevice->getGpgpuCommandStreamReceiver().getInternalAllocationStorage());
+    auto &osContext = *pDevice->getDefaultEngine().osContext;
+    bool stateBaseAddressDirty = false;
+    bool vfeStateDirty = false;
+
+    for (auto requiredSize : {1024u, 3072u, 2048u, 4096u}) {
+        scratchSpaceController.setRequiredScratchSpace(nullptr, requiredSize, 0u, 0u, osContext, stateBaseAddressDirty, vfeStateDirty);
+    }
+    EXPECT_EQ(4096u, scratchSpaceController.getPerThreadScratchSpaceSize());
+    EXPECT_EQ(4096u * scratchSpaceController.computeUnitsUsedForScratch, scratchSpaceController.getScratchSpaceAllocation()->getUnderlyingBufferSize());
+    EXPECT_EQ(3u, scratchSpaceController.getCounters().allocations);
+    EXPECT_EQ(2u, scratchSpaceController.getCounters().reallocations);
+}
+
+TEST_F(ScratchSpaceControllerTest, givenGeometricGrowthEnabledWhenRequiredScratchSpaceGrowsThenScratchSpaceAtLeastDoublesToPowerOfTwo) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableGeometricScratchSpaceGrowth.set(1);
+    MockScratchSpaceController scratchSpaceController(pDevice->getRootDeviceIndex(), *pDevice->getExecutionEnvironment(), *pDevice->getGpgpuCommandStreamReceiver().getInternalAllocationStorage());
+    auto &osContext = *pDevice->getDefaultEngine().osContext;
+    bool stateBaseAddressDirty = false;
+    bool vfeStateDirty = false;
+
+    scratchSpaceController.setRequiredScratchSpace(nullptr, 1024u, 0u, 0u, osContext, stateBaseAddressDirty, vfeStateDirty);
+    EXPECT_EQ(1024u, scratchSpaceController.getPerThreadScratchSpaceSize());
+
+    vfeStateDirty = false;
+    scratchSpaceController.setRequiredScratchSpace(nullptr, 1536u, 0u, 0u, osContext, stateBaseAddressDirty, vfeStateDirty);
+    EXPECT_TRUE(vfeStateDirty);
+    EXPECT_EQ(2048u, scratchSpaceController.getPerThreadScratchSpaceSize());
+
+    vfeStateDirty = false;
+    scratchSpaceController.setRequiredScratchSpace(nullptr, 3072u, 0u, 0u, osContext, stateBaseAddressDirty, vfeStateDirty);
+    EXPECT_EQ(4096u, scratchSpaceController.getPerThreadScratchSpaceSize());
+    EXPECT_EQ(4096u * scratchSpaceController.computeUnitsUsedForScratch, scratchSpaceController.getScratchSpaceAllocation()->getUnderlyingBufferSize());
+
+    vfeStateDirty = false;
+    scratchSpaceController.setRequiredScratchSpace(nullptr, 4096u, 0u, 0u, osContext, stateBaseAddressDirty, vfeStateDirty);
+    EXPECT_FALSE(vfeStateDirty);
+    EXPECT_EQ(3u, scratchSpaceController.getCounters().allocations);
+    EXPECT_EQ(2u, scratchSpaceController.getCounters().reallocations);
+}
+
+TEST_F(ScratchSpaceControllerTest, givenGeometricGrowthEnabledAndScratchSpaceReservedForDeviceWhenScratchSpaceIsRequiredThenReservedSizeIsAllocatedOnce) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableGeometricScratchSpaceGrowth.set(1);
+    auto &csr = pDevice->getGpgpuCommandStreamReceiver();
+    auto scratchSpaceController = csr.getScratchSpaceController();
+    pDevice->reserveScratchSpace(8192u);
+    pDevice->reserveScratchSpace(4096u);
+
+    bool stateBaseAddressDirty = false;
+    bool vfeStateDirty = false;
+    for (auto requiredSize : {1024u, 8192u, 4096u}) {
+        scratchSpaceController->setRequiredScratchSpace(nullptr, requiredSize, 0u, 0u, csr.getOsContext(), stateBaseAddressDirty, vfeStateDirty);
+    }
+    EXPECT_EQ(8192u, scratchSpaceController->getPerThreadScratchSpaceSize());
+    EXPECT_EQ(1u, scratchSpaceController->getCounters().allocations);
+    EXPECT_EQ(0u, scratchSpaceController->getCounters().reallocations);
+}
+
 TEST(BcsConstantsTests, givenBlitConstantsThenTheyHaveDesiredValues) {
     EXPECT_EQ(BlitterConstants::maxBlitWidth, 0x7FC0u);
     EXPECT_EQ(BlitterConstants::maxBlitHeight, 0x3FC0u);
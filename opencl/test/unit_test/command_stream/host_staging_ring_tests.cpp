@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/host_staging_ring.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "opencl/test/unit_test/mocks/mock_execution_environment.h"
+#include "opencl/test/unit_test/mocks/mock_memory_manager.h"
+#include "test.h"
+
+using namespace NEO;
+
+struct HostStagingRingTest : public ::testing::Test {
+    void SetUp() override {
+        memoryManager = std::make_unique<MockMemoryManager>(executionEnvironment);
+        auto allocation = memoryManager->allocateGraphicsMemoryWithProperties({0u, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::INTERNAL_HOST_MEMORY});
+        ASSERT_NE(nullptr, allocation);
+        ring = std::make_unique<HostStagingRing>(*memoryManager, allocation, &tag);
+    }
+
+    void TearDown() override {
+        ring.reset();
+    }
+
+    void *getRingPtr(size_t offset) {
+        return ptrOffset(ring->getAllocation()->getUnderlyingBuffer(), offset);
+    }
+
+    MockExecutionEnvironment executionEnvironment{defaultHwInfo.get()};
+    std::unique_ptr<MockMemoryManager> memoryManager;
+    std::unique_ptr<HostStagingRing> ring;
+    volatile uint32_t tag = 0u;
+};
+
+TEST_F(HostStagingRingTest, whenObtainingChunksThenTheyAreConsecutiveAndAlignedToCacheLine) {
+    EXPECT_EQ(MemoryConstants::pageSize, ring->getRingSize());
+
+    HostStagingChunk first;
+    HostStagingChunk second;
+    ASSERT_TRUE(ring->obtainChunk(1u, first));
+    ASSERT_TRUE(ring->obtainChunk(100u, second));
+
+    EXPECT_EQ(getRingPtr(0u), first.cpuPtr);
+    EXPECT_EQ(getRingPtr(MemoryConstants::cacheLineSize), second.cpuPtr);
+    EXPECT_EQ(ring->getAllocation()->getGpuAddress() + MemoryConstants::cacheLineSize, second.gpuAddress);
+    EXPECT_NE(first.id, second.id);
+    EXPECT_EQ(3 * MemoryConstants::cacheLineSize, ring->getUsedSize());
+}
+
+TEST_F(HostStagingRingTest, givenZeroSizeOrSizeAboveRingSizeWhenObtainingChunkThenFalseIsReturned) {
+    HostStagingChunk chunk;
+    EXPECT_FALSE(ring->obtainChunk(0u, chunk));
+    EXPECT_FALSE(ring->obtainChunk(ring->getRingSize() + 1, chunk));
+    EXPECT_EQ(0u, ring->getUsedSize());
+}
+
+TEST_F(HostStagingRingTest, givenChunkNotReleasedOrNotCompletedWhenTagAdvancesThenChunkIsNotReused) {
+    HostStagingChunk chunk;
+    ASSERT_TRUE(ring->obtainChunk(ring->getRingSize(), chunk));
+
+    tag = 10u;
+    HostStagingChunk nextChunk;
+    EXPECT_FALSE(ring->obtainChunk(1u, nextChunk));
+
+    ring->releaseChunk(chunk, 11u);
+    EXPECT_FALSE(ring->obtainChunk(1u, nextChunk));
+
+    tag = 11u;
+    EXPECT_TRUE(ring->obtainChunk(1u, nextChunk));
+    EXPECT_EQ(getRingPtr(0u), nextChunk.cpuPtr);
+}
+
+TEST_F(HostStagingRingTest, givenChunksReleasedOutOfOrderWhenNewestCompletesFirstThenSpaceIsReturnedAfterOldestCompletes) {
+    HostStagingChunk first;
+    HostStagingChunk second;
+    ASSERT_TRUE(ring->obtainChunk(ring->getRingSize() / 2, first));
+    ASSERT_TRUE(ring->obtainChunk(ring->getRingSize() / 2, second));
+
+    ring->releaseChunk(second, 0u);
+    EXPECT_EQ(ring->getRingSize(), ring->getUsedSize());
+
+    ring->releaseChunk(first, 0u);
+    EXPECT_EQ(0u, ring->getUsedSize());
+}
+
+TEST_F(HostStagingRingTest, givenTailOfRingTooSmallWhenObtainingChunkThenItWrapsToBeginningAndTailIsReclaimedWithPrecedingChunks) {
+    HostStagingChunk chunkA;
+    HostStagingChunk chunkB;
+    HostStagingChunk chunkC;
+    ASSERT_TRUE(ring->obtainChunk(1024u, chunkA));
+    ASSERT_TRUE(ring->obtainChunk(1024u, chunkB));
+    ASSERT_TRUE(ring->obtainChunk(1536u, chunkC));
+    ring->releaseChunk(chunkA, 1u);
+    ring->releaseChunk(chunkB, 5u);
+    ring->releaseChunk(chunkC, 5u);
+
+    tag = 1u;
+    HostStagingChunk wrappedChunk;
+    ASSERT_TRUE(ring->obtainChunk(1024u, wrappedChunk));
+    EXPECT_EQ(getRingPtr(0u), wrappedChunk.cpuPtr);
+    EXPECT_EQ(ring->getRingSize(), ring->getUsedSize());
+
+    HostStagingChunk chunk;
+    EXPECT_FALSE(ring->obtainChunk(1u, chunk));
+
+    tag = 5u;
+    ring->releaseChunk(wrappedChunk, 5u);
+    EXPECT_EQ(0u, ring->getUsedSize());
+    ASSERT_TRUE(ring->obtainChunk(1u, chunk));
+    EXPECT_EQ(getRingPtr(0u), chunk.cpuPtr);
+}
+
+TEST(HostStagingRingThresholdTest, givenHostPtrStagingThresholdFlagWhenGettingTransferSizeThresholdThenValueIsCappedAtQuarterOfRing) {
+    DebugManagerStateRestore restorer;
+    const size_t ringSize = HostStagingRing::defaultRingSize;
+
+    EXPECT_EQ(0u, HostStagingRing::getTransferSizeThreshold(ringSize));
+
+    DebugManager.flags.HostPtrStagingThreshold.set(0);
+    EXPECT_EQ(0u, HostStagingRing::getTransferSizeThreshold(ringSize));
+
+    DebugManager.flags.HostPtrStagingThreshold.set(4096);
+    EXPECT_EQ(4096u, HostStagingRing::getTransferSizeThreshold(ringSize));
+
+    DebugManager.flags.HostPtrStagingThreshold.set(static_cast<int32_t>(ringSize));
+    EXPECT_EQ(ringSize / 4, HostStagingRing::getTransferSizeThreshold(ringSize));
+}
@@ -18,6 +18,7 @@
 #include "opencl/source/api/api.h"
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
 #include "opencl/source/command_queue/command_queue_hw.h"
+#include "opencl/source/command_queue/gpgpu_walker.h"
 #include "opencl/source/helpers/hardware_commands_helper.h"
 #include "opencl/test/unit_test/fixtures/execution_model_kernel_fixture.h"
 #include "opencl/test/unit_test/fixtures/hello_world_fixture.h"
@@ -59,7 +60,7 @@ void HardwareCommandsTest::addSpaceForSingleKernelArg() {
 }
 
 HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, WhenProgramInterfaceDescriptorDataIsCreatedThenOnlyRequiredSpaceOnIndirectHeapIsAllocated) {
-    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
 
     std::unique_ptr<Image> srcImage(Image2dHelper<>::create(pContext));
     ASSERT_NE(nullptr, srcImage.get());
@@ -131,7 +132,7 @@ HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, WhenMediaStateFlushIsCreatedTh
 }
 
 HWTEST_F(HardwareCommandsTest, WhenCrossThreadDataIsCreatedThenOnlyRequiredSpaceOnIndirectHeapIsAllocated) {
-    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
 
     std::unique_ptr<Image> srcImage(Image2dHelper<>::create(pContext));
     ASSERT_NE(nullptr, srcImage.get());
@@ -170,7 +171,7 @@ HWTEST_F(HardwareCommandsTest, WhenCrossThreadDataIsCreatedThenOnlyRequiredSpace
 }
 
 HWTEST_F(HardwareCommandsTest, givenSendCrossThreadDataWhenWhenAddPatchInfoCommentsForAUBDumpIsNotSetThenAddPatchInfoDataOffsetsAreNotMoved) {
-    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
 
     MockContext context;
 
@@ -236,7 +237,7 @@ HWTEST_F(HardwareCommandsTest, givenSendCrossThreadDataWhenWhenAddPatchInfoComme
     DebugManagerStateRestore dbgRestore;
     DebugManager.flags.AddPatchInfoCommentsForAUBDump.set(true);
 
-    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
 
     MockContext context;
 
@@ -279,7 +280,7 @@ HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, WhenAllocatingIndirectStateRes
     using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
     using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
 
-    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
 
     std::unique_ptr<Image> srcImage(Image2dHelper<>::create(pContext));
     ASSERT_NE(nullptr, srcImage.get());
@@ -366,7 +367,7 @@ HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, WhenAllocatingIndirectStateRes
 HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, givenKernelWithFourBindingTableEntriesWhenIndirectStateIsEmittedThenInterfaceDescriptorContainsCorrectBindingTableEntryCount) {
     using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
     using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
-    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
 
     auto &commandStream = cmdQ.getCS(1024);
     auto pWalkerCmd = static_cast<GPGPU_WALKER *>(commandStream.getSpace(sizeof(GPGPU_WALKER)));
@@ -411,7 +412,7 @@ HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, givenKernelWithFourBindingTabl
 HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, givenKernelThatIsSchedulerWhenIndirectStateIsEmittedThenInterfaceDescriptorContainsZeroBindingTableEntryCount) {
     using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
     using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
-    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
 
     auto &commandStream = cmdQ.getCS(1024);
     auto pWalkerCmd = static_cast<GPGPU_WALKER *>(commandStream.getSpace(sizeof(GPGPU_WALKER)));
@@ -454,7 +455,7 @@ HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, givenKernelThatIsSchedulerWhen
 HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, givenKernelWith100BindingTableEntriesWhenIndirectStateIsEmittedThenInterfaceDescriptorHas31BindingTableEntriesSet) {
     using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
     using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
-    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
 
     auto &commandStream = cmdQ.getCS(1024);
     auto pWalkerCmd = static_cast<GPGPU_WALKER *>(commandStream.getSpace(sizeof(GPGPU_WALKER)));
@@ -500,7 +501,7 @@ HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, whenSendingIndirectStateThenKe
     using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
     using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
 
-    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
 
     std::unique_ptr<Image> img(Image2dHelper<>::create(pContext));
 
@@ -582,7 +583,7 @@ HWCMDTEST_F(IGFX_GEN8_CORE, HardwareCommandsTest, WhenSendingIndirectStateThenBi
     typedef typename FamilyType::RENDER_SURFACE_STATE RENDER_SURFACE_STATE;
     using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
 
-    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
     std::unique_ptr<Image> dstImage(Image2dHelper<>::create(pContext));
     ASSERT_NE(nullptr, dstImage.get());
 
@@ -1359,3 +1360,239 @@ HWTEST_F(KernelCacheFlushTests, givenLocallyUncachedBufferWhenGettingAllocations
     clReleaseMemObject(bufferLocallyUncached);
     clReleaseMemObject(bufferRegular);
 }
+
+struct SurfaceStateHeapCacheTest : HardwareCommandsTest {
+    void TearDown() override {
+        kernel.reset();
+        program.reset();
+        HardwareCommandsTest::TearDown();
+    }
+
+    template <typename FamilyType>
+    void createKernel() {
+        using BINDING_TABLE_STATE = typename FamilyType::BINDING_TABLE_STATE;
+        using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+
+        bindingTableOffset = numSurfaces * sizeof(RENDER_SURFACE_STATE);
+        sshSize = bindingTableOffset + numSurfaces * sizeof(BINDING_TABLE_STATE);
+        surfaceStateHeap.reset(new uint8_t[sshSize]);
+        memset(surfaceStateHeap.get(), 0, sshSize);
+        auto bindingTable = reinterpret_cast<BINDING_TABLE_STATE *>(ptrOffset(surfaceStateHeap.get(), bindingTableOffset));
+        for (uint32_t i = 0; i < numSurfaces; ++i) {
+            bindingTable[i].setSurfaceStatePointer(i * sizeof(RENDER_SURFACE_STATE));
+        }
+
+        kernelInfo.heapInfo.pSsh = surfaceStateHeap.get();
+        kernelInfo.heapInfo.SurfaceStateHeapSize = static_cast<uint32_t>(sshSize);
+        bindingTableState.Token = iOpenCL::PATCH_TOKEN_BINDING_TABLE_STATE;
+        bindingTableState.Size = sizeof(SPatchBindingTableState);
+        bindingTableState.Count = numSurfaces;
+        bindingTableState.Offset = static_cast<uint32_t>(bindingTableOffset);
+        bindingTableState.SurfaceStateOffset = 0;
+        kernelInfo.patchInfo.bindingTableState = &bindingTableState;
+        kernelInfo.usesSsh = true;
+        kernelInfo.requiresSshForBuffers = true;
+
+        program = std::make_unique<MockProgram>(*pDevice->getExecutionEnvironment(), pContext, false, pDevice);
+        kernel.reset(new MockKernel(program.get(), kernelInfo, *pClDevice));
+        ASSERT_EQ(CL_SUCCESS, kernel->initialize());
+    }
+
+    static constexpr uint32_t numSurfaces = 4;
+    size_t bindingTableOffset = 0;
+    size_t sshSize = 0;
+    std::unique_ptr<uint8_t[]> surfaceStateHeap;
+    SPatchBindingTableState bindingTableState = {};
+    KernelInfo kernelInfo;
+    std::unique_ptr<MockProgram> program;
+    std::unique_ptr<MockKernel> kernel;
+};
+
+HWTEST_F(SurfaceStateHeapCacheTest, givenSurfaceStateHeapCacheEnabledWhenPushingUnchangedKernelTwiceThenHeapBlockIsReused) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSurfaceStateHeapCache.set(1);
+    createKernel<FamilyType>();
+
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::SURFACE_STATE, 8192);
+    ssh.getSpace(sizeof(typename FamilyType::RENDER_SURFACE_STATE));
+
+    auto bindingTablePointer = HardwareCommandsHelper<FamilyType>::pushKernelBindingTableAndSurfaceStates(ssh, *kernel);
+    auto usedAfterFirstPush = ssh.getUsed();
+    EXPECT_EQ(1u, kernel->getSurfaceStateHeapCache().getEntryCount());
+
+    EXPECT_EQ(bindingTablePointer, HardwareCommandsHelper<FamilyType>::pushKernelBindingTableAndSurfaceStates(ssh, *kernel));
+    EXPECT_EQ(usedAfterFirstPush, ssh.getUsed());
+    EXPECT_EQ(1u, kernel->getSurfaceStateHeapCache().getHitCount());
+    EXPECT_EQ(sshSize, kernel->getSurfaceStateHeapCache().getReusedHeapSize());
+}
+
+HWTEST_F(SurfaceStateHeapCacheTest, givenSurfaceStateHeapCacheEnabledWhenSurfaceStatesChangeThenNewBlockIsPushedAndPreviousContentIsStillFound) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSurfaceStateHeapCache.set(1);
+    createKernel<FamilyType>();
+
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::SURFACE_STATE, 8192);
+    auto localSurfaceState = reinterpret_cast<uint8_t *>(kernel->getSurfaceStateHeap());
+
+    auto firstBindingTablePointer = HardwareCommandsHelper<FamilyType>::pushKernelBindingTableAndSurfaceStates(ssh, *kernel);
+
+    localSurfaceState[0] ^= 0xff;
+    auto usedBeforeChangedPush = ssh.getUsed();
+    auto secondBindingTablePointer = HardwareCommandsHelper<FamilyType>::pushKernelBindingTableAndSurfaceStates(ssh, *kernel);
+    EXPECT_NE(firstBindingTablePointer, secondBindingTablePointer);
+    EXPECT_LT(usedBeforeChangedPush, ssh.getUsed());
+
+    auto bindingTable = reinterpret_cast<typename FamilyType::BINDING_TABLE_STATE *>(ptrOffset(ssh.getCpuBase(), secondBindingTablePointer));
+    auto surfaceStatesOffset = secondBindingTablePointer - bindingTableOffset;
+    for (uint32_t i = 0; i < numSurfaces; ++i) {
+        EXPECT_EQ(surfaceStatesOffset + i * sizeof(typename FamilyType::RENDER_SURFACE_STATE), bindingTable[i].getSurfaceStatePointer());
+    }
+
+    localSurfaceState[0] ^= 0xff;
+    auto usedBeforeRestoredPush = ssh.getUsed();
+    EXPECT_EQ(firstBindingTablePointer, HardwareCommandsHelper<FamilyType>::pushKernelBindingTableAndSurfaceStates(ssh, *kernel));
+    EXPECT_EQ(usedBeforeRestoredPush, ssh.getUsed());
+    EXPECT_EQ(2u, kernel->getSurfaceStateHeapCache().getEntryCount());
+}
+
+HWTEST_F(SurfaceStateHeapCacheTest, givenSurfaceStateHeapCacheEnabledWhenHeapIsReplacedThenSurfaceStatesArePushedAgain) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSurfaceStateHeapCache.set(1);
+    createKernel<FamilyType>();
+
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::SURFACE_STATE, 8192);
+
+    HardwareCommandsHelper<FamilyType>::pushKernelBindingTableAndSurfaceStates(ssh, *kernel);
+    ssh.replaceBuffer(ssh.getCpuBase(), ssh.getMaxAvailableSpace());
+    ssh.getSpace(sizeof(typename FamilyType::RENDER_SURFACE_STATE) + sshSize);
+
+    auto usedBeforePush = ssh.getUsed();
+    HardwareCommandsHelper<FamilyType>::pushKernelBindingTableAndSurfaceStates(ssh, *kernel);
+    EXPECT_LT(usedBeforePush, ssh.getUsed());
+    EXPECT_EQ(0u, kernel->getSurfaceStateHeapCache().getHitCount());
+}
+
+HWTEST_F(SurfaceStateHeapCacheTest, givenSurfaceStateHeapCacheDisabledWhenPushingUnchangedKernelTwiceThenSurfaceStatesArePushedTwice) {
+    createKernel<FamilyType>();
+
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::SURFACE_STATE, 8192);
+
+    auto firstBindingTablePointer = HardwareCommandsHelper<FamilyType>::pushKernelBindingTableAndSurfaceStates(ssh, *kernel);
+    auto secondBindingTablePointer = HardwareCommandsHelper<FamilyType>::pushKernelBindingTableAndSurfaceStates(ssh, *kernel);
+    EXPECT_NE(firstBindingTablePointer, secondBindingTablePointer);
+    EXPECT_EQ(0u, kernel->getSurfaceStateHeapCache().getEntryCount());
+}
+
+TEST(SurfaceStateHeapCacheEntriesTest, givenFullCacheWhenAddingEntryThenLeastRecentlyUsedEntryIsEvicted) {
+    char heapMemory[1024] = {};
+    IndirectHeap heap(heapMemory, sizeof(heapMemory));
+    heap.getSpace(sizeof(heapMemory));
+
+    SurfaceStateHeapCache cache;
+    for (size_t i = 0; i < SurfaceStateHeapCache::maxEntries + 1; i++) {
+        heapMemory[i * 64] = static_cast<char>(i + 1);
+        cache.add(heap, i * 64, i * 64 + 8, 16);
+    }
+    EXPECT_EQ(SurfaceStateHeapCache::maxEntries, cache.getEntryCount());
+
+    char surfaceStates[8] = {1};
+    EXPECT_EQ(nullptr, cache.find(heap, surfaceStates, 16, 8));
+    surfaceStates[0] = 2;
+    auto entry = cache.find(heap, surfaceStates, 16, 8);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ(64u, entry->surfaceStatesOffset);
+    EXPECT_EQ(1u, cache.getHitCount());
+}
+
+struct SizeEstimateCacheTest : HardwareCommandsTest {
+    void SetUp() override {
+        HardwareCommandsTest::SetUp();
+        kernel = mockKernelWithInternal->mockKernel;
+        mockKernelWithInternal->kernelInfo.usesSsh = true;
+        pushDispatch(64u);
+    }
+
+    void pushDispatch(size_t localWorkSize) {
+        multiDispatchInfo = std::make_unique<MultiDispatchInfo>(kernel);
+        DispatchInfo dispatchInfo(kernel, 1, {256, 1, 1}, {localWorkSize, 1, 1}, {0, 0, 0});
+        dispatchInfo.setLWS({localWorkSize, 1, 1});
+        multiDispatchInfo->push(dispatchInfo);
+    }
+
+    DebugManagerStateRestore restorer;
+    MockKernel *kernel = nullptr;
+    std::unique_ptr<MultiDispatchInfo> multiDispatchInfo;
+};
+
+HWTEST_F(SizeEstimateCacheTest, givenSizeEstimateCacheEnabledWhenEstimatingHeapSizesTwiceThenCachedEstimatesMatchFreshOnes) {
+    auto dshSize = HardwareCommandsHelper<FamilyType>::getTotalSizeRequiredDSH(*multiDispatchInfo);
+    auto iohSize = HardwareCommandsHelper<FamilyType>::getTotalSizeRequiredIOH(*multiDispatchInfo);
+    auto sshSize = HardwareCommandsHelper<FamilyType>::getTotalSizeRequiredSSH(*multiDispatchInfo);
+    auto &cache = kernel->getSizeEstimateCache();
+    EXPECT_EQ(0u, cache.getMissCount());
+
+    DebugManager.flags.EnableSizeEstimateCache.set(1);
+    for (uint32_t i = 0; i < 2; i++) {
+        EXPECT_EQ(dshSize, HardwareCommandsHelper<FamilyType>::getTotalSizeRequiredDSH(*multiDispatchInfo));
+        EXPECT_EQ(iohSize, HardwareCommandsHelper<FamilyType>::getTotalSizeRequiredIOH(*multiDispatchInfo));
+        EXPECT_EQ(sshSize, HardwareCommandsHelper<FamilyType>::getTotalSizeRequiredSSH(*multiDispatchInfo));
+    }
+    EXPECT_EQ(3u, cache.getMissCount());
+    EXPECT_EQ(3u, cache.getHitCount());
+}
+
+HWTEST_F(SizeEstimateCacheTest, givenSizeEstimateCacheEnabledWhenLocalWorkSizeChangesThenIohSizeIsEstimatedForNewShape) {
+    DebugManager.flags.EnableSizeEstimateCache.set(1);
+    auto &cache = kernel->getSizeEstimateCache();
+
+    for (auto localWorkSize : {64u, 128u, 64u}) {
+        pushDispatch(localWorkSize);
+        auto expectedSize = alignUp(HardwareCommandsHelper<FamilyType>::getSizeRequiredIOH(*kernel, localWorkSize), MemoryConstants::pageSize);
+        EXPECT_EQ(expectedSize, HardwareCommandsHelper<FamilyType>::getTotalSizeRequiredIOH(*multiDispatchInfo));
+    }
+    EXPECT_NE(HardwareCommandsHelper<FamilyType>::getSizeRequiredIOH(*kernel, 64u), HardwareCommandsHelper<FamilyType>::getSizeRequiredIOH(*kernel, 128u));
+    EXPECT_EQ(3u, cache.getMissCount());
+    EXPECT_EQ(0u, cache.getHitCount());
+}
+
+HWTEST_F(SizeEstimateCacheTest, givenSizeEstimateCacheEnabledWhenSurfaceStateHeapIsResizedThenSshSizeIsEstimatedAgain) {
+    DebugManager.flags.EnableSizeEstimateCache.set(1);
+    auto sshSizeBefore = HardwareCommandsHelper<FamilyType>::getSizeRequiredSSH(*kernel);
+    HardwareCommandsHelper<FamilyType>::getTotalSizeRequiredSSH(*multiDispatchInfo);
+
+    auto newSshSize = kernel->getSurfaceStateHeapSize() + MemoryConstants::pageSize;
+    kernel->resizeSurfaceStateHeap(new char[newSshSize], newSshSize, 0, 0);
+    auto sshSizeAfter = HardwareCommandsHelper<FamilyType>::getSizeRequiredSSH(*kernel);
+    EXPECT_LT(sshSizeBefore, sshSizeAfter);
+    EXPECT_EQ(alignUp(sshSizeAfter, MemoryConstants::pageSize), HardwareCommandsHelper<FamilyType>::getTotalSizeRequiredSSH(*multiDispatchInfo));
+    EXPECT_EQ(2u, kernel->getSizeEstimateCache().getMissCount());
+}
+
+HWTEST_F(SizeEstimateCacheTest, givenSizeEstimateCacheEnabledWhenEstimatingKernelCommandsTwiceThenCachedEstimateMatchesFreshOne) {
+    CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
+    auto expectedSize = EnqueueOperation<FamilyType>::getSizeRequiredCS(CL_COMMAND_NDRANGE_KERNEL, false, false, cmdQ, kernel);
+
+    DebugManager.flags.EnableSizeEstimateCache.set(1);
+    EXPECT_EQ(expectedSize, EnqueueOperation<FamilyType>::getSizeRequiredCS(CL_COMMAND_NDRANGE_KERNEL, false, false, cmdQ, kernel));
+    EXPECT_EQ(expectedSize, EnqueueOperation<FamilyType>::getSizeRequiredCS(CL_COMMAND_NDRANGE_KERNEL, false, false, cmdQ, kernel));
+    EXPECT_EQ(1u, kernel->getSizeEstimateCache().getHitCount());
+}
+
+HWTEST_F(SizeEstimateCacheTest, givenSizeEstimateVerificationEnabledWhenCachedEstimateIsStaleThenAbortIsCalled) {
+    SPatchSamplerStateArray samplerStateArray = {};
+    samplerStateArray.Count = 2;
+    samplerStateArray.Offset = 64;
+
+    DebugManager.flags.EnableSizeEstimateCache.set(2);
+    auto dshSize = HardwareCommandsHelper<FamilyType>::getTotalSizeRequiredDSH(*multiDispatchInfo);
+    EXPECT_EQ(dshSize, HardwareCommandsHelper<FamilyType>::getTotalSizeRequiredDSH(*multiDispatchInfo));
+
+    // Sampler states are not expected to change after kernel creation, so nothing invalidates cached estimate.
+    mockKernelWithInternal->kernelInfo.patchInfo.samplerStateArray = &samplerStateArray;
+    EXPECT_THROW(HardwareCommandsHelper<FamilyType>::getTotalSizeRequiredDSH(*multiDispatchInfo), std::exception);
+    mockKernelWithInternal->kernelInfo.patchInfo.samplerStateArray = nullptr;
+}
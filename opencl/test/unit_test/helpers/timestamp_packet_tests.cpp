@@ -541,6 +541,82 @@ HWTEST_F(TimestampPacketTests, givenEventsRequestWithEventsWithoutTimestampsWhen
     EXPECT_EQ(expectedSize, TimestampPacketHelper::getRequiredCmdStreamSize<FamilyType>(csrDepsSize3));
 }
 
+HWTEST_F(TimestampPacketTests, givenDependencyPruningEnabledWhenEventsOfInOrderQueueAreInWaitListThenOnlyLatestOneIsAddedToCsrDeps) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableTimestampPacketDependencyPruning.set(1);
+    device->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = true;
+    auto allocator = device->getGpgpuCommandStreamReceiver().getTimestampPacketAllocator();
+
+    cl_queue_properties properties[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, 0};
+    MockCommandQueueHw<FamilyType> ooq(context, device.get(), properties);
+
+    MockTimestampPacketContainer timestamp1(*allocator, 1);
+    MockTimestampPacketContainer timestamp2(*allocator, 1);
+    MockTimestampPacketContainer timestamp3(*allocator, 1);
+    MockTimestampPacketContainer timestamp4(*allocator, 1);
+    MockTimestampPacketContainer timestamp5(*allocator, 1);
+
+    Event event1(mockCmdQ, 0, 0, 1);
+    event1.addTimestampPacketNodes(timestamp1);
+    Event event2(mockCmdQ, 0, 0, 3);
+    event2.addTimestampPacketNodes(timestamp2);
+    Event event3(mockCmdQ, 0, 0, 2);
+    event3.addTimestampPacketNodes(timestamp3);
+    Event event4(&ooq, 0, 0, 4);
+    event4.addTimestampPacketNodes(timestamp4);
+    Event event5(&ooq, 0, 0, 5);
+    event5.addTimestampPacketNodes(timestamp5);
+
+    cl_event waitlist[] = {&event1, &event2, &event3, &event4, &event5};
+    EventsRequest eventsRequest(5u, waitlist, nullptr);
+    CsrDependencies csrDeps;
+    eventsRequest.fillCsrDependencies(csrDeps, device->getGpgpuCommandStreamReceiver(), CsrDependencies::DependenciesType::OnCsr);
+
+    ASSERT_EQ(3u, csrDeps.size());
+    EXPECT_EQ(event2.getTimestampPacketNodes(), csrDeps[0]);
+    EXPECT_EQ(event4.getTimestampPacketNodes(), csrDeps[1]);
+    EXPECT_EQ(event5.getTimestampPacketNodes(), csrDeps[2]);
+
+    DebugManager.flags.EnableTimestampPacketDependencyPruning.set(0);
+    CsrDependencies csrDepsWithoutPruning;
+    eventsRequest.fillCsrDependencies(csrDepsWithoutPruning, device->getGpgpuCommandStreamReceiver(), CsrDependencies::DependenciesType::OnCsr);
+    EXPECT_EQ(5u, csrDepsWithoutPruning.size());
+}
+
+HWTEST_F(TimestampPacketTests, givenDependencyPruningEnabledWhenProgrammingCsrDependenciesThenCompletedAndDuplicatedNodesAreNotWaitedFor) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableTimestampPacketDependencyPruning.set(1);
+    auto allocator = device->getGpgpuCommandStreamReceiver().getTimestampPacketAllocator();
+
+    MockTimestampPacketContainer timestamp1(*allocator, 2);
+    MockTimestampPacketContainer timestamp2(*allocator, 1);
+    timestamp2.assignAndIncrementNodesRefCounts(timestamp1);
+    auto completedNode = timestamp1.getNode(1);
+    completedNode->tagForCpuAccess->packets[0].contextEnd = 0u;
+    completedNode->tagForCpuAccess->packets[0].globalEnd = 0u;
+
+    CsrDependencies csrDeps;
+    csrDeps.push_back(&timestamp1);
+    csrDeps.push_back(&timestamp2);
+
+    auto expectedSize = TimestampPacketHelper::getRequiredCmdStreamSizeForNodeDependency<FamilyType>(*timestamp1.getNode(0)) +
+                        TimestampPacketHelper::getRequiredCmdStreamSizeForNodeDependency<FamilyType>(*timestamp2.getNode(0));
+    EXPECT_EQ(expectedSize, TimestampPacketHelper::getRequiredCmdStreamSize<FamilyType>(csrDeps));
+
+    StackVec<char, 4096> buffer(4096);
+    LinearStream cmdStream(buffer.begin(), buffer.size());
+    TimestampPacketHelper::programCsrDependencies<FamilyType>(cmdStream, csrDeps, 1u);
+    EXPECT_EQ(expectedSize, cmdStream.getUsed());
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(cmdStream, 0);
+    auto semaphores = findAll<MI_SEMAPHORE_WAIT *>(hwParser.cmdList.begin(), hwParser.cmdList.end());
+    ASSERT_EQ(2u, semaphores.size());
+    verifySemaphore(genCmdCast<MI_SEMAPHORE_WAIT *>(*(semaphores[0])), timestamp1.getNode(0), 0);
+    verifySemaphore(genCmdCast<MI_SEMAPHORE_WAIT *>(*(semaphores[1])), timestamp2.getNode(0), 0);
+}
+
 HWTEST_F(TimestampPacketTests, whenEstimatingSizeForNodeDependencyThenReturnCorrectValue) {
     TimestampPacketStorage tag;
     MockTagNode mockNode;
@@ -6,17 +6,29 @@
  */
 
 #include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/os_interface/linux/drm_device_probe.h"
 #include "shared/source/os_interface/linux/drm_null_device.h"
+#include "shared/test/unit_test/helpers/benchmark_runner.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+#include "shared/test/unit_test/helpers/memory_management.h"
 
 #include "opencl/test/unit_test/linux/drm_wrap.h"
 #include "opencl/test/unit_test/linux/mock_os_layer.h"
 #include "test.h"
 
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
 #include <memory>
+#include <string>
+#include <unistd.h>
 
 using namespace NEO;
 
+namespace {
+::testing::Environment *const benchmarkEnvironment = ::testing::AddGlobalTestEnvironment(new BenchmarkEnvironment);
+} // namespace
+
 class DrmNullDeviceTestsFixture {
   public:
     void SetUp() {
@@ -81,3 +93,45 @@ TEST_F(DrmNullDeviceTests, GIVENdrmNullDeviceWHENgetGpuTimestamp36bTHENproperVal
     ASSERT_EQ(drmNullDevice->ioctl(DRM_IOCTL_I915_REG_READ, &arg), 0);
     EXPECT_EQ(arg.val, 3000ULL);
 }
+
+// Host cost of device discovery and Drm creation on the null device, with render node probing in the
+// default serial path and with parallel probing and per boot probe cache enabled.
+TEST(DrmNullDeviceBenchmark, DISABLED_createDrm) {
+    // Benchmark results outlive the test.
+    MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableNullHardware.set(true);
+
+    char directoryTemplate[] = "/tmp/neo_probe_benchmarkXXXXXX";
+    ASSERT_NE(nullptr, mkdtemp(directoryTemplate));
+    std::string directory = directoryTemplate;
+    DebugManager.flags.DeviceProbeCacheDir.set(directory);
+
+    ExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    std::atomic<uint32_t> failures{0u};
+    auto createDrm = [&](uint32_t thread, uint32_t iteration) {
+        auto drm = DrmWrap::createDrm(*executionEnvironment.rootDeviceEnvironments[0]);
+        failures += (drm == nullptr);
+    };
+
+    const struct {
+        const char *name;
+        int32_t parallelProbe;
+        int32_t probeCache;
+    } configurations[] = {
+        {"discoverDevices+Drm::create(null device)", 0, 0},
+        {"discoverDevices+Drm::create(null device, parallel probe)", 1, 0},
+        {"discoverDevices+Drm::create(null device, probe cache)", 0, 1},
+        {"discoverDevices+Drm::create(null device, parallel probe, probe cache)", 1, 1},
+    };
+    for (auto &configuration : configurations) {
+        DebugManager.flags.EnableParallelDeviceProbe.set(configuration.parallelProbe);
+        DebugManager.flags.EnableDeviceProbeCache.set(configuration.probeCache);
+        BenchmarkRunner::run(configuration.name, 1u, createDrm, 100u, BenchmarkRunner::defaultRepetitions, 10u);
+    }
+    EXPECT_EQ(0u, failures.load());
+
+    std::remove((directory + "/" + DrmProbeCache::fileName).c_str());
+    rmdir(directory.c_str());
+}
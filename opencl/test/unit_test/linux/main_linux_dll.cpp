@@ -10,6 +10,7 @@
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/linux/allocator_helper.h"
+#include "shared/source/os_interface/linux/drm_device_probe.h"
 #include "shared/source/os_interface/linux/os_interface.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 #include "shared/test/unit_test/helpers/default_hw_info.inl"
@@ -26,7 +27,11 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include <cstdio>
+#include <fstream>
 #include <string>
+#include <sys/stat.h>
+#include <unistd.h>
 
 using namespace NEO;
 
@@ -461,3 +466,193 @@ TEST_F(DrmTests, whenCreateDrmIsCalledThenProperHwInfoIsSetup) {
     EXPECT_LT(0u, currentHwInfo->gtSystemInfo.EUCount);
     EXPECT_LT(0u, currentHwInfo->gtSystemInfo.SubSliceCount);
 }
+
+TEST(DrmDeviceProbeTest, givenParallelDeviceProbeEnabledWhenDiscoverDevicesThenEachHwDeviceIdHasProbe) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableParallelDeviceProbe.set(1);
+    VariableBackup<decltype(openFull)> backupOpenFull(&openFull);
+    openFull = openWithCounter;
+    openCounter = 2;
+    ExecutionEnvironment executionEnvironment;
+
+    auto hwDeviceIds = OSInterface::discoverDevices(executionEnvironment);
+    ASSERT_EQ(2u, hwDeviceIds.size());
+    for (auto &hwDeviceId : hwDeviceIds) {
+        auto probe = hwDeviceId->getProbe();
+        ASSERT_NE(nullptr, probe);
+        EXPECT_EQ(deviceId, probe->deviceId);
+        EXPECT_EQ(haveSoftPin, probe->hasExecSoftPin);
+        EXPECT_TRUE(probe->topologyValid);
+        EXPECT_EQ(1, probe->sliceCount);
+        EXPECT_EQ(1, probe->subSliceCount);
+        EXPECT_EQ(3, probe->euCount);
+    }
+}
+
+TEST(DrmDeviceProbeTest, givenDeviceProbeDisabledWhenDiscoverDevicesThenHwDeviceIdHasNoProbe) {
+    ExecutionEnvironment executionEnvironment;
+    auto hwDeviceIds = OSInterface::discoverDevices(executionEnvironment);
+    ASSERT_FALSE(hwDeviceIds.empty());
+    EXPECT_EQ(nullptr, hwDeviceIds[0]->getProbe());
+}
+
+TEST(DrmDeviceProbeTest, givenFailingTopologyQueryWhenProbingThenEuAndSubsliceTotalsAreProbed) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableParallelDeviceProbe.set(0);
+    DebugManager.flags.EnableDeviceProbeCache.set(0);
+
+    DrmDeviceProbe probe;
+    VariableBackup<decltype(failOnEuTotal)> backupFailOnEuTotal(&failOnEuTotal);
+    failOnEuTotal = 1;
+    EXPECT_FALSE(DrmDeviceProbe::probe(fakeFd, probe));
+
+    failOnEuTotal = 0;
+    VariableBackup<decltype(failOnDeviceId)> backupFailOnDeviceId(&failOnDeviceId);
+    failOnDeviceId = 1;
+    EXPECT_FALSE(DrmDeviceProbe::probe(fakeFd, probe));
+}
+
+TEST_F(DrmTests, givenProbedDeviceWhenCreatingDrmThenFewerIoctlsAreIssued) {
+    VariableBackup<decltype(ioctlCnt)> backupIoctlCnt(&ioctlCnt);
+
+    auto hwDeviceIds = OSInterface::discoverDevices(executionEnvironment);
+    ASSERT_FALSE(hwDeviceIds.empty());
+    ioctlCnt = 0;
+    std::unique_ptr<Drm> drm{Drm::create(std::move(hwDeviceIds[0]), *rootDeviceEnvironment)};
+    ASSERT_NE(nullptr, drm);
+    auto ioctlCountWithoutProbe = ioctlCnt;
+
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableParallelDeviceProbe.set(1);
+    hwDeviceIds = OSInterface::discoverDevices(executionEnvironment);
+    ASSERT_FALSE(hwDeviceIds.empty());
+    ASSERT_NE(nullptr, hwDeviceIds[0]->getProbe());
+    ioctlCnt = 0;
+    drm.reset(Drm::create(std::move(hwDeviceIds[0]), *rootDeviceEnvironment));
+    ASSERT_NE(nullptr, drm);
+    EXPECT_LT(ioctlCnt, ioctlCountWithoutProbe);
+
+    int value = 0;
+    EXPECT_EQ(0, drm->getDeviceID(value));
+    EXPECT_EQ(deviceId, value);
+    EXPECT_EQ(0, drm->getExecSoftPin(value));
+    EXPECT_EQ(haveSoftPin, value);
+}
+
+class DrmProbeCacheTest : public ::testing::Test {
+  public:
+    void SetUp() override {
+        char directoryTemplate[] = "/tmp/neo_probe_cacheXXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(directoryTemplate));
+        directory = directoryTemplate;
+        filePath = directory + "/" + DrmProbeCache::fileName;
+    }
+
+    void TearDown() override {
+        std::remove(filePath.c_str());
+        rmdir(directory.c_str());
+    }
+
+    std::string directory;
+    std::string filePath;
+};
+
+TEST_F(DrmProbeCacheTest, givenSavedCacheWhenLoadingWithSameBootIdThenEntriesAreFound) {
+    DrmDeviceProbe probe;
+    probe.deviceId = 0x1234;
+    probe.revisionId = 3;
+    probe.hasExecSoftPin = 1;
+    probe.topologyValid = true;
+    probe.sliceCount = 1;
+    probe.subSliceCount = 6;
+    probe.euCount = 48;
+    probe.gttSizeValid = true;
+    probe.gttSize = 1ull << 47;
+
+    DrmProbeCache cache(directory, "boot1");
+    EXPECT_FALSE(cache.load());
+    cache.add("pci/128/i915-1.6.0-20200515", probe);
+    EXPECT_TRUE(cache.save());
+
+    struct stat fileStat = {};
+    ASSERT_EQ(0, stat(filePath.c_str(), &fileStat));
+    EXPECT_EQ(static_cast<mode_t>(S_IRUSR | S_IWUSR), fileStat.st_mode & 0777);
+
+    DrmProbeCache loadedCache(directory, "boot1");
+    EXPECT_TRUE(loadedCache.load());
+    EXPECT_EQ(1u, loadedCache.size());
+
+    DrmDeviceProbe loadedProbe;
+    EXPECT_FALSE(loadedCache.find("pci/129/i915-1.6.0-20200515", loadedProbe));
+    ASSERT_TRUE(loadedCache.find("pci/128/i915-1.6.0-20200515", loadedProbe));
+    EXPECT_EQ(probe.deviceId, loadedProbe.deviceId);
+    EXPECT_EQ(probe.revisionId, loadedProbe.revisionId);
+    EXPECT_EQ(probe.hasExecSoftPin, loadedProbe.hasExecSoftPin);
+    EXPECT_EQ(probe.topologyValid, loadedProbe.topologyValid);
+    EXPECT_EQ(probe.subSliceCount, loadedProbe.subSliceCount);
+    EXPECT_EQ(probe.euCount, loadedProbe.euCount);
+    EXPECT_EQ(probe.gttSize, loadedProbe.gttSize);
+}
+
+TEST_F(DrmProbeCacheTest, givenCacheFromOtherBootWhenLoadingThenItIsRejected) {
+    DrmProbeCache cache(directory, "boot1");
+    cache.add("key", DrmDeviceProbe{});
+    ASSERT_TRUE(cache.save());
+
+    DrmProbeCache otherBootCache(directory, "boot2");
+    EXPECT_FALSE(otherBootCache.load());
+    EXPECT_EQ(0u, otherBootCache.size());
+}
+
+TEST_F(DrmProbeCacheTest, givenCacheWithOtherFormatVersionWhenLoadingThenItIsRejected) {
+    {
+        std::ofstream file(filePath);
+        file << DrmProbeCache::formatVersion + 1 << " boot1\n"
+             << "key 1 0 1 1 1 1 1 0 0\n";
+    }
+    chmod(filePath.c_str(), S_IRUSR | S_IWUSR);
+
+    DrmProbeCache cache(directory, "boot1");
+    EXPECT_FALSE(cache.load());
+    EXPECT_EQ(0u, cache.size());
+}
+
+TEST_F(DrmProbeCacheTest, givenCacheWritableByOthersWhenLoadingThenItIsRejected) {
+    DrmProbeCache cache(directory, "boot1");
+    cache.add("key", DrmDeviceProbe{});
+    ASSERT_TRUE(cache.save());
+    chmod(filePath.c_str(), S_IRUSR | S_IWUSR | S_IWOTH);
+
+    DrmProbeCache loadedCache(directory, "boot1");
+    EXPECT_FALSE(loadedCache.load());
+}
+
+TEST_F(DrmProbeCacheTest, givenDeviceProbeCacheEnabledWhenDiscoveringDevicesAgainThenProbeIsTakenFromCache) {
+    if (DrmProbeCache::readBootId().empty()) {
+        GTEST_SKIP();
+    }
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.EnableDeviceProbeCache.set(1);
+    DebugManager.flags.DeviceProbeCacheDir.set(directory);
+    VariableBackup<decltype(ioctlCnt)> backupIoctlCnt(&ioctlCnt);
+    ExecutionEnvironment executionEnvironment;
+
+    ioctlCnt = 0;
+    auto hwDeviceIds = OSInterface::discoverDevices(executionEnvironment);
+    ASSERT_FALSE(hwDeviceIds.empty());
+    ASSERT_NE(nullptr, hwDeviceIds[0]->getProbe());
+    auto ioctlCountWithoutCache = ioctlCnt;
+
+    DrmProbeCache cache(directory, DrmProbeCache::readBootId());
+    EXPECT_TRUE(cache.load());
+    EXPECT_EQ(hwDeviceIds.size(), cache.size());
+
+    ioctlCnt = 0;
+    hwDeviceIds = OSInterface::discoverDevices(executionEnvironment);
+    ASSERT_FALSE(hwDeviceIds.empty());
+    auto probe = hwDeviceIds[0]->getProbe();
+    ASSERT_NE(nullptr, probe);
+    EXPECT_LT(ioctlCnt, ioctlCountWithoutCache);
+    EXPECT_EQ(deviceId, probe->deviceId);
+    EXPECT_EQ(3, probe->euCount);
+}
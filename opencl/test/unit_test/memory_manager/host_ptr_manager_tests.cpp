@@ -785,6 +785,79 @@ TEST(HostPtrManager, GivenHostPtrManagerFilledWithFragmentsWhenAskedForOverlapin
     EXPECT_NE(nullptr, fragment3);
 }
 
+TEST(HostPtrManager, GivenFragmentCrossingRegionBoundaryWhenStoredThenItIsFoundFromEveryPageItCovers) {
+    auto regionSize = static_cast<size_t>(1) << MockHostPtrManager::regionSizeShift;
+    FragmentStorage fragment;
+    fragment.fragmentCpuPointer = reinterpret_cast<void *>(regionSize - MemoryConstants::pageSize);
+    fragment.fragmentSize = 2 * MemoryConstants::pageSize;
+    MockHostPtrManager hostPtrManager;
+    hostPtrManager.storeFragment(fragment);
+    EXPECT_EQ(1u, hostPtrManager.spanningFragments.size());
+    EXPECT_EQ(1u, hostPtrManager.getFragmentCount());
+
+    auto storedFragment = hostPtrManager.getFragment(fragment.fragmentCpuPointer);
+    ASSERT_NE(nullptr, storedFragment);
+    auto pageInNextRegion = reinterpret_cast<void *>(regionSize);
+    EXPECT_EQ(storedFragment, hostPtrManager.getFragment(pageInNextRegion));
+
+    OverlapStatus overlapStatus;
+    EXPECT_EQ(storedFragment, hostPtrManager.getFragmentAndCheckForOverlaps(pageInNextRegion, MemoryConstants::pageSize, overlapStatus));
+    EXPECT_EQ(OverlapStatus::FRAGMENT_WITHIN_STORED_FRAGMENT, overlapStatus);
+
+    EXPECT_EQ(nullptr, hostPtrManager.getFragmentAndCheckForOverlaps(pageInNextRegion, 2 * MemoryConstants::pageSize, overlapStatus));
+    EXPECT_EQ(OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT, overlapStatus);
+
+    hostPtrManager.storeFragment(fragment);
+    EXPECT_EQ(2, storedFragment->refCount);
+    EXPECT_FALSE(hostPtrManager.releaseHostPtr(pageInNextRegion));
+    EXPECT_TRUE(hostPtrManager.releaseHostPtr(fragment.fragmentCpuPointer));
+    EXPECT_EQ(0u, hostPtrManager.getFragmentCount());
+}
+
+TEST(HostPtrManager, GivenFragmentsInDifferentRegionsWhenStoredThenTheyAreTrackedInSeparateStripes) {
+    auto regionSize = static_cast<size_t>(1) << MockHostPtrManager::regionSizeShift;
+    FragmentStorage fragment1;
+    fragment1.fragmentCpuPointer = reinterpret_cast<void *>(regionSize);
+    fragment1.fragmentSize = MemoryConstants::pageSize;
+    FragmentStorage fragment2;
+    fragment2.fragmentCpuPointer = reinterpret_cast<void *>(2 * regionSize);
+    fragment2.fragmentSize = MemoryConstants::pageSize;
+    MockHostPtrManager hostPtrManager;
+    hostPtrManager.storeFragment(fragment1);
+    hostPtrManager.storeFragment(fragment2);
+
+    auto &stripe1 = hostPtrManager.stripes[hostPtrManager.getRegion(fragment1.fragmentCpuPointer) % MockHostPtrManager::stripeCount];
+    auto &stripe2 = hostPtrManager.stripes[hostPtrManager.getRegion(fragment2.fragmentCpuPointer) % MockHostPtrManager::stripeCount];
+    EXPECT_NE(&stripe1, &stripe2);
+    EXPECT_EQ(1u, stripe1.fragments.size());
+    EXPECT_EQ(1u, stripe2.fragments.size());
+    EXPECT_EQ(0u, hostPtrManager.spanningFragments.size());
+    EXPECT_EQ(2u, hostPtrManager.getFragmentCount());
+
+    EXPECT_TRUE(hostPtrManager.releaseHostPtr(fragment1.fragmentCpuPointer));
+    EXPECT_EQ(nullptr, hostPtrManager.getFragment(fragment1.fragmentCpuPointer));
+    EXPECT_NE(nullptr, hostPtrManager.getFragment(fragment2.fragmentCpuPointer));
+    EXPECT_TRUE(hostPtrManager.releaseHostPtr(fragment2.fragmentCpuPointer));
+    EXPECT_EQ(0u, hostPtrManager.getFragmentCount());
+}
+
+TEST(HostPtrManager, GivenRangeCrossingRegionBoundaryWhenFragmentOfOneRegionIsWithinItThenBiggerOverlapIsReturned) {
+    auto regionSize = static_cast<size_t>(1) << MockHostPtrManager::regionSizeShift;
+    FragmentStorage fragment;
+    fragment.fragmentCpuPointer = reinterpret_cast<void *>(regionSize);
+    fragment.fragmentSize = MemoryConstants::pageSize;
+    MockHostPtrManager hostPtrManager;
+    hostPtrManager.storeFragment(fragment);
+
+    OverlapStatus overlapStatus;
+    auto rangeStart = reinterpret_cast<void *>(regionSize - MemoryConstants::pageSize);
+    EXPECT_EQ(nullptr, hostPtrManager.getFragmentAndCheckForOverlaps(rangeStart, 3 * MemoryConstants::pageSize, overlapStatus));
+    EXPECT_EQ(OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT, overlapStatus);
+
+    EXPECT_EQ(nullptr, hostPtrManager.getFragmentAndCheckForOverlaps(rangeStart, MemoryConstants::pageSize, overlapStatus));
+    EXPECT_EQ(OverlapStatus::FRAGMENT_NOT_OVERLAPING_WITH_ANY_OTHER, overlapStatus);
+}
+
 using HostPtrAllocationTest = Test<MemoryManagerWithCsrFixture>;
 
 TEST_F(HostPtrAllocationTest, givenTwoAllocationsThatSharesOneFragmentWhenOneIsDestroyedThenFragmentRemains) {
@@ -270,3 +270,175 @@ TEST_F(InternalAllocationStorageTest, givenAllocationListWhenTwoThreadsCleanConc
 
     EXPECT_TRUE(csr->getTemporaryAllocations().peekIsEmpty());
 }
+
+TEST_F(InternalAllocationStorageTest, whenObtainingReusableAllocationsThenHitsAndMissesAreCounted) {
+    auto initialCounters = storage->getReuseCounters();
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 2u);
+
+    *csr->getTagAddress() = 1u;
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER));
+    *csr->getTagAddress() = 2u;
+    auto reusedAllocation = storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(allocation, reusedAllocation.get());
+
+    auto counters = storage->getReuseCounters();
+    EXPECT_EQ(initialCounters.hits + 1, counters.hits);
+    EXPECT_EQ(initialCounters.misses + 1, counters.misses);
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+}
+
+struct InternalAllocationStorageWithIndexTest : public InternalAllocationStorageTest {
+    void SetUp() override {
+        DebugManager.flags.EnableReusableAllocationsIndex.set(1);
+        InternalAllocationStorageTest::SetUp();
+        index = storage->getReusableAllocationsIndex();
+        ASSERT_NE(nullptr, index);
+    }
+
+    GraphicsAllocation *storeReusable(size_t size, GraphicsAllocation::AllocationType allocationType, uint32_t taskCount) {
+        auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, size, allocationType});
+        storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, taskCount);
+        return allocation;
+    }
+
+    DebugManagerStateRestore stateRestorer;
+    ReusableAllocationsIndex *index = nullptr;
+};
+
+TEST_F(InternalAllocationStorageTest, givenDefaultSettingsThenReusableAllocationsIndexIsNotCreated) {
+    EXPECT_EQ(nullptr, storage->getReusableAllocationsIndex());
+}
+
+TEST_F(InternalAllocationStorageWithIndexTest, whenReusableAllocationIsStoredThenItIsIndexedInsteadOfListed) {
+    auto initialCounters = storage->getReuseCounters();
+    auto allocation = storeReusable(MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, 2u);
+
+    EXPECT_TRUE(csr->getAllocationsForReuse().peekIsEmpty());
+    EXPECT_EQ(1u, index->getAllocationsCount());
+    EXPECT_EQ(allocation->getUnderlyingBufferSize(), index->getRetainedSize());
+
+    *csr->getTagAddress() = 1u;
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER));
+
+    *csr->getTagAddress() = 2u;
+    EXPECT_EQ(nullptr, storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::INTERNAL_HEAP));
+    auto reusedAllocation = storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(allocation, reusedAllocation.get());
+    EXPECT_EQ(0u, index->getAllocationsCount());
+    EXPECT_EQ(0u, index->getRetainedSize());
+
+    auto counters = storage->getReuseCounters();
+    EXPECT_EQ(initialCounters.hits + 1, counters.hits);
+    EXPECT_EQ(initialCounters.misses + 2, counters.misses);
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+}
+
+TEST_F(InternalAllocationStorageWithIndexTest, whenObtainingReusableAllocationThenSmallestSufficientSizeClassIsUsed) {
+    auto smallAllocation = storeReusable(MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, 0u);
+    auto largeAllocation = storeReusable(MemoryConstants::pageSize64k, GraphicsAllocation::AllocationType::BUFFER, 0u);
+    *csr->getTagAddress() = 0u;
+
+    auto reusedAllocation = storage->obtainReusableAllocation(MemoryConstants::pageSize + 1, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(largeAllocation, reusedAllocation.get());
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+
+    reusedAllocation = storage->obtainReusableAllocation(1, GraphicsAllocation::AllocationType::BUFFER);
+    EXPECT_EQ(smallAllocation, reusedAllocation.get());
+    memoryManager->freeGraphicsMemory(reusedAllocation.release());
+}
+
+TEST_F(InternalAllocationStorageWithIndexTest, whenCleanAllocationListIsCalledThenOnlyCompletedIndexedAllocationsAreReleased) {
+    storeReusable(MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, 5u);
+    storeReusable(MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, 10u);
+    storeReusable(MemoryConstants::pageSize, GraphicsAllocation::AllocationType::INTERNAL_HEAP, 15u);
+    EXPECT_EQ(3u, index->getAllocationsCount());
+
+    storage->cleanAllocationList(10u, REUSABLE_ALLOCATION);
+    EXPECT_EQ(1u, index->getAllocationsCount());
+
+    storage->cleanAllocationList(15u, REUSABLE_ALLOCATION);
+    EXPECT_EQ(0u, index->getAllocationsCount());
+}
+
+TEST_F(InternalAllocationStorageWithIndexTest, givenRetainedSizeLimitWhenCompletedAllocationsExceedItThenTheyAreTrimmed) {
+    DebugManager.flags.ReusableAllocationsMaxRetainedSize.set(static_cast<int32_t>(MemoryConstants::pageSize));
+    std::unique_ptr<InternalAllocationStorage> limitedStorage = std::make_unique<InternalAllocationStorage>(*csr);
+    auto limitedIndex = limitedStorage->getReusableAllocationsIndex();
+    ASSERT_NE(nullptr, limitedIndex);
+    EXPECT_EQ(MemoryConstants::pageSize, limitedIndex->getMaxRetainedSize());
+
+    *csr->getTagAddress() = 1u;
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    limitedStorage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 1u);
+    EXPECT_EQ(1u, limitedIndex->getAllocationsCount());
+
+    allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    limitedStorage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 1u);
+    EXPECT_EQ(1u, limitedIndex->getAllocationsCount());
+
+    // allocations still in use are never trimmed
+    allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    limitedStorage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION, 2u);
+    EXPECT_EQ(1u, limitedIndex->getAllocationsCount());
+    EXPECT_EQ(MemoryConstants::pageSize, limitedIndex->getRetainedSize());
+
+    auto counters = limitedStorage->getReuseCounters();
+    EXPECT_EQ(2u, counters.trimmedAllocations);
+    EXPECT_EQ(2 * MemoryConstants::pageSize, counters.trimmedBytes);
+
+    limitedStorage->cleanAllocationList(-1, REUSABLE_ALLOCATION);
+}
+
+TEST(ReusableAllocationsIndexTest, whenAllocationsAreStoredOutOfOrderThenTheyAreObtainedInTaskCountOrder) {
+    ReusableAllocationsIndex index(MemoryConstants::megaByte);
+    MockGraphicsAllocation allocation1(nullptr, MemoryConstants::pageSize);
+    MockGraphicsAllocation allocation2(nullptr, MemoryConstants::pageSize);
+
+    index.store(&allocation1, 5u);
+    index.store(&allocation2, 3u);
+
+    EXPECT_EQ(nullptr, index.obtain(1, allocation1.getAllocationType(), 2u));
+    EXPECT_EQ(&allocation2, index.obtain(1, allocation1.getAllocationType(), 5u));
+    EXPECT_EQ(&allocation1, index.obtain(1, allocation1.getAllocationType(), 5u));
+    EXPECT_EQ(nullptr, index.obtain(1, allocation1.getAllocationType(), 5u));
+}
+
+TEST(ReusableAllocationsIndexTest, givenRetainedSizeOverLimitWhenDetachingThenLargestSizeClassIsDetachedFirstRegardlessOfAllocationType) {
+    ReusableAllocationsIndex index(MemoryConstants::pageSize64k);
+    MockGraphicsAllocation largeAllocation(nullptr, MemoryConstants::pageSize64k);
+    MockGraphicsAllocation smallAllocation(nullptr, MemoryConstants::pageSize);
+    largeAllocation.setAllocationType(GraphicsAllocation::AllocationType::BUFFER);
+    smallAllocation.setAllocationType(GraphicsAllocation::AllocationType::INTERNAL_HEAP);
+
+    index.store(&largeAllocation, 1u);
+    index.store(&smallAllocation, 1u);
+
+    std::vector<GraphicsAllocation *> detached;
+    index.detachOverLimit(1u, detached);
+    ASSERT_EQ(1u, detached.size());
+    EXPECT_EQ(&largeAllocation, detached[0]);
+    EXPECT_EQ(MemoryConstants::pageSize, index.getRetainedSize());
+
+    index.detachCompleted(1u, detached);
+    EXPECT_EQ(0u, index.getAllocationsCount());
+}
+
+TEST_F(InternalAllocationStorageWithIndexTest, whenCleaningReusableAllocationsThenLegacyListIsNotWalked) {
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER});
+    allocation->updateTaskCount(1u, csr->getOsContext().getContextId());
+    csr->getAllocationsForReuse().pushTailOne(*allocation);
+
+    storage->cleanAllocationList(1u, REUSABLE_ALLOCATION);
+    EXPECT_FALSE(csr->getAllocationsForReuse().peekIsEmpty());
+
+    memoryManager->freeGraphicsMemory(csr->getAllocationsForReuse().detachNodes());
+}
+
+TEST(ReusableAllocationsIndexTest, whenCalculatingSizeClassThenFloorOfLog2IsReturned) {
+    EXPECT_EQ(0u, ReusableAllocationsIndex::getSizeClass(0u));
+    EXPECT_EQ(0u, ReusableAllocationsIndex::getSizeClass(1u));
+    EXPECT_EQ(12u, ReusableAllocationsIndex::getSizeClass(MemoryConstants::pageSize));
+    EXPECT_EQ(12u, ReusableAllocationsIndex::getSizeClass(MemoryConstants::pageSize + 1));
+    EXPECT_EQ(16u, ReusableAllocationsIndex::getSizeClass(MemoryConstants::pageSize64k));
+}
@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/memory_manager/allocations_list.h"
+#include "shared/source/memory_manager/unified_memory_pool.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 #include "shared/test/unit_test/mocks/mock_device.h"
 #include "shared/test/unit_test/mocks/ult_device_factory.h"
@@ -14,8 +15,10 @@
 
 #include "opencl/source/api/api.h"
 #include "opencl/source/mem_obj/mem_obj_helper.h"
+#include "opencl/test/unit_test/fixtures/memory_manager_fixture.h"
 #include "opencl/test/unit_test/mocks/mock_command_queue.h"
 #include "opencl/test/unit_test/mocks/mock_context.h"
+#include "opencl/test/unit_test/mocks/mock_csr.h"
 #include "opencl/test/unit_test/mocks/mock_execution_environment.h"
 #include "opencl/test/unit_test/mocks/mock_graphics_allocation.h"
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
@@ -25,6 +28,8 @@
 
 #include "gtest/gtest.h"
 
+#include <thread>
+
 using namespace NEO;
 
 template <bool enableLocalMemory>
@@ -918,3 +923,252 @@ TEST(UnfiedSharedMemoryTransferCalls, givenSharedUsmAllocationWithLocalMemoryWhe
     ASSERT_EQ(CL_SUCCESS, status);
     clReleaseCommandQueue(commandQueue);
 }
+
+struct UnifiedMemoryPoolingTest : public SVMMemoryAllocatorTest {
+    void SetUp() override {
+        DebugManager.flags.EnableUnifiedMemoryPooling.set(1);
+        SVMMemoryAllocatorTest::SetUp();
+        deviceProperties.memoryType = InternalMemoryType::DEVICE_UNIFIED_MEMORY;
+        deviceProperties.subdeviceBitfield = mockDeviceBitfield;
+    }
+
+    DebugManagerStateRestore restorer;
+    SVMAllocsManager::UnifiedMemoryProperties deviceProperties;
+};
+
+TEST_F(UnifiedMemoryPoolingTest, givenPoolingDisabledWhenSmallDeviceAllocationIsCreatedThenItIsNotPooled) {
+    DebugManager.flags.EnableUnifiedMemoryPooling.set(0);
+    auto ptr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 64u, deviceProperties);
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptr)->pool);
+    EXPECT_EQ(0u, svmManager->getNumUnifiedMemoryPools());
+    svmManager->freeSVMAlloc(ptr);
+}
+
+TEST_F(UnifiedMemoryPoolingTest, whenSmallDeviceAllocationsAreCreatedThenTheyShareSinglePoolAllocation) {
+    auto ptr1 = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 64u, deviceProperties);
+    auto ptr2 = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 1000u, deviceProperties);
+    ASSERT_NE(nullptr, ptr1);
+    ASSERT_NE(nullptr, ptr2);
+    EXPECT_NE(ptr1, ptr2);
+    EXPECT_TRUE(isAligned<UnifiedMemoryPool::subAllocationAlignment>(ptr1));
+    EXPECT_TRUE(isAligned<UnifiedMemoryPool::subAllocationAlignment>(ptr2));
+
+    auto allocData1 = svmManager->getSVMAlloc(ptr1);
+    auto allocData2 = svmManager->getSVMAlloc(ptr2);
+    ASSERT_NE(nullptr, allocData1);
+    ASSERT_NE(nullptr, allocData2);
+    EXPECT_NE(allocData1, allocData2);
+    EXPECT_EQ(allocData1->gpuAllocation, allocData2->gpuAllocation);
+    EXPECT_EQ(UnifiedMemoryPool::chunkSize, allocData1->gpuAllocation->getUnderlyingBufferSize());
+    EXPECT_EQ(GraphicsAllocation::AllocationType::BUFFER, allocData1->gpuAllocation->getAllocationType());
+    EXPECT_EQ(castToUint64(ptr1), allocData1->getGpuAddress());
+    EXPECT_EQ(64u, allocData1->size);
+    EXPECT_EQ(1u, svmManager->getNumUnifiedMemoryPools());
+    EXPECT_EQ(2u, svmManager->getNumAllocs());
+
+    svmManager->freeSVMAlloc(ptr1);
+    svmManager->freeSVMAlloc(ptr2);
+    EXPECT_EQ(0u, svmManager->getNumAllocs());
+    EXPECT_EQ(1u, svmManager->getNumUnifiedMemoryPools());
+}
+
+TEST_F(UnifiedMemoryPoolingTest, whenLookingUpPointerInsidePooledAllocationThenOnlyThatAllocationIsReturned) {
+    auto ptr1 = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 100u, deviceProperties);
+    auto ptr2 = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 100u, deviceProperties);
+    auto allocData1 = svmManager->getSVMAlloc(ptr1);
+    ASSERT_NE(nullptr, allocData1);
+
+    EXPECT_EQ(allocData1, svmManager->getSVMAlloc(ptrOffset(ptr1, 99u)));
+    auto gapPtr = ptrOffset(ptr1, 100u);
+    if (gapPtr != ptr2) {
+        EXPECT_EQ(nullptr, svmManager->getSVMAlloc(gapPtr));
+    }
+    EXPECT_EQ(svmManager->getSVMAlloc(ptr2), svmManager->getSVMAlloc(ptrOffset(ptr2, 1u)));
+
+    svmManager->freeSVMAlloc(ptr1);
+    svmManager->freeSVMAlloc(ptr2);
+}
+
+TEST_F(UnifiedMemoryPoolingTest, givenPooledAllocationsWhenAddingToResidencyContainerThenPoolAllocationIsAddedOnce) {
+    auto ptr1 = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 100u, deviceProperties);
+    auto ptr2 = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 100u, deviceProperties);
+
+    ResidencyContainer residencyContainer;
+    svmManager->addInternalAllocationsToResidencyContainer(residencyContainer, InternalMemoryType::DEVICE_UNIFIED_MEMORY);
+    ASSERT_EQ(1u, residencyContainer.size());
+    EXPECT_EQ(svmManager->getSVMAlloc(ptr1)->gpuAllocation, residencyContainer[0]);
+
+    svmManager->freeSVMAlloc(ptr1);
+    svmManager->freeSVMAlloc(ptr2);
+}
+
+TEST_F(UnifiedMemoryPoolingTest, givenDifferentMemoryTypesOrLargeSizesWhenAllocatingThenSeparatePoolsOrDedicatedAllocationsAreUsed) {
+    SVMAllocsManager::UnifiedMemoryProperties hostProperties(InternalMemoryType::HOST_UNIFIED_MEMORY);
+    hostProperties.subdeviceBitfield = mockDeviceBitfield;
+
+    auto devicePtr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 100u, deviceProperties);
+    auto hostPtr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 100u, hostProperties);
+    auto largePtr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, UnifiedMemoryPool::maxPooledSize + 1, deviceProperties);
+
+    deviceProperties.alignment = 2 * UnifiedMemoryPool::subAllocationAlignment;
+    auto overAlignedPtr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 100u, deviceProperties);
+
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(devicePtr)->pool);
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(hostPtr)->pool);
+    EXPECT_NE(svmManager->getSVMAlloc(devicePtr)->gpuAllocation, svmManager->getSVMAlloc(hostPtr)->gpuAllocation);
+    EXPECT_EQ(GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY, svmManager->getSVMAlloc(hostPtr)->gpuAllocation->getAllocationType());
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(largePtr)->pool);
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(overAlignedPtr)->pool);
+    EXPECT_EQ(2u, svmManager->getNumUnifiedMemoryPools());
+
+    svmManager->freeSVMAlloc(devicePtr);
+    svmManager->freeSVMAlloc(hostPtr);
+    svmManager->freeSVMAlloc(largePtr);
+    svmManager->freeSVMAlloc(overAlignedPtr);
+}
+
+TEST_F(UnifiedMemoryPoolingTest, whenPoolIsExhaustedThenNewPoolIsCreatedAndReleasedOnceEmpty) {
+    std::vector<void *> pointers;
+    auto allocationsPerPool = UnifiedMemoryPool::chunkSize / UnifiedMemoryPool::maxPooledSize;
+    for (size_t i = 0; i < allocationsPerPool + 1; i++) {
+        auto ptr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, UnifiedMemoryPool::maxPooledSize, deviceProperties);
+        ASSERT_NE(nullptr, ptr);
+        pointers.push_back(ptr);
+    }
+    EXPECT_EQ(2u, svmManager->getNumUnifiedMemoryPools());
+
+    svmManager->freeSVMAlloc(pointers.back());
+    pointers.pop_back();
+    EXPECT_EQ(1u, svmManager->getNumUnifiedMemoryPools());
+
+    for (auto ptr : pointers) {
+        svmManager->freeSVMAlloc(ptr);
+    }
+    EXPECT_EQ(1u, svmManager->getNumUnifiedMemoryPools());
+    EXPECT_EQ(0u, svmManager->getNumAllocs());
+}
+
+TEST_F(UnifiedMemoryPoolingTest, whenPooledAllocationIsFreedThenItsMemoryIsReused) {
+    auto ptr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 100u, deviceProperties);
+    svmManager->freeSVMAlloc(ptr);
+    auto reusedPtr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 100u, deviceProperties);
+    EXPECT_EQ(ptr, reusedPtr);
+    EXPECT_EQ(1u, svmManager->unifiedMemoryPools[0]->getSubAllocationsCount());
+    EXPECT_EQ(UnifiedMemoryPool::subAllocationAlignment, svmManager->unifiedMemoryPools[0]->getUsedSize());
+    svmManager->freeSVMAlloc(reusedPtr);
+}
+
+TEST_F(UnifiedMemoryPoolingTest, whenSmallAllocationsAreCreatedConcurrentlyThenSinglePoolIsCreated) {
+    constexpr uint32_t threadCount = 4u;
+    constexpr uint32_t allocationsPerThread = 4u;
+    std::vector<void *> pointers[threadCount];
+    std::vector<std::thread> threads;
+    for (uint32_t thread = 0; thread < threadCount; thread++) {
+        threads.emplace_back([&, thread] {
+            for (uint32_t i = 0; i < allocationsPerThread; i++) {
+                pointers[thread].push_back(svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 100u, deviceProperties));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(1u, svmManager->getNumUnifiedMemoryPools());
+    EXPECT_EQ(threadCount * allocationsPerThread, svmManager->getNumAllocs());
+    for (auto &threadPointers : pointers) {
+        for (auto ptr : threadPointers) {
+            EXPECT_NE(nullptr, svmManager->getSVMAlloc(ptr));
+            svmManager->freeSVMAlloc(ptr);
+        }
+    }
+}
+
+struct UnifiedMemoryPoolingWithCsrTest : public MemoryManagerWithCsrFixture, public ::testing::Test {
+    void SetUp() override {
+        DebugManager.flags.EnableUnifiedMemoryPooling.set(1);
+        MemoryManagerWithCsrFixture::SetUp();
+        executionEnvironment.rootDeviceEnvironments[0]->initGmm();
+        svmManager = std::make_unique<MockSVMAllocsManager>(memoryManager);
+        deviceProperties.memoryType = InternalMemoryType::DEVICE_UNIFIED_MEMORY;
+        deviceProperties.subdeviceBitfield = mockDeviceBitfield;
+    }
+
+    void TearDown() override {
+        svmManager.reset();
+        MemoryManagerWithCsrFixture::TearDown();
+    }
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<MockSVMAllocsManager> svmManager;
+    SVMAllocsManager::UnifiedMemoryProperties deviceProperties;
+};
+
+TEST_F(UnifiedMemoryPoolingWithCsrTest, givenPoolInUseByEngineWhenPooledAllocationIsFreedThenFreeDoesNotWaitAndMemoryIsReusedOnceEngineCompletes) {
+    auto ptr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 100u, deviceProperties);
+    ASSERT_NE(nullptr, ptr);
+    auto pool = svmManager->unifiedMemoryPools[0].get();
+    pool->getAllocation()->updateTaskCount(currentGpuTag + 1, csr->getOsContext().getContextId());
+
+    svmManager->freeSVMAlloc(ptr);
+    EXPECT_EQ(0u, csr->waitForCompletionWithTimeoutCalled);
+    EXPECT_EQ(0u, svmManager->getNumAllocs());
+    EXPECT_EQ(1u, pool->getPendingFreesCount());
+    EXPECT_EQ(1u, pool->getSubAllocationsCount());
+
+    auto otherPtr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 100u, deviceProperties);
+    EXPECT_NE(ptr, otherPtr);
+    EXPECT_EQ(1u, pool->getPendingFreesCount());
+
+    currentGpuTag++;
+    auto reusedPtr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 100u, deviceProperties);
+    EXPECT_EQ(ptr, reusedPtr);
+    EXPECT_EQ(0u, pool->getPendingFreesCount());
+    EXPECT_EQ(2u, pool->getSubAllocationsCount());
+
+    pool->getAllocation()->releaseUsageInOsContext(csr->getOsContext().getContextId());
+    svmManager->freeSVMAlloc(otherPtr);
+    svmManager->freeSVMAlloc(reusedPtr);
+    EXPECT_TRUE(pool->isEmpty());
+}
+
+TEST_F(UnifiedMemoryPoolingWithCsrTest, givenPoolCompletedByEngineWhenPooledAllocationIsFreedThenMemoryIsReleasedRightAway) {
+    auto ptr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 100u, deviceProperties);
+    ASSERT_NE(nullptr, ptr);
+    auto pool = svmManager->unifiedMemoryPools[0].get();
+    pool->getAllocation()->updateTaskCount(currentGpuTag, csr->getOsContext().getContextId());
+
+    svmManager->freeSVMAlloc(ptr);
+    EXPECT_EQ(0u, pool->getPendingFreesCount());
+    EXPECT_TRUE(pool->isEmpty());
+}
+
+TEST_F(UnifiedMemoryPoolingWithCsrTest, givenPoolUsedByEngineAfterAllocationWasCreatedWhenPooledAllocationIsFreedBlockingThenEngineIsWaitedFor) {
+    auto ptr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 100u, deviceProperties);
+    ASSERT_NE(nullptr, ptr);
+    auto pool = svmManager->unifiedMemoryPools[0].get();
+    pool->getAllocation()->updateTaskCount(currentGpuTag + 1, csr->getOsContext().getContextId());
+
+    svmManager->freeSVMAlloc(ptr, true);
+    EXPECT_EQ(1u, csr->waitForCompletionWithTimeoutCalled);
+    pool->getAllocation()->releaseUsageInOsContext(csr->getOsContext().getContextId());
+}
+
+TEST_F(UnifiedMemoryPoolingWithCsrTest, givenPoolUsedByEngineOnlyBeforeAllocationWasCreatedWhenPooledAllocationIsFreedBlockingThenEngineIsNotWaitedForAndMemoryIsReleased) {
+    auto otherPtr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 100u, deviceProperties);
+    ASSERT_NE(nullptr, otherPtr);
+    auto pool = svmManager->unifiedMemoryPools[0].get();
+    pool->getAllocation()->updateTaskCount(currentGpuTag + 1, csr->getOsContext().getContextId());
+
+    auto ptr = svmManager->createUnifiedMemoryAllocation(mockRootDeviceIndex, 100u, deviceProperties);
+    ASSERT_NE(nullptr, ptr);
+    svmManager->freeSVMAlloc(ptr, true);
+    EXPECT_EQ(0u, csr->waitForCompletionWithTimeoutCalled);
+    EXPECT_EQ(0u, pool->getPendingFreesCount());
+    EXPECT_EQ(1u, pool->getSubAllocationsCount());
+
+    svmManager->freeSVMAlloc(otherPtr, true);
+    EXPECT_EQ(1u, csr->waitForCompletionWithTimeoutCalled);
+    pool->getAllocation()->releaseUsageInOsContext(csr->getOsContext().getContextId());
+}
@@ -14,7 +14,16 @@ class MockHostPtrManager : public HostPtrManager {
     using HostPtrManager::checkAllocationsForOverlapping;
     using HostPtrManager::getAllocationRequirements;
     using HostPtrManager::getFragmentAndCheckForOverlaps;
+    using HostPtrManager::getRegion;
     using HostPtrManager::populateAlreadyAllocatedFragments;
-    size_t getFragmentCount() { return partialAllocations.size(); }
+    using HostPtrManager::spanningFragments;
+    using HostPtrManager::stripes;
+    size_t getFragmentCount() {
+        auto fragmentCount = spanningFragments.size();
+        for (auto &stripe : stripes) {
+            fragmentCount += stripe.fragments.size();
+        }
+        return fragmentCount;
+    }
 };
 } // namespace NEO
@@ -14,5 +14,6 @@ struct MockSVMAllocsManager : SVMAllocsManager {
     using SVMAllocsManager::SVMAllocs;
     using SVMAllocsManager::SVMAllocsManager;
     using SVMAllocsManager::svmMapOperations;
+    using SVMAllocsManager::unifiedMemoryPools;
 };
 } // namespace NEO
\ No newline at end of file
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/cpu_gpu_time_correlator.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+namespace {
+constexpr uint64_t resyncPeriodNs = 1000 * 1000;
+constexpr uint64_t maxErrorNs = 1000;
+
+struct SimulatedGpuClock {
+    uint64_t get(uint64_t cpuTimeNs) const {
+        auto mask = bits >= 64u ? ~0ull : (1ull << bits) - 1;
+        return (offset + static_cast<uint64_t>(static_cast<double>(cpuTimeNs) * ticksPerNs)) & mask;
+    }
+    TimeStampData sample(uint64_t cpuTimeNs) const {
+        return {get(cpuTimeNs), cpuTimeNs};
+    }
+
+    // 12 MHz clock drifting 50 ppm from nominal
+    double ticksPerNs = 0.012 * 1.00005;
+    uint64_t offset = 123456789;
+    uint32_t bits = 36;
+};
+
+uint64_t distance(uint64_t a, uint64_t b) {
+    return a > b ? a - b : b - a;
+}
+
+void calibrate(CpuGpuTimeCorrelator &correlator, const SimulatedGpuClock &clock, uint64_t &cpuTimeNs) {
+    for (int i = 0; i < 5; i++) {
+        correlator.addSample(clock.sample(cpuTimeNs));
+        cpuTimeNs += resyncPeriodNs / 3;
+    }
+}
+} // namespace
+
+TEST(CpuGpuTimeCorrelatorTest, givenDefaultSettingsWhenCreatingCorrelatorThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, CpuGpuTimeCorrelator::create(36));
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCpuGpuTimeCorrelation.set(1);
+    EXPECT_NE(nullptr, CpuGpuTimeCorrelator::create(36));
+}
+
+TEST(CpuGpuTimeCorrelatorTest, givenSamplesSpanningLessThanResyncPeriodWhenQueryingThenMeasurementIsRequired) {
+    CpuGpuTimeCorrelator correlator(36, resyncPeriodNs, maxErrorNs);
+    SimulatedGpuClock clock;
+    uint64_t gpuTimestamp = 0;
+
+    correlator.addSample(clock.sample(1000));
+    correlator.addSample(clock.sample(1000 + resyncPeriodNs / 2));
+    EXPECT_FALSE(correlator.isCalibrated());
+    EXPECT_FALSE(correlator.getGpuTimestamp(1000 + resyncPeriodNs / 2 + 10, gpuTimestamp));
+
+    correlator.addSample(clock.sample(1000 + resyncPeriodNs));
+    EXPECT_TRUE(correlator.isCalibrated());
+    EXPECT_TRUE(correlator.getGpuTimestamp(1000 + resyncPeriodNs + 10, gpuTimestamp));
+}
+
+TEST(CpuGpuTimeCorrelatorTest, givenDriftingClockWhenCalibratedThenPredictionsAreWithinOneTick) {
+    CpuGpuTimeCorrelator correlator(36, resyncPeriodNs, maxErrorNs);
+    SimulatedGpuClock clock;
+    uint64_t cpuTimeNs = 5000;
+    calibrate(correlator, clock, cpuTimeNs);
+    ASSERT_TRUE(correlator.isCalibrated());
+    EXPECT_NEAR(clock.ticksPerNs, correlator.getGpuTicksPerNs(), 1e-6);
+
+    uint32_t measurements = 0;
+    for (int i = 0; i < 1000; i++) {
+        cpuTimeNs += 7919;
+        uint64_t gpuTimestamp = 0;
+        if (!correlator.getGpuTimestamp(cpuTimeNs, gpuTimestamp)) {
+            correlator.addSample(clock.sample(cpuTimeNs));
+            measurements++;
+            continue;
+        }
+        EXPECT_LE(distance(clock.get(cpuTimeNs), gpuTimestamp), 1u);
+    }
+    EXPECT_LE(measurements, 7919u * 1000 / resyncPeriodNs + 1);
+    EXPECT_LE(correlator.getErrorBound(), 1000u);
+}
+
+TEST(CpuGpuTimeCorrelatorTest, givenTimestampWrappingWhenPredictingThenPredictionIsMaskedToTimestampSize) {
+    CpuGpuTimeCorrelator correlator(32, resyncPeriodNs, maxErrorNs);
+    SimulatedGpuClock clock;
+    clock.bits = 32;
+    clock.offset = (1ull << 32) - 8000;
+    uint64_t cpuTimeNs = 0;
+    calibrate(correlator, clock, cpuTimeNs);
+    ASSERT_TRUE(correlator.isCalibrated());
+    EXPECT_NEAR(clock.ticksPerNs, correlator.getGpuTicksPerNs(), 1e-6);
+
+    uint64_t gpuTimestamp = 0;
+    ASSERT_TRUE(correlator.getGpuTimestamp(cpuTimeNs - resyncPeriodNs / 3 + 1000, gpuTimestamp));
+    EXPECT_LE(distance(clock.get(cpuTimeNs - resyncPeriodNs / 3 + 1000), gpuTimestamp), 1u);
+    EXPECT_LT(gpuTimestamp, 1ull << 32);
+}
+
+TEST(CpuGpuTimeCorrelatorTest, givenClockChangingRateWhenMeasuredErrorExceedsMaximumThenCorrelatorCalibratesAgain) {
+    CpuGpuTimeCorrelator correlator(36, resyncPeriodNs, maxErrorNs);
+    SimulatedGpuClock clock;
+    uint64_t cpuTimeNs = 0;
+    calibrate(correlator, clock, cpuTimeNs);
+    ASSERT_TRUE(correlator.isCalibrated());
+
+    SimulatedGpuClock changedClock = clock;
+    changedClock.ticksPerNs = 0.0192;
+    changedClock.offset = clock.get(cpuTimeNs) - static_cast<uint64_t>(cpuTimeNs * changedClock.ticksPerNs);
+    cpuTimeNs += resyncPeriodNs;
+    correlator.addSample(changedClock.sample(cpuTimeNs));
+    EXPECT_FALSE(correlator.isCalibrated());
+    EXPECT_EQ(0u, correlator.getErrorBound());
+
+    cpuTimeNs += resyncPeriodNs / 3;
+    calibrate(correlator, changedClock, cpuTimeNs);
+    ASSERT_TRUE(correlator.isCalibrated());
+    EXPECT_NEAR(changedClock.ticksPerNs, correlator.getGpuTicksPerNs(), 1e-6);
+}
+
+TEST(CpuGpuTimeCorrelatorTest, givenResyncRequestWhenQueryingThenMeasurementIsRequiredUntilNextSample) {
+    CpuGpuTimeCorrelator correlator(36, resyncPeriodNs, maxErrorNs);
+    SimulatedGpuClock clock;
+    uint64_t cpuTimeNs = 0;
+    calibrate(correlator, clock, cpuTimeNs);
+    uint64_t gpuTimestamp = 0;
+    cpuTimeNs -= resyncPeriodNs / 3;
+    EXPECT_TRUE(correlator.getGpuTimestamp(cpuTimeNs, gpuTimestamp));
+
+    correlator.resync();
+    EXPECT_FALSE(correlator.getGpuTimestamp(cpuTimeNs, gpuTimestamp));
+
+    correlator.addSample(clock.sample(cpuTimeNs));
+    EXPECT_TRUE(correlator.getGpuTimestamp(cpuTimeNs, gpuTimestamp));
+}
@@ -20,10 +20,12 @@
 #include "shared/source/os_interface/linux/allocator_helper.h"
 #include "shared/source/os_interface/linux/drm_allocation.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
+#include "shared/source/os_interface/linux/drm_cpu_mapping_cache.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/test/unit_test/helpers/benchmark_runner.h"
 #include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 #include "shared/test/unit_test/helpers/ult_hw_config.h"
 
@@ -2242,6 +2244,177 @@ TEST_F(DrmMemoryManagerTest, givenDrmMemoryManagerWhenLockUnlockIsCalledOnAlloca
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+GraphicsAllocation *allocateImageWithoutCpuPtr(TestedDrmMemoryManager &memoryManager, uint32_t rootDeviceIndex) {
+    cl_image_desc imgDesc = {};
+    imgDesc.image_type = CL_MEM_OBJECT_IMAGE2D;
+    imgDesc.image_width = 512;
+    imgDesc.image_height = 512;
+    auto imgInfo = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+    imgInfo.imgDesc = Image::convertDescriptor(imgDesc);
+    imgInfo.size = 4096u;
+    imgInfo.rowPitch = 512u;
+
+    AllocationData allocationData;
+    allocationData.imgInfo = &imgInfo;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+
+    return memoryManager.allocateGraphicsMemoryForImage(allocationData);
+}
+
+TEST_F(DrmMemoryManagerBasic, givenCpuMappingCacheMaxSizeDebugVariableWhenDrmMemoryManagerIsCreatedThenCpuMappingCacheIsCreatedOnlyForPositiveSize) {
+    DebugManagerStateRestore restorer;
+    {
+        TestedDrmMemoryManager memoryManager(false, false, false, executionEnvironment);
+        EXPECT_EQ(nullptr, memoryManager.cpuMappingCache.get());
+    }
+    DebugManager.flags.CpuMappingCacheMaxSize.set(0);
+    {
+        TestedDrmMemoryManager memoryManager(false, false, false, executionEnvironment);
+        EXPECT_EQ(nullptr, memoryManager.cpuMappingCache.get());
+    }
+    DebugManager.flags.CpuMappingCacheMaxSize.set(static_cast<int32_t>(MemoryConstants::megaByte));
+    {
+        TestedDrmMemoryManager memoryManager(false, false, false, executionEnvironment);
+        ASSERT_NE(nullptr, memoryManager.cpuMappingCache.get());
+        EXPECT_EQ(MemoryConstants::megaByte, memoryManager.cpuMappingCache->getMaxSize());
+    }
+}
+
+TEST_F(DrmMemoryManagerTest, givenCpuMappingCacheWhenAllocationIsLockedAgainAfterUnlockThenCachedMappingIsReusedWithoutMmapIoctl) {
+    mock->ioctl_expected.gemCreate = 1;
+    mock->ioctl_expected.gemMmap = 1;
+    mock->ioctl_expected.gemSetDomain = 2;
+    mock->ioctl_expected.gemSetTiling = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    memoryManager->cpuMappingCache = std::make_unique<DrmCpuMappingCache>(MemoryConstants::megaByte);
+
+    auto allocation = allocateImageWithoutCpuPtr(*memoryManager, rootDeviceIndex);
+    ASSERT_NE(nullptr, allocation);
+    auto bo = static_cast<DrmAllocation *>(allocation)->getBO();
+
+    auto ptr = memoryManager->lockResource(allocation);
+    EXPECT_NE(nullptr, ptr);
+    memoryManager->unlockResource(allocation);
+    EXPECT_EQ(ptr, bo->peekLockedAddress());
+    EXPECT_EQ(bo->peekSize(), memoryManager->cpuMappingCache->getCachedSize());
+
+    EXPECT_EQ(ptr, memoryManager->lockResource(allocation));
+    EXPECT_EQ(0u, memoryManager->cpuMappingCache->getCachedSize());
+    EXPECT_EQ(1u, memoryManager->cpuMappingCache->getHitCount());
+    EXPECT_EQ(1u, memoryManager->cpuMappingCache->getMissCount());
+    memoryManager->unlockResource(allocation);
+
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(0u, memoryManager->cpuMappingCache->getCachedSize());
+}
+
+TEST_F(DrmMemoryManagerTest, givenCpuMappingCacheWhenUnlockedMappingsExceedMaxSizeThenLeastRecentlyUnlockedMappingIsReleased) {
+    mock->ioctl_expected.gemCreate = 2;
+    mock->ioctl_expected.gemMmap = 3;
+    mock->ioctl_expected.gemSetDomain = 3;
+    mock->ioctl_expected.gemSetTiling = 2;
+    mock->ioctl_expected.gemWait = 2;
+    mock->ioctl_expected.gemClose = 2;
+
+    auto firstAllocation = allocateImageWithoutCpuPtr(*memoryManager, rootDeviceIndex);
+    auto secondAllocation = allocateImageWithoutCpuPtr(*memoryManager, rootDeviceIndex);
+    ASSERT_NE(nullptr, firstAllocation);
+    ASSERT_NE(nullptr, secondAllocation);
+    auto firstBo = static_cast<DrmAllocation *>(firstAllocation)->getBO();
+    auto secondBo = static_cast<DrmAllocation *>(secondAllocation)->getBO();
+
+    memoryManager->cpuMappingCache = std::make_unique<DrmCpuMappingCache>(firstBo->peekSize());
+
+    memoryManager->lockResource(firstAllocation);
+    memoryManager->unlockResource(firstAllocation);
+    memoryManager->lockResource(secondAllocation);
+    memoryManager->unlockResource(secondAllocation);
+
+    EXPECT_EQ(nullptr, firstBo->peekLockedAddress());
+    EXPECT_NE(nullptr, secondBo->peekLockedAddress());
+    EXPECT_EQ(1u, memoryManager->cpuMappingCache->getEvictionCount());
+
+    memoryManager->lockResource(firstAllocation);
+    memoryManager->unlockResource(firstAllocation);
+    EXPECT_EQ(nullptr, secondBo->peekLockedAddress());
+    EXPECT_EQ(2u, memoryManager->cpuMappingCache->getEvictionCount());
+
+    memoryManager->freeGraphicsMemory(firstAllocation);
+    memoryManager->freeGraphicsMemory(secondAllocation);
+    EXPECT_EQ(0u, memoryManager->cpuMappingCache->getCachedSize());
+}
+
+TEST_F(DrmMemoryManagerTest, givenEvictedCpuMappingWhenBufferObjectIsMappedAgainBeforeReleaseThenOnlyEvictedMappingIsReleased) {
+    mock->ioctl_expected.gemCreate = 1;
+    mock->ioctl_expected.gemMmap = 1;
+    mock->ioctl_expected.gemSetDomain = 1;
+    mock->ioctl_expected.gemSetTiling = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    memoryManager->cpuMappingCache = std::make_unique<DrmCpuMappingCache>(MemoryConstants::megaByte);
+
+    auto allocation = allocateImageWithoutCpuPtr(*memoryManager, rootDeviceIndex);
+    ASSERT_NE(nullptr, allocation);
+    auto bo = static_cast<DrmAllocation *>(allocation)->getBO();
+
+    auto ptr = memoryManager->lockResource(allocation);
+    EXPECT_NE(nullptr, ptr);
+    memoryManager->unlockResource(allocation);
+
+    DrmCpuMappingCache::Entry evictedMapping;
+    ASSERT_TRUE(memoryManager->cpuMappingCache->remove(bo, evictedMapping));
+    EXPECT_EQ(ptr, evictedMapping.lockedAddress);
+
+    auto newMapping = reinterpret_cast<void *>(0x12340000);
+    bo->setLockedAddress(newMapping);
+    memoryManager->releaseCpuMapping(evictedMapping);
+    EXPECT_EQ(newMapping, bo->peekLockedAddress());
+
+    bo->setLockedAddress(ptr);
+    memoryManager->releaseCpuMapping(evictedMapping);
+    EXPECT_EQ(nullptr, bo->peekLockedAddress());
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST(DrmCpuMappingCacheTest, givenMappingLargerThanMaxSizeWhenAddedThenItIsReturnedAsEvicted) {
+    DrmCpuMappingCache cache(MemoryConstants::pageSize);
+    DrmCpuMappingCache::Entry entry;
+    entry.bo = reinterpret_cast<BufferObject *>(0x1000);
+    entry.lockedAddress = reinterpret_cast<void *>(0x20000);
+    entry.size = 2 * MemoryConstants::pageSize;
+
+    std::vector<DrmCpuMappingCache::Entry> evictedEntries;
+    cache.add(entry, evictedEntries);
+    ASSERT_EQ(1u, evictedEntries.size());
+    EXPECT_EQ(entry.bo, evictedEntries[0].bo);
+    EXPECT_EQ(entry.lockedAddress, evictedEntries[0].lockedAddress);
+    EXPECT_EQ(0u, cache.getCachedSize());
+    EXPECT_FALSE(cache.acquire(entry.bo));
+}
+
+TEST(DrmCpuMappingCacheTest, givenCachedMappingsWhenRemoveAllIsCalledThenAllMappingsAreReturnedAndCacheIsEmpty) {
+    DrmCpuMappingCache cache(MemoryConstants::megaByte);
+    DrmCpuMappingCache::Entry entry;
+    entry.size = MemoryConstants::pageSize;
+
+    std::vector<DrmCpuMappingCache::Entry> evictedEntries;
+    entry.bo = reinterpret_cast<BufferObject *>(0x1000);
+    cache.add(entry, evictedEntries);
+    entry.bo = reinterpret_cast<BufferObject *>(0x2000);
+    cache.add(entry, evictedEntries);
+    EXPECT_TRUE(evictedEntries.empty());
+    EXPECT_EQ(2 * MemoryConstants::pageSize, cache.getCachedSize());
+
+    cache.removeAll(evictedEntries);
+    EXPECT_EQ(2u, evictedEntries.size());
+    EXPECT_EQ(0u, cache.getCachedSize());
+    EXPECT_FALSE(cache.acquire(entry.bo));
+}
+
 TEST_F(DrmMemoryManagerTest, givenDrmMemoryManagerWhenLockUnlockIsCalledOnNullAllocationThenReturnNullPtr) {
     GraphicsAllocation *allocation = nullptr;
 
@@ -3607,4 +3780,29 @@ TEST(DrmMemoryMangerTest, givenMultipleRootDeviceWhenMemoryManagerGetsDrmThenDrm
     }
     EXPECT_EQ(CommonConstants::unspecifiedDeviceIndex, drmMemoryManager.getRootDeviceIndex(nullptr));
 }
+
+using DrmMemoryManagerLockBenchmark = Test<DrmMemoryManagerFixture>;
+
+TEST_F(DrmMemoryManagerLockBenchmark, DISABLED_lockUnlockAllocationWithoutCpuPtrWithAndWithoutCpuMappingCache) {
+    // Benchmark results outlive the test.
+    MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+
+    auto allocation = allocateImageWithoutCpuPtr(*memoryManager, rootDeviceIndex);
+    ASSERT_NE(nullptr, allocation);
+
+    auto lockUnlock = [&](uint32_t thread, uint32_t iteration) {
+        memoryManager->lockResource(allocation);
+        memoryManager->unlockResource(allocation);
+    };
+
+    BenchmarkRunner::run("DrmMemoryManager::lockResource+unlockResource(no cpu mapping cache)", 1u, lockUnlock);
+    auto mmapCountWithoutCache = mock->ioctl_cnt.gemMmap.load();
+
+    memoryManager->cpuMappingCache = std::make_unique<DrmCpuMappingCache>(MemoryConstants::megaByte);
+    BenchmarkRunner::run("DrmMemoryManager::lockResource+unlockResource(cpu mapping cache)", 1u, lockUnlock);
+    EXPECT_EQ(mmapCountWithoutCache + 1, mock->ioctl_cnt.gemMmap.load());
+
+    memoryManager->freeGraphicsMemory(allocation);
+    mock->ioctl_expected.total = -1;
+}
 } // namespace NEO
@@ -8,6 +8,7 @@
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/linux/os_interface.h"
 #include "shared/source/os_interface/linux/os_time_linux.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "opencl/test/unit_test/os_interface/linux/device_command_stream_fixture.h"
 #include "opencl/test/unit_test/os_interface/linux/mock_os_time_linux.h"
@@ -28,6 +29,13 @@ int getTimeFuncTrue(clockid_t clkId, struct timespec *tp) throw() {
     return 0;
 }
 
+static uint64_t simulatedCpuTime = 0;
+int getTimeFuncSimulated(clockid_t clkId, struct timespec *tp) throw() {
+    tp->tv_sec = simulatedCpuTime / NSEC_PER_SEC;
+    tp->tv_nsec = simulatedCpuTime % NSEC_PER_SEC;
+    return 0;
+}
+
 int resolutionFuncFalse(clockid_t clkId, struct timespec *res) throw() {
     return -1;
 }
@@ -244,3 +252,60 @@ TEST_F(DrmTimeTest, givenAlwaysPassingResolutionFuncWhenGetCpuRawTimestampIsCall
     auto retVal = osTime->getCpuRawTimestamp();
     EXPECT_EQ(1ull, retVal);
 }
+
+class DrmMockSimulatedTime : public DrmMockSuccess {
+  public:
+    int ioctl(unsigned long request, void *arg) override {
+        if (request == DRM_IOCTL_I915_REG_READ) {
+            regReadCount++;
+            auto reg = reinterpret_cast<drm_i915_reg_read *>(arg);
+            reg->val = getGpuTimestamp();
+        }
+        return 0;
+    }
+
+    static uint64_t getGpuTimestamp() {
+        return simulatedCpuTime * 12 / 1000;
+    }
+
+    uint32_t regReadCount = 0;
+};
+
+TEST_F(DrmTimeTest, givenCpuGpuTimeCorrelationEnabledWhenQueryingCpuGpuTimeThenMostQueriesDoNotReadGpuTimestamp) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCpuGpuTimeCorrelation.set(1);
+    DebugManager.flags.CpuGpuTimeCorrelationResyncPeriodMs.set(1);
+    simulatedCpuTime = NSEC_PER_SEC;
+    osTime->setGetTimeFunc(getTimeFuncSimulated);
+    auto pDrm = new DrmMockSimulatedTime();
+    osTime->updateDrm(pDrm);
+    pDrm->regReadCount = 0;
+
+    for (int i = 0; i < 1000; i++) {
+        simulatedCpuTime += 10000;
+        TimeStampData cpuGpuTime = {0, 0};
+        EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+        EXPECT_EQ(simulatedCpuTime, cpuGpuTime.CPUTimeinNS);
+        EXPECT_NEAR(static_cast<double>(DrmMockSimulatedTime::getGpuTimestamp()), static_cast<double>(cpuGpuTime.GPUTimeStamp), 1.0);
+    }
+    EXPECT_LT(pDrm->regReadCount, 150u);
+    EXPECT_LE(osTime->getCpuGpuTimeErrorBound(), 1000u);
+
+    auto regReadCount = pDrm->regReadCount;
+    osTime->resyncCpuGpuTime();
+    TimeStampData cpuGpuTime = {0, 0};
+    EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+    EXPECT_EQ(regReadCount + 1, pDrm->regReadCount);
+}
+
+TEST_F(DrmTimeTest, givenCpuGpuTimeCorrelationDisabledWhenQueryingCpuGpuTimeThenGpuTimestampIsReadEachTime) {
+    auto pDrm = new DrmMockSimulatedTime();
+    osTime->updateDrm(pDrm);
+    pDrm->regReadCount = 0;
+
+    TimeStampData cpuGpuTime = {0, 0};
+    EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+    EXPECT_TRUE(osTime->getCpuGpuTime(&cpuGpuTime));
+    EXPECT_EQ(2u, pDrm->regReadCount);
+    EXPECT_EQ(0u, osTime->getCpuGpuTimeErrorBound());
+}
@@ -838,6 +838,66 @@ TEST_F(PrintFormatterTest, GivenEmptyBufferWhenPrintingThenFailSafely) {
     EXPECT_STREQ("", actualOutput);
 }
 
+TEST_F(PrintFormatterTest, GivenDoublePercentageFollowedByConversionWhenPrintingThenPercentageDoesNotConsumeValue) {
+    auto stringIndex = injectFormatString("%%d %d");
+    storeData(stringIndex);
+    injectValue(5);
+
+    char actualOutput[PrintFormatter::maxPrintfOutputLength];
+
+    printFormatter->printKernelOutput([&actualOutput](char *str) { strncpy_s(actualOutput, PrintFormatter::maxPrintfOutputLength, str, PrintFormatter::maxPrintfOutputLength); });
+
+    EXPECT_STREQ("%d 5", actualOutput);
+}
+
+TEST_F(PrintFormatterTest, GivenFormatProgramsCompiledAtLoadWhenPrintingThenProgramIsUsedInsteadOfFormatString) {
+    auto stringIndex = injectFormatString("%d\\n");
+    storeData(stringIndex);
+    injectValue(7);
+
+    ASSERT_EQ(1u, kernelInfo->patchInfo.printfFormatPrograms.count(stringIndex));
+    auto &program = kernelInfo->patchInfo.printfFormatPrograms[stringIndex];
+    ASSERT_EQ(2u, program.size());
+    EXPECT_TRUE(program[0].isConversion);
+    EXPECT_EQ("%d", program[0].text);
+    EXPECT_FALSE(program[1].isConversion);
+    EXPECT_EQ("\n", program[1].text);
+
+    program[1].text = "!";
+    printFormatter.reset(new PrintFormatter(underlyingBuffer, PrintFormatter::maxPrintfOutputLength, is32bit, kernelInfo->patchInfo.stringDataMap, &kernelInfo->patchInfo.printfFormatPrograms));
+
+    char actualOutput[PrintFormatter::maxPrintfOutputLength];
+
+    printFormatter->printKernelOutput([&actualOutput](char *str) { strncpy_s(actualOutput, PrintFormatter::maxPrintfOutputLength, str, PrintFormatter::maxPrintfOutputLength); });
+
+    EXPECT_STREQ("7!", actualOutput);
+}
+
+TEST_F(PrintFormatterTest, GivenMultipleRecordsWhenPrintingToStdoutThenAllRecordsAreWrittenInOrder) {
+    auto firstIndex = injectFormatString("first %d ");
+    auto secondIndex = injectFormatString("second %d");
+    storeData(firstIndex);
+    injectValue(1);
+    storeData(secondIndex);
+    injectValue(2);
+
+    testing::internal::CaptureStdout();
+    printFormatter->printKernelOutput();
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_STREQ("first 1 second 2", output.c_str());
+}
+
+TEST(PrintFormatterCompileTest, GivenVectorConversionWhenCompilingFormatStringThenElementFormatIsPrecomputed) {
+    auto program = PrintFormatter::compileFormatString("v=%v4hhd %s");
+    ASSERT_EQ(4u, program.size());
+    EXPECT_EQ("v=", program[0].text);
+    EXPECT_TRUE(program[1].isConversion);
+    EXPECT_EQ("%v4hhd", program[1].text);
+    EXPECT_EQ("%hhd", program[1].vectorElementFormat);
+    EXPECT_EQ(" ", program[2].text);
+    EXPECT_TRUE(program[3].isStringConversion);
+}
+
 TEST(printToSTDOUTTest, GivenStringWhenPrintingToSTDOUTThenExpectOutput) {
     testing::internal::CaptureStdout();
     printToSTDOUT("test");
@@ -108,6 +108,7 @@ void CommandContainer::reset() {
     slmSize = std::numeric_limits<uint32_t>::max();
     getResidencyContainer().clear();
     getDeallocationContainer().clear();
+    dispatchStateCache.invalidate();
 
     for (size_t i = 1; i < cmdBufferAllocations.size(); i++) {
         device->getMemoryManager()->freeGraphicsMemory(cmdBufferAllocations[i]);
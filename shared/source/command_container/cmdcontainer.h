@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "shared/source/command_container/dispatch_state_cache.h"
 #include "shared/source/command_stream/csr_definitions.h"
 #include "shared/source/helpers/heap_helper.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
@@ -92,6 +93,7 @@ class CommandContainer : public NonCopyableOrMovableClass {
     void setIddBlock(void *iddBlock) { this->iddBlock = iddBlock; }
     void *getIddBlock() { return iddBlock; }
     uint32_t getNumIddPerBlock() const { return numIddsPerBlock; }
+    DispatchStateCache &getDispatchStateCache() { return dispatchStateCache; }
 
   protected:
     void *iddBlock = nullptr;
@@ -108,6 +110,7 @@ class CommandContainer : public NonCopyableOrMovableClass {
     std::unique_ptr<IndirectHeap> indirectHeaps[HeapType::NUM_TYPES];
     ResidencyContainer residencyContainer;
     std::vector<GraphicsAllocation *> deallocationContainer;
+    DispatchStateCache dispatchStateCache;
 };
 
 } // namespace NEO
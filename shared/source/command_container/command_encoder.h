@@ -18,6 +18,20 @@
 
 namespace NEO {
 
+// Locations of a dispatch encoded into a command container, used to update the dispatch in place.
+struct EncodeDispatchKernelPatchInfo {
+    void *walkerCmd = nullptr;
+    void *interfaceDescriptor = nullptr;
+    void *indirectData = nullptr;
+    void *surfaceStates = nullptr;
+    size_t sshOffset = 0u;
+    uint32_t indirectDataSize = 0u;
+    uint32_t crossThreadDataSize = 0u;
+    uint32_t surfaceStatesSize = 0u;
+    uint32_t slmTotalSize = 0u;
+    bool stateShared = false;
+};
+
 template <typename GfxFamily>
 struct EncodeDispatchKernel {
     using WALKER_TYPE = typename GfxFamily::WALKER_TYPE;
@@ -25,7 +39,10 @@ struct EncodeDispatchKernel {
     using BINDING_TABLE_STATE = typename GfxFamily::BINDING_TABLE_STATE;
 
     static void encode(CommandContainer &container,
-                       const void *pThreadGroupDimensions, bool isIndirect, bool isPredicate, DispatchKernelEncoderI *dispatchInterface, uint64_t eventAddress, Device *device, PreemptionMode preemptionMode);
+                       const void *pThreadGroupDimensions, bool isIndirect, bool isPredicate, DispatchKernelEncoderI *dispatchInterface, uint64_t eventAddress, Device *device, PreemptionMode preemptionMode,
+                       EncodeDispatchKernelPatchInfo *patchInfo = nullptr);
+    static bool canPatchDispatch(const EncodeDispatchKernelPatchInfo &patchInfo, DispatchKernelEncoderI *dispatchInterface);
+    static bool patchDispatch(const EncodeDispatchKernelPatchInfo &patchInfo, const void *pThreadGroupDimensions, DispatchKernelEncoderI *dispatchInterface);
     static void encodeAdditionalWalkerFields(const HardwareInfo &hwInfo, WALKER_TYPE &walkerCmd);
 
     static void *getInterfaceDescriptor(CommandContainer &container, uint32_t &iddOffset);
@@ -26,7 +26,8 @@ namespace NEO {
 template <typename Family>
 void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
                                           const void *pThreadGroupDimensions, bool isIndirect, bool isPredicate, DispatchKernelEncoderI *dispatchInterface,
-                                          uint64_t eventAddress, Device *device, PreemptionMode preemptionMode) {
+                                          uint64_t eventAddress, Device *device, PreemptionMode preemptionMode,
+                                          EncodeDispatchKernelPatchInfo *patchInfo) {
 
     using MEDIA_STATE_FLUSH = typename Family::MEDIA_STATE_FLUSH;
     using MEDIA_INTERFACE_DESCRIPTOR_LOAD = typename Family::MEDIA_INTERFACE_DESCRIPTOR_LOAD;
@@ -40,6 +41,12 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
     LinearStream *listCmdBufferStream = container.getCommandStream();
     size_t sshOffset = 0;
 
+    // Indirect dispatches get group counts written into their indirect data and sampler states are not tracked.
+    auto &dispatchStateCache = container.getDispatchStateCache();
+    const bool reuseDispatchState = DispatchStateCache::isEnabled() && !isIndirect &&
+                                    kernelDescriptor.payloadMappings.samplerTable.numSamplers == 0;
+    bool dispatchStateShared = false;
+
     size_t estimatedSizeRequired = estimateEncodeDispatchKernelCmdsSize(device);
     if (container.getCommandStream()->getAvailableSpace() < estimatedSizeRequired) {
         auto bbEnd = listCmdBufferStream->getSpaceForCmd<MI_BATCH_BUFFER_END>();
@@ -79,13 +86,25 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
         uint32_t bindingTablePointer = 0u;
 
         if (bindingTableStateCount > 0u) {
-            auto ssh = container.getHeapWithRequiredSizeAndAlignment(HeapType::SURFACE_STATE, dispatchInterface->getSurfaceStateHeapDataSize(), BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE);
-            sshOffset = ssh->getUsed();
-            bindingTablePointer = static_cast<uint32_t>(HardwareCommandsHelper<Family>::pushBindingTableAndSurfaceStates(
-                *ssh, bindingTableStateCount,
-                dispatchInterface->getSurfaceStateHeapData(),
-                dispatchInterface->getSurfaceStateHeapDataSize(), bindingTableStateCount,
-                kernelDescriptor.payloadMappings.bindingTable.tableOffset));
+            auto ssh = container.getIndirectHeap(HeapType::SURFACE_STATE);
+            auto sshData = dispatchInterface->getSurfaceStateHeapData();
+            auto sshDataSize = dispatchInterface->getSurfaceStateHeapDataSize();
+            if (reuseDispatchState && dispatchStateCache.findSurfaceStates(*ssh, sshData, sshDataSize, sshOffset, bindingTablePointer)) {
+                dispatchStateShared = true;
+            } else {
+                ssh = container.getHeapWithRequiredSizeAndAlignment(HeapType::SURFACE_STATE, sshDataSize, BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE);
+                sshOffset = ssh->getUsed();
+                bindingTablePointer = static_cast<uint32_t>(HardwareCommandsHelper<Family>::pushBindingTableAndSurfaceStates(
+                    *ssh, bindingTableStateCount, sshData, sshDataSize, bindingTableStateCount,
+                    kernelDescriptor.payloadMappings.bindingTable.tableOffset));
+                if (reuseDispatchState) {
+                    dispatchStateCache.storeSurfaceStates(*ssh, sshData, sshDataSize, sshOffset, bindingTablePointer);
+                }
+            }
+            if (patchInfo) {
+                patchInfo->surfaceStates = ptrOffset(ssh->getCpuBase(), sshOffset);
+                patchInfo->surfaceStatesSize = kernelDescriptor.payloadMappings.bindingTable.tableOffset;
+            }
         }
 
         idd.setBindingTablePointer(bindingTablePointer);
@@ -127,9 +146,14 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
 
     uint32_t sizeThreadData = sizePerThreadDataForWholeGroup + sizeCrossThreadData;
     uint64_t offsetThreadData = 0u;
-    {
-        auto heapIndirect = container.getIndirectHeap(HeapType::INDIRECT_OBJECT);
-        UNRECOVERABLE_IF(!(heapIndirect));
+    void *indirectData = nullptr;
+    auto heapIndirect = container.getIndirectHeap(HeapType::INDIRECT_OBJECT);
+    UNRECOVERABLE_IF(!(heapIndirect));
+    if (reuseDispatchState &&
+        dispatchStateCache.findIndirectData(*heapIndirect, sshOffset, dispatchInterface->getCrossThreadData(), sizeCrossThreadData,
+                                            dispatchInterface->getPerThreadData(), sizePerThreadDataForWholeGroup, indirectData, offsetThreadData)) {
+        dispatchStateShared = true;
+    } else {
         heapIndirect->align(WALKER_TYPE::INDIRECTDATASTARTADDRESS_ALIGN_SIZE);
 
         auto ptr = container.getHeapSpaceAllowGrow(HeapType::INDIRECT_OBJECT, sizeThreadData);
@@ -149,9 +173,22 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
             patchBindlessSurfaceStateOffsets(sshOffset, dispatchInterface->getKernelDescriptor(), reinterpret_cast<uint8_t *>(ptr));
         }
 
+        indirectData = ptr;
         ptr = ptrOffset(ptr, sizeCrossThreadData);
         memcpy_s(ptr, sizePerThreadDataForWholeGroup,
                  dispatchInterface->getPerThreadData(), sizePerThreadDataForWholeGroup);
+
+        if (reuseDispatchState) {
+            dispatchStateCache.storeIndirectData(*heapIndirect, sshOffset, dispatchInterface->getCrossThreadData(), sizeCrossThreadData,
+                                                 dispatchInterface->getPerThreadData(), sizePerThreadDataForWholeGroup, indirectData, offsetThreadData);
+        }
+    }
+
+    if (patchInfo) {
+        patchInfo->indirectData = indirectData;
+        patchInfo->indirectDataSize = sizeThreadData;
+        patchInfo->crossThreadDataSize = sizeCrossThreadData;
+        patchInfo->sshOffset = sshOffset;
     }
 
     auto slmSizeNew = dispatchInterface->getSlmTotalSize();
@@ -177,8 +214,16 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
     }
 
     uint32_t numIDD = 0u;
-    void *ptr = getInterfaceDescriptor(container, numIDD);
-    memcpy_s(ptr, sizeof(idd), &idd, sizeof(idd));
+    void *ptr = nullptr;
+    if (reuseDispatchState && dispatchStateCache.findInterfaceDescriptor(*heap, container.getIddBlock(), &idd, sizeof(idd), ptr, numIDD)) {
+        dispatchStateShared = true;
+    } else {
+        ptr = getInterfaceDescriptor(container, numIDD);
+        memcpy_s(ptr, sizeof(idd), &idd, sizeof(idd));
+        if (reuseDispatchState) {
+            dispatchStateCache.storeInterfaceDescriptor(*heap, container.getIddBlock(), &idd, sizeof(idd), ptr, numIDD);
+        }
+    }
 
     cmd.setIndirectDataStartAddress(static_cast<uint32_t>(offsetThreadData));
     cmd.setIndirectDataLength(sizeThreadData);
@@ -216,6 +261,68 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
         auto mediaStateFlush = listCmdBufferStream->getSpace(sizeof(MEDIA_STATE_FLUSH));
         *reinterpret_cast<MEDIA_STATE_FLUSH *>(mediaStateFlush) = Family::cmdInitMediaStateFlush;
     }
+
+    if (patchInfo) {
+        patchInfo->walkerCmd = buffer;
+        patchInfo->interfaceDescriptor = ptr;
+        patchInfo->slmTotalSize = slmSizeNew;
+        patchInfo->stateShared = dispatchStateShared;
+    }
+}
+
+template <typename Family>
+bool EncodeDispatchKernel<Family>::canPatchDispatch(const EncodeDispatchKernelPatchInfo &patchInfo, DispatchKernelEncoderI *dispatchInterface) {
+    auto sizeCrossThreadData = dispatchInterface->getCrossThreadDataSize();
+    uint32_t sizeThreadData = dispatchInterface->getPerThreadDataSizeForWholeThreadGroup() + sizeCrossThreadData;
+
+    // Heap space of the encoded dispatch cannot grow and different SLM size would require new L3 configuration.
+    // Heap blocks shared with another dispatch cannot be updated for one of them only.
+    return patchInfo.walkerCmd != nullptr && !patchInfo.stateShared &&
+           sizeCrossThreadData == patchInfo.crossThreadDataSize &&
+           sizeThreadData <= patchInfo.indirectDataSize &&
+           dispatchInterface->getSlmTotalSize() == patchInfo.slmTotalSize &&
+           dispatchInterface->getSurfaceStateHeapDataSize() >= patchInfo.surfaceStatesSize;
+}
+
+template <typename Family>
+bool EncodeDispatchKernel<Family>::patchDispatch(const EncodeDispatchKernelPatchInfo &patchInfo, const void *pThreadGroupDimensions,
+                                                 DispatchKernelEncoderI *dispatchInterface) {
+    if (pThreadGroupDimensions == nullptr || !canPatchDispatch(patchInfo, dispatchInterface)) {
+        return false;
+    }
+
+    auto &kernelDescriptor = dispatchInterface->getKernelDescriptor();
+    auto sizeCrossThreadData = dispatchInterface->getCrossThreadDataSize();
+    auto sizePerThreadDataForWholeGroup = dispatchInterface->getPerThreadDataSizeForWholeThreadGroup();
+    uint32_t sizeThreadData = sizePerThreadDataForWholeGroup + sizeCrossThreadData;
+
+    memcpy_s(patchInfo.indirectData, sizeCrossThreadData,
+             dispatchInterface->getCrossThreadData(), sizeCrossThreadData);
+    if (kernelDescriptor.payloadMappings.bindingTable.numEntries > 0) {
+        patchBindlessSurfaceStateOffsets(patchInfo.sshOffset, kernelDescriptor, reinterpret_cast<uint8_t *>(patchInfo.indirectData));
+    }
+    memcpy_s(ptrOffset(patchInfo.indirectData, sizeCrossThreadData), sizePerThreadDataForWholeGroup,
+             dispatchInterface->getPerThreadData(), sizePerThreadDataForWholeGroup);
+
+    if (patchInfo.surfaceStatesSize > 0u) {
+        memcpy_s(patchInfo.surfaceStates, patchInfo.surfaceStatesSize,
+                 dispatchInterface->getSurfaceStateHeapData(), patchInfo.surfaceStatesSize);
+    }
+
+    auto numThreadsPerThreadGroup = dispatchInterface->getNumThreadsPerThreadGroup();
+    auto idd = reinterpret_cast<INTERFACE_DESCRIPTOR_DATA *>(patchInfo.interfaceDescriptor);
+    idd->setNumberOfThreadsInGpgpuThreadGroup(numThreadsPerThreadGroup);
+
+    auto threadDims = static_cast<const uint32_t *>(pThreadGroupDimensions);
+    auto walker = reinterpret_cast<WALKER_TYPE *>(patchInfo.walkerCmd);
+    walker->setIndirectDataLength(sizeThreadData);
+    walker->setThreadGroupIdXDimension(threadDims[0]);
+    walker->setThreadGroupIdYDimension(threadDims[1]);
+    walker->setThreadGroupIdZDimension(threadDims[2]);
+    walker->setRightExecutionMask(dispatchInterface->getThreadExecutionMask());
+    walker->setThreadWidthCounterMaximum(numThreadsPerThreadGroup);
+
+    return true;
 }
 
 template <typename Family>
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_container/dispatch_state_cache.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/indirect_heap/indirect_heap.h"
+
+#include <cstring>
+
+namespace NEO {
+
+bool DispatchStateCache::isEnabled() {
+    return DebugManager.flags.EnableDispatchStateReuse.get() == 1;
+}
+
+bool DispatchStateCache::findSurfaceStates(const IndirectHeap &ssh, const void *sshData, size_t sshDataSize, size_t &sshOffset, uint32_t &bindingTablePointer) {
+    if (!isValid(surfaceStates, ssh) || surfaceStates.sourceData.size() != sshDataSize ||
+        !isDataEqual(surfaceStates, 0u, sshData, sshDataSize)) {
+        return false;
+    }
+    sshOffset = this->sshOffset;
+    bindingTablePointer = this->bindingTablePointer;
+    counters.reusedSurfaceStates++;
+    counters.savedSurfaceStateHeapSize += sshDataSize;
+    return true;
+}
+
+void DispatchStateCache::storeSurfaceStates(const IndirectHeap &ssh, const void *sshData, size_t sshDataSize, size_t sshOffset, uint32_t bindingTablePointer) {
+    auto data = static_cast<const uint8_t *>(sshData);
+    surfaceStates.sourceData.assign(data, data + sshDataSize);
+    store(surfaceStates, ssh);
+    this->sshOffset = sshOffset;
+    this->bindingTablePointer = bindingTablePointer;
+}
+
+bool DispatchStateCache::findIndirectData(const IndirectHeap &ioh, size_t sshOffset, const void *crossThreadData, size_t crossThreadDataSize,
+                                          const void *perThreadData, size_t perThreadDataSize, void *&indirectData, uint64_t &indirectDataOffset) {
+    if (!isValid(this->indirectData, ioh) || indirectDataSshOffset != sshOffset ||
+        this->crossThreadDataSize != crossThreadDataSize ||
+        this->indirectData.sourceData.size() != crossThreadDataSize + perThreadDataSize ||
+        !isDataEqual(this->indirectData, 0u, crossThreadData, crossThreadDataSize) ||
+        !isDataEqual(this->indirectData, crossThreadDataSize, perThreadData, perThreadDataSize)) {
+        return false;
+    }
+    indirectData = indirectDataPtr;
+    indirectDataOffset = this->indirectDataOffset;
+    counters.reusedIndirectData++;
+    counters.savedIndirectObjectHeapSize += crossThreadDataSize + perThreadDataSize;
+    return true;
+}
+
+void DispatchStateCache::storeIndirectData(const IndirectHeap &ioh, size_t sshOffset, const void *crossThreadData, size_t crossThreadDataSize,
+                                           const void *perThreadData, size_t perThreadDataSize, void *indirectData, uint64_t indirectDataOffset) {
+    auto &sourceData = this->indirectData.sourceData;
+    sourceData.resize(crossThreadDataSize + perThreadDataSize);
+    memcpy_s(sourceData.data(), sourceData.size(), crossThreadData, crossThreadDataSize);
+    memcpy_s(sourceData.data() + crossThreadDataSize, sourceData.size() - crossThreadDataSize, perThreadData, perThreadDataSize);
+    store(this->indirectData, ioh);
+    indirectDataSshOffset = sshOffset;
+    this->crossThreadDataSize = crossThreadDataSize;
+    indirectDataPtr = indirectData;
+    this->indirectDataOffset = indirectDataOffset;
+}
+
+bool DispatchStateCache::findInterfaceDescriptor(const IndirectHeap &dsh, const void *iddBlock, const void *idd, size_t iddSize, void *&interfaceDescriptor, uint32_t &iddOffset) {
+    if (!isValid(this->interfaceDescriptor, dsh) || this->iddBlock != iddBlock ||
+        this->interfaceDescriptor.sourceData.size() != iddSize ||
+        !isDataEqual(this->interfaceDescriptor, 0u, idd, iddSize)) {
+        return false;
+    }
+    interfaceDescriptor = interfaceDescriptorPtr;
+    iddOffset = this->iddOffset;
+    counters.reusedInterfaceDescriptors++;
+    counters.savedDynamicStateHeapSize += iddSize;
+    return true;
+}
+
+void DispatchStateCache::storeInterfaceDescriptor(const IndirectHeap &dsh, const void *iddBlock, const void *idd, size_t iddSize, void *interfaceDescriptor, uint32_t iddOffset) {
+    auto data = static_cast<const uint8_t *>(idd);
+    this->interfaceDescriptor.sourceData.assign(data, data + iddSize);
+    store(this->interfaceDescriptor, dsh);
+    this->iddBlock = iddBlock;
+    interfaceDescriptorPtr = interfaceDescriptor;
+    this->iddOffset = iddOffset;
+}
+
+void DispatchStateCache::invalidate() {
+    surfaceStates.valid = false;
+    indirectData.valid = false;
+    interfaceDescriptor.valid = false;
+}
+
+bool DispatchStateCache::isValid(const Block &block, const IndirectHeap &heap) {
+    return block.valid && block.heap == &heap && block.heapGeneration == heap.getGeneration();
+}
+
+bool DispatchStateCache::isDataEqual(const Block &block, size_t offset, const void *data, size_t size) {
+    return size == 0u || memcmp(block.sourceData.data() + offset, data, size) == 0;
+}
+
+void DispatchStateCache::store(Block &block, const IndirectHeap &heap) {
+    block.heap = &heap;
+    block.heapGeneration = heap.getGeneration();
+    block.valid = true;
+}
+
+} // namespace NEO
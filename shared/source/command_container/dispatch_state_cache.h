@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace NEO {
+class IndirectHeap;
+
+// Remembers heap blocks written by the most recent dispatch encoded into a command container: surface states,
+// indirect data and interface descriptor. A following dispatch built from identical data points its walker at
+// the same blocks instead of writing them again. Heaps are append only until their buffer is replaced, so a block
+// is valid as long as the heap generation did not change; in place updates of dispatches have to invalidate it.
+class DispatchStateCache {
+  public:
+    struct Counters {
+        uint64_t reusedSurfaceStates = 0u;
+        uint64_t reusedIndirectData = 0u;
+        uint64_t reusedInterfaceDescriptors = 0u;
+        uint64_t savedSurfaceStateHeapSize = 0u;
+        uint64_t savedIndirectObjectHeapSize = 0u;
+        uint64_t savedDynamicStateHeapSize = 0u;
+    };
+
+    static bool isEnabled();
+
+    bool findSurfaceStates(const IndirectHeap &ssh, const void *sshData, size_t sshDataSize, size_t &sshOffset, uint32_t &bindingTablePointer);
+    void storeSurfaceStates(const IndirectHeap &ssh, const void *sshData, size_t sshDataSize, size_t sshOffset, uint32_t bindingTablePointer);
+
+    // Bindless surface state offsets are patched into cross thread data, so indirect data depends on the surface states offset too.
+    bool findIndirectData(const IndirectHeap &ioh, size_t sshOffset, const void *crossThreadData, size_t crossThreadDataSize,
+                          const void *perThreadData, size_t perThreadDataSize, void *&indirectData, uint64_t &indirectDataOffset);
+    void storeIndirectData(const IndirectHeap &ioh, size_t sshOffset, const void *crossThreadData, size_t crossThreadDataSize,
+                           const void *perThreadData, size_t perThreadDataSize, void *indirectData, uint64_t indirectDataOffset);
+
+    bool findInterfaceDescriptor(const IndirectHeap &dsh, const void *iddBlock, const void *idd, size_t iddSize, void *&interfaceDescriptor, uint32_t &iddOffset);
+    void storeInterfaceDescriptor(const IndirectHeap &dsh, const void *iddBlock, const void *idd, size_t iddSize, void *interfaceDescriptor, uint32_t iddOffset);
+
+    void invalidate();
+    const Counters &getCounters() const { return counters; }
+
+  protected:
+    struct Block {
+        const IndirectHeap *heap = nullptr;
+        uint32_t heapGeneration = 0u;
+        std::vector<uint8_t> sourceData;
+        bool valid = false;
+    };
+
+    static bool isValid(const Block &block, const IndirectHeap &heap);
+    static bool isDataEqual(const Block &block, size_t offset, const void *data, size_t size);
+    static void store(Block &block, const IndirectHeap &heap);
+
+    Block surfaceStates;
+    size_t sshOffset = 0u;
+    uint32_t bindingTablePointer = 0u;
+
+    Block indirectData;
+    size_t indirectDataSshOffset = 0u;
+    size_t crossThreadDataSize = 0u;
+    void *indirectDataPtr = nullptr;
+    uint64_t indirectDataOffset = 0u;
+
+    Block interfaceDescriptor;
+    const void *iddBlock = nullptr;
+    void *interfaceDescriptorPtr = nullptr;
+    uint32_t iddOffset = 0u;
+
+    Counters counters;
+};
+} // namespace NEO
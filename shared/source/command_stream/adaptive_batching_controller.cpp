@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/adaptive_batching_controller.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+AdaptiveBatchingController::AdaptiveBatchingController(CommandStreamReceiver &csr, int64_t deadlineMicroseconds, uint32_t maxCommandBuffers,
+                                                       size_t maxCommandBuffersSize, bool flushOnGpuIdle)
+    : csr(csr), deadline(deadlineMicroseconds), maxCommandBuffers(maxCommandBuffers),
+      maxCommandBuffersSize(maxCommandBuffersSize), flushOnGpuIdle(flushOnGpuIdle) {
+}
+
+AdaptiveBatchingController::~AdaptiveBatchingController() {
+    stop();
+
+    if (DebugManager.flags.PrintDebugMessages.get()) {
+        using Counter = unsigned long long;
+        auto averageBatch = statistics.batchesFlushed ? statistics.commandBuffersFlushed / statistics.batchesFlushed : 0u;
+        printDebugString(true, stdout, "Adaptive batching: %llu batches, %llu command buffers, average %llu, largest %llu, flushed explicitly %llu, on threshold %llu, on gpu idle %llu, on deadline %llu\n",
+                         static_cast<Counter>(statistics.batchesFlushed), static_cast<Counter>(statistics.commandBuffersFlushed),
+                         static_cast<Counter>(averageBatch), static_cast<Counter>(statistics.largestBatch),
+                         static_cast<Counter>(statistics.explicitFlushes), static_cast<Counter>(statistics.thresholdFlushes),
+                         static_cast<Counter>(statistics.gpuIdleFlushes), static_cast<Counter>(statistics.deadlineFlushes));
+    }
+}
+
+std::unique_ptr<AdaptiveBatchingController> AdaptiveBatchingController::create(CommandStreamReceiver &csr) {
+    auto deadlineMicroseconds = DebugManager.flags.CsrAdaptiveBatchingDeadlineUs.get();
+    auto maxCommandBuffers = DebugManager.flags.CsrAdaptiveBatchingMaxCommandBuffers.get();
+    auto maxCommandBuffersSize = DebugManager.flags.CsrAdaptiveBatchingMaxSize.get();
+    auto flushOnGpuIdle = DebugManager.flags.CsrAdaptiveBatchingFlushOnGpuIdle.get() == 1;
+
+    if (deadlineMicroseconds <= 0 && maxCommandBuffers <= 0 && maxCommandBuffersSize <= 0 && !flushOnGpuIdle) {
+        return nullptr;
+    }
+    return std::make_unique<AdaptiveBatchingController>(csr,
+                                                        std::max(deadlineMicroseconds, 0),
+                                                        static_cast<uint32_t>(std::max(maxCommandBuffers, 0)),
+                                                        static_cast<size_t>(std::max(maxCommandBuffersSize, 0)),
+                                                        flushOnGpuIdle);
+}
+
+AdaptiveBatchingController::FlushReason AdaptiveBatchingController::commandBufferRecorded(size_t commandBufferSize, bool gpuIdle) {
+    std::unique_lock<std::mutex> lock(mtx);
+    if (pendingCommandBuffers == 0u) {
+        oldestRecordTime = Clock::now();
+    }
+    pendingCommandBuffers++;
+    pendingCommandBuffersSize += commandBufferSize;
+
+    if ((maxCommandBuffers != 0u && pendingCommandBuffers >= maxCommandBuffers) ||
+        (maxCommandBuffersSize != 0u && pendingCommandBuffersSize >= maxCommandBuffersSize)) {
+        pendingFlushReason = FlushReason::Threshold;
+    } else if (flushOnGpuIdle && gpuIdle) {
+        pendingFlushReason = FlushReason::GpuIdle;
+    } else if (isDeadlineExceeded(Clock::now())) {
+        pendingFlushReason = FlushReason::Deadline;
+    } else {
+        if (deadline.count() != 0 && keepRunning && timer == nullptr) {
+            timer = Thread::create(run, reinterpret_cast<void *>(this));
+        }
+        if (pendingCommandBuffers == 1u) {
+            lock.unlock();
+            condition.notify_one();
+        }
+        return FlushReason::None;
+    }
+    return pendingFlushReason;
+}
+
+void AdaptiveBatchingController::batchFlushed() {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (pendingCommandBuffers == 0u) {
+        return;
+    }
+    statistics.batchesFlushed++;
+    statistics.commandBuffersFlushed += pendingCommandBuffers;
+    statistics.largestBatch = std::max(statistics.largestBatch, static_cast<uint64_t>(pendingCommandBuffers));
+    switch (pendingFlushReason) {
+    case FlushReason::Threshold:
+        statistics.thresholdFlushes++;
+        break;
+    case FlushReason::GpuIdle:
+        statistics.gpuIdleFlushes++;
+        break;
+    case FlushReason::Deadline:
+        statistics.deadlineFlushes++;
+        break;
+    default:
+        statistics.explicitFlushes++;
+        break;
+    }
+
+    pendingCommandBuffers = 0u;
+    pendingCommandBuffersSize = 0u;
+    pendingFlushReason = FlushReason::None;
+}
+
+void AdaptiveBatchingController::stop() {
+    std::unique_lock<std::mutex> lock(mtx);
+    keepRunning = false;
+    lock.unlock();
+    condition.notify_one();
+    if (timer) {
+        timer->join();
+        timer.reset();
+    }
+}
+
+AdaptiveBatchingStatistics AdaptiveBatchingController::getStatistics() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return statistics;
+}
+
+size_t AdaptiveBatchingController::getPendingCommandBuffersCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return pendingCommandBuffers;
+}
+
+bool AdaptiveBatchingController::isDeadlineExceeded(Clock::time_point now) const {
+    return deadline.count() != 0 && pendingCommandBuffers != 0u && (now - oldestRecordTime) >= deadline;
+}
+
+bool AdaptiveBatchingController::prepareDeadlineFlush() {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (keepRunning && isDeadlineExceeded(Clock::now())) {
+        pendingFlushReason = FlushReason::Deadline;
+        return true;
+    }
+    return false;
+}
+
+void *AdaptiveBatchingController::run(void *arg) {
+    auto self = reinterpret_cast<AdaptiveBatchingController *>(arg);
+    std::unique_lock<std::mutex> lock(self->mtx);
+    while (self->keepRunning) {
+        if (self->pendingCommandBuffers == 0u) {
+            self->condition.wait(lock);
+            continue;
+        }
+        auto flushTime = self->oldestRecordTime + self->deadline;
+        if (Clock::now() < flushTime) {
+            self->condition.wait_until(lock, flushTime);
+            continue;
+        }
+
+        // csr ownership is acquired before mtx everywhere else
+        lock.unlock();
+        {
+            auto csrLock = self->csr.obtainUniqueOwnership();
+            if (self->prepareDeadlineFlush()) {
+                self->csr.flushBatchedSubmissions();
+            }
+        }
+        lock.lock();
+    }
+    return nullptr;
+}
+
+} // namespace NEO
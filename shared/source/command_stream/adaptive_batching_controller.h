@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace NEO {
+class CommandStreamReceiver;
+class Thread;
+
+struct AdaptiveBatchingStatistics {
+    uint64_t batchesFlushed = 0u;
+    uint64_t commandBuffersFlushed = 0u;
+    uint64_t largestBatch = 0u;
+    uint64_t explicitFlushes = 0u;
+    uint64_t thresholdFlushes = 0u;
+    uint64_t gpuIdleFlushes = 0u;
+    uint64_t deadlineFlushes = 0u;
+};
+
+// Bounds the latency added by BatchedDispatch. Recorded command buffers are flushed when
+// too many of them accumulate, when the GPU runs out of work, or when the oldest one waits
+// longer than the deadline. The deadline is enforced by a background timer thread.
+class AdaptiveBatchingController : NonCopyableOrMovableClass {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class FlushReason {
+        None,
+        Threshold,
+        GpuIdle,
+        Deadline
+    };
+
+    AdaptiveBatchingController(CommandStreamReceiver &csr, int64_t deadlineMicroseconds, uint32_t maxCommandBuffers, size_t maxCommandBuffersSize, bool flushOnGpuIdle);
+    ~AdaptiveBatchingController();
+
+    static std::unique_ptr<AdaptiveBatchingController> create(CommandStreamReceiver &csr);
+
+    // called with csr ownership acquired
+    FlushReason commandBufferRecorded(size_t commandBufferSize, bool gpuIdle);
+    void batchFlushed();
+
+    void stop();
+    AdaptiveBatchingStatistics getStatistics();
+    size_t getPendingCommandBuffersCount();
+
+  protected:
+    static void *run(void *arg);
+    bool isDeadlineExceeded(Clock::time_point now) const;
+    bool prepareDeadlineFlush();
+
+    CommandStreamReceiver &csr;
+    const std::chrono::microseconds deadline;
+    const uint32_t maxCommandBuffers;
+    const size_t maxCommandBuffersSize;
+    const bool flushOnGpuIdle;
+
+    size_t pendingCommandBuffers = 0u;
+    size_t pendingCommandBuffersSize = 0u;
+    Clock::time_point oldestRecordTime;
+    FlushReason pendingFlushReason = FlushReason::None;
+    AdaptiveBatchingStatistics statistics;
+
+    bool keepRunning = true;
+    std::unique_ptr<Thread> timer;
+    std::mutex mtx;
+    std::condition_variable condition;
+};
+} // namespace NEO
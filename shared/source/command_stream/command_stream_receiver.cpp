@@ -8,7 +8,9 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/command_stream/adaptive_batching_controller.h"
 #include "shared/source/command_stream/experimental_command_buffer.h"
+#include "shared/source/command_stream/host_staging_ring.h"
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/command_stream/scratch_space_controller.h"
 #include "shared/source/device/device.h"
@@ -38,6 +40,7 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
 
     latestSentStatelessMocsConfig = CacheSettings::unknownMocs;
     submissionAggregator.reset(new SubmissionAggregator());
+    adaptiveBatchingController = AdaptiveBatchingController::create(*this);
     if (DebugManager.flags.CsrDispatchMode.get()) {
         this->dispatchMode = (DispatchMode)DebugManager.flags.CsrDispatchMode.get();
     }
@@ -49,6 +52,8 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
 }
 
 CommandStreamReceiver::~CommandStreamReceiver() {
+    stopAdaptiveBatchingTimer();
+
     if (userPauseConfirmation) {
         *debugPauseStateAddress = DebugPauseState::terminate;
         userPauseConfirmation->join();
@@ -70,6 +75,12 @@ CommandStreamReceiver::~CommandStreamReceiver() {
     getMemoryManager()->unregisterEngineForCsr(this);
 }
 
+void CommandStreamReceiver::stopAdaptiveBatchingTimer() {
+    if (adaptiveBatchingController) {
+        adaptiveBatchingController->stop();
+    }
+}
+
 bool CommandStreamReceiver::submitBatchBuffer(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) {
     this->latestFlushedTaskCount = taskCount + 1;
     this->latestSentTaskCount = taskCount + 1;
@@ -179,6 +190,8 @@ void CommandStreamReceiver::cleanupResources() {
     waitForTaskCountAndCleanAllocationList(this->latestFlushedTaskCount, TEMPORARY_ALLOCATION);
     waitForTaskCountAndCleanAllocationList(this->latestFlushedTaskCount, REUSABLE_ALLOCATION);
 
+    hostStagingRing.reset();
+
     if (debugSurface) {
         getMemoryManager()->freeGraphicsMemory(debugSurface);
         debugSurface = nullptr;
@@ -307,6 +320,17 @@ GraphicsAllocation *CommandStreamReceiver::allocateDebugSurface(size_t size) {
     return debugSurface;
 }
 
+HostStagingRing *CommandStreamReceiver::getHostStagingRing() {
+    auto lock = obtainUniqueOwnership();
+    if (!hostStagingRing && tagAddress) {
+        auto allocation = getMemoryManager()->allocateGraphicsMemoryWithProperties({rootDeviceIndex, HostStagingRing::defaultRingSize, GraphicsAllocation::AllocationType::INTERNAL_HOST_MEMORY});
+        if (allocation) {
+            hostStagingRing = std::make_unique<HostStagingRing>(*getMemoryManager(), allocation, tagAddress);
+        }
+    }
+    return hostStagingRing.get();
+}
+
 IndirectHeap &CommandStreamReceiver::getIndirectHeap(IndirectHeap::Type heapType,
                                                      size_t minRequiredSize) {
     DEBUG_BREAK_IF(static_cast<uint32_t>(heapType) >= arrayCount(indirectHeap));
@@ -24,6 +24,7 @@
 #include <cstdint>
 
 namespace NEO {
+class AdaptiveBatchingController;
 class AllocationsList;
 class Device;
 class ExecutionEnvironment;
@@ -31,6 +32,7 @@ class ExperimentalCommandBuffer;
 class GmmPageTableMngr;
 class GraphicsAllocation;
 class HostPtrSurface;
+class HostStagingRing;
 class IndirectHeap;
 class InternalAllocationStorage;
 class LinearStream;
@@ -121,6 +123,8 @@ class CommandStreamReceiver {
     void enableNTo1SubmissionModel() { this->nTo1SubmissionModelEnabled = true; }
     bool isNTo1SubmissionModelEnabled() const { return this->nTo1SubmissionModelEnabled; }
     void overrideDispatchPolicy(DispatchMode overrideValue) { this->dispatchMode = overrideValue; }
+    AdaptiveBatchingController *getAdaptiveBatchingController() const { return adaptiveBatchingController.get(); }
+    void stopAdaptiveBatchingTimer();
 
     void setMediaVFEStateDirty(bool dirty) { mediaVfeStateDirty = dirty; }
 
@@ -130,6 +134,7 @@ class CommandStreamReceiver {
     GraphicsAllocation *allocateDebugSurface(size_t size);
     GraphicsAllocation *getPreemptionAllocation() const { return preemptionAllocation; }
     GraphicsAllocation *getGlobalFenceAllocation() const { return globalFenceAllocation; }
+    HostStagingRing *getHostStagingRing();
 
     void requestStallingPipeControlOnNextFlush() { stallingPipeControlOnNextFlushRequired = true; }
     bool isStallingPipeControlOnNextFlushRequired() const { return stallingPipeControlOnNextFlushRequired; }
@@ -220,6 +225,7 @@ class CommandStreamReceiver {
 
     std::unique_ptr<FlushStampTracker> flushStamp;
     std::unique_ptr<SubmissionAggregator> submissionAggregator;
+    std::unique_ptr<AdaptiveBatchingController> adaptiveBatchingController;
     std::unique_ptr<FlatBatchBufferHelper> flatBatchBufferHelper;
     std::unique_ptr<ExperimentalCommandBuffer> experimentalCmdBuffer;
     std::unique_ptr<InternalAllocationStorage> internalAllocationStorage;
@@ -228,6 +234,7 @@ class CommandStreamReceiver {
     std::unique_ptr<TagAllocator<HwTimeStamps>> profilingTimeStampAllocator;
     std::unique_ptr<TagAllocator<HwPerfCounter>> perfCounterAllocator;
     std::unique_ptr<TagAllocator<TimestampPacketStorage>> timestampPacketAllocator;
+    std::unique_ptr<HostStagingRing> hostStagingRing;
 
     ResidencyContainer residencyAllocations;
     ResidencyContainer evictionAllocations;
@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/command_stream/adaptive_batching_controller.h"
 #include "shared/source/command_stream/command_stream_receiver_hw.h"
 #include "shared/source/command_stream/experimental_command_buffer.h"
 #include "shared/source/command_stream/linear_stream.h"
@@ -28,6 +29,7 @@
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/enqueue_phase_profiler.h"
 #include "shared/source/utilities/tag_allocator.h"
 
 #include "command_stream_receiver_hw_ext.inl"
@@ -36,7 +38,10 @@
 namespace NEO {
 
 template <typename GfxFamily>
-CommandStreamReceiverHw<GfxFamily>::~CommandStreamReceiverHw() = default;
+CommandStreamReceiverHw<GfxFamily>::~CommandStreamReceiverHw() {
+    // Timer flushes through virtual methods of this class, it has to be joined before they are gone.
+    this->stopAdaptiveBatchingTimer();
+}
 
 template <typename GfxFamily>
 CommandStreamReceiverHw<GfxFamily>::CommandStreamReceiverHw(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex)
@@ -170,6 +175,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     DEBUG_BREAK_IF(&commandStreamTask == &commandStream);
     DEBUG_BREAK_IF(!(dispatchFlags.preemptionMode == PreemptionMode::Disabled ? device.getPreemptionMode() == PreemptionMode::Disabled : true));
     DEBUG_BREAK_IF(taskLevel >= CompletionStamp::notReady);
+    ENQUEUE_PHASE(FlushTask);
 
     DBG_LOG(LogTaskCounts, __FUNCTION__, "Line: ", __LINE__, "taskLevel", taskLevel);
 
@@ -501,8 +507,10 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
                             dispatchFlags.requiresCoherency, dispatchFlags.lowPriority, dispatchFlags.throttle, dispatchFlags.sliceCount,
                             streamToSubmit.getUsed(), &streamToSubmit, bbEndLocation};
 
+    bool adaptiveBatchingFlushRequired = false;
     if (submitCSR | submitTask) {
         if (this->dispatchMode == DispatchMode::ImmediateDispatch) {
+            ENQUEUE_PHASE(Flush);
             this->flush(batchBuffer, this->getResidencyAllocations());
             this->latestFlushedTaskCount = this->taskCount + 1;
             this->makeSurfacePackNonResident(this->getResidencyAllocations());
@@ -516,6 +524,12 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
             commandBuffer->pipeControlThatMayBeErasedLocation = currentPipeControlForNooping;
             commandBuffer->epiloguePipeControlLocation = epiloguePipeControlLocation;
             this->submissionAggregator->recordCommandBuffer(commandBuffer);
+
+            if (this->adaptiveBatchingController) {
+                bool gpuIdle = *getTagAddress() >= this->latestFlushedTaskCount;
+                auto flushReason = this->adaptiveBatchingController->commandBufferRecorded(batchBuffer.usedSize - batchBuffer.startOffset, gpuIdle);
+                adaptiveBatchingFlushRequired = flushReason != AdaptiveBatchingController::FlushReason::None;
+            }
         }
     } else {
         this->makeSurfacePackNonResident(this->getResidencyAllocations());
@@ -528,7 +542,7 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         }
     }
 
-    if (this->dispatchMode == DispatchMode::BatchedDispatch && (dispatchFlags.blocking || dispatchFlags.implicitFlush)) {
+    if (this->dispatchMode == DispatchMode::BatchedDispatch && (dispatchFlags.blocking || dispatchFlags.implicitFlush || adaptiveBatchingFlushRequired)) {
         this->flushBatchedSubmissions();
     }
 
@@ -576,6 +590,7 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
     if (this->dispatchMode == DispatchMode::ImmediateDispatch) {
         return true;
     }
+    ENQUEUE_PHASE(Flush);
     typedef typename GfxFamily::MI_BATCH_BUFFER_START MI_BATCH_BUFFER_START;
     typedef typename GfxFamily::PIPE_CONTROL PIPE_CONTROL;
     std::unique_lock<MutexType> lockGuard(ownershipMutex);
@@ -665,6 +680,10 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
         this->totalMemoryUsed = 0;
     }
 
+    if (this->adaptiveBatchingController) {
+        this->adaptiveBatchingController->batchFlushed();
+    }
+
     return submitResult;
 }
 
@@ -796,7 +815,8 @@ inline void CommandStreamReceiverHw<GfxFamily>::programPreamble(LinearStream &cs
 template <typename GfxFamily>
 inline void CommandStreamReceiverHw<GfxFamily>::programVFEState(LinearStream &csr, DispatchFlags &dispatchFlags, uint32_t maxFrontEndThreads) {
     if (mediaVfeStateDirty) {
-        auto commandOffset = PreambleHelper<GfxFamily>::programVFEState(&csr, peekHwInfo(), requiredScratchSize, getScratchPatchAddress(), maxFrontEndThreads, getOsContext().getEngineType());
+        auto perThreadScratchSize = std::max(requiredScratchSize, scratchSpaceController->getPerThreadScratchSpaceSize());
+        auto commandOffset = PreambleHelper<GfxFamily>::programVFEState(&csr, peekHwInfo(), perThreadScratchSize, getScratchPatchAddress(), maxFrontEndThreads, getOsContext().getEngineType());
         if (DebugManager.flags.AddPatchInfoCommentsForAUBDump.get()) {
             flatBatchBufferHelper->collectScratchSpacePatchInfo(getScratchPatchAddress(), commandOffset, csr);
         }
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/host_staging_ring.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+constexpr size_t HostStagingRing::defaultRingSize;
+constexpr size_t HostStagingRing::chunkAlignment;
+constexpr uint32_t HostStagingRing::notSubmittedTaskCount;
+
+HostStagingRing::HostStagingRing(MemoryManager &memoryManager, GraphicsAllocation *allocation, volatile uint32_t *tagAddress)
+    : memoryManager(memoryManager), allocation(allocation), tagAddress(tagAddress) {
+    UNRECOVERABLE_IF(allocation == nullptr || tagAddress == nullptr);
+    ringSize = alignDown(allocation->getUnderlyingBufferSize(), chunkAlignment);
+}
+
+HostStagingRing::~HostStagingRing() {
+    memoryManager.freeGraphicsMemory(allocation);
+}
+
+size_t HostStagingRing::getTransferSizeThreshold(size_t ringSize) {
+    auto threshold = DebugManager.flags.HostPtrStagingThreshold.get();
+    if (threshold <= 0) {
+        return 0u;
+    }
+    // Few large transfers would drain the ring, they are better served by pinning the host pointer.
+    return std::min(static_cast<size_t>(threshold), ringSize / 4);
+}
+
+bool HostStagingRing::obtainChunk(size_t size, HostStagingChunk &chunk) {
+    auto alignedSize = alignUp(size, chunkAlignment);
+    if (alignedSize == 0u || alignedSize > ringSize) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    reclaimCompletedChunks();
+
+    size_t offset = 0u;
+    if (chunks.empty()) {
+        writeOffset = 0u;
+        offset = 0u;
+    } else {
+        auto readOffset = chunks.front().offset;
+        if (writeOffset > readOffset) {
+            if (alignedSize <= ringSize - writeOffset) {
+                offset = writeOffset;
+            } else if (alignedSize <= readOffset) {
+                // Tail of the ring is too small, it is skipped and returns together with preceding chunks.
+                pushChunk(writeOffset, ringSize - writeOffset, 0u);
+                offset = 0u;
+            } else {
+                return false;
+            }
+        } else if (writeOffset < readOffset && alignedSize <= readOffset - writeOffset) {
+            offset = writeOffset;
+        } else {
+            return false;
+        }
+    }
+
+    auto newChunk = pushChunk(offset, alignedSize, notSubmittedTaskCount);
+    writeOffset = offset + alignedSize;
+    if (writeOffset == ringSize) {
+        writeOffset = 0u;
+    }
+
+    chunk.cpuPtr = ptrOffset(allocation->getUnderlyingBuffer(), offset);
+    chunk.gpuAddress = allocation->getGpuAddress() + offset;
+    chunk.id = newChunk->id;
+    return true;
+}
+
+void HostStagingRing::releaseChunk(const HostStagingChunk &chunk, uint32_t taskCount) {
+    std::lock_guard<std::mutex> lock(mtx);
+    // Chunks are usually released in the order they were obtained, the newest is searched first.
+    for (auto it = chunks.rbegin(); it != chunks.rend(); ++it) {
+        if (it->id == chunk.id) {
+            it->taskCount = taskCount;
+            break;
+        }
+    }
+    reclaimCompletedChunks();
+}
+
+size_t HostStagingRing::getUsedSize() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return usedSize;
+}
+
+void HostStagingRing::reclaimCompletedChunks() {
+    auto completedTaskCount = *tagAddress;
+    while (!chunks.empty()) {
+        auto &oldestChunk = chunks.front();
+        if (oldestChunk.taskCount == notSubmittedTaskCount || oldestChunk.taskCount > completedTaskCount) {
+            break;
+        }
+        usedSize -= oldestChunk.size;
+        chunks.pop_front();
+    }
+}
+
+HostStagingRing::Chunk *HostStagingRing::pushChunk(size_t offset, size_t size, uint32_t taskCount) {
+    chunks.push_back({nextChunkId++, offset, size, taskCount});
+    usedSize += size;
+    return &chunks.back();
+}
+
+} // namespace NEO
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <mutex>
+
+namespace NEO {
+
+class GraphicsAllocation;
+class MemoryManager;
+
+struct HostStagingChunk {
+    void *cpuPtr = nullptr;
+    uint64_t gpuAddress = 0u;
+    uint64_t id = 0u;
+};
+
+// Ring of host memory that is already resident for a command stream receiver. Small transfers from or
+// to host pointers are copied through it instead of creating and pinning an allocation for every pointer.
+// Chunks are handed out in FIFO order and return to the ring once the tag reaches their task count.
+class HostStagingRing : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultRingSize = 2 * MemoryConstants::megaByte;
+    static constexpr size_t chunkAlignment = MemoryConstants::cacheLineSize;
+    static constexpr uint32_t notSubmittedTaskCount = std::numeric_limits<uint32_t>::max();
+
+    HostStagingRing(MemoryManager &memoryManager, GraphicsAllocation *allocation, volatile uint32_t *tagAddress);
+    ~HostStagingRing();
+
+    // Largest transfer staged through the ring, 0 when staging is disabled.
+    static size_t getTransferSizeThreshold(size_t ringSize);
+
+    bool obtainChunk(size_t size, HostStagingChunk &chunk);
+    void releaseChunk(const HostStagingChunk &chunk, uint32_t taskCount);
+
+    GraphicsAllocation *getAllocation() const { return allocation; }
+    size_t getRingSize() const { return ringSize; }
+    size_t getUsedSize() const;
+
+  protected:
+    struct Chunk {
+        uint64_t id;
+        size_t offset;
+        size_t size;
+        uint32_t taskCount;
+    };
+
+    void reclaimCompletedChunks();
+    Chunk *pushChunk(size_t offset, size_t size, uint32_t taskCount);
+
+    MemoryManager &memoryManager;
+    GraphicsAllocation *allocation = nullptr;
+    volatile uint32_t *tagAddress = nullptr;
+    size_t ringSize = 0u;
+
+    mutable std::mutex mtx;
+    std::deque<Chunk> chunks;
+    size_t writeOffset = 0u;
+    size_t usedSize = 0u;
+    uint64_t nextChunkId = 1u;
+};
+
+} // namespace NEO
@@ -30,6 +30,7 @@ class LinearStream {
     size_t getUsed() const;
     void overrideMaxSize(size_t newMaxSize);
     void replaceBuffer(void *buffer, size_t bufferSize);
+    uint32_t getGeneration() const { return generation; }
     GraphicsAllocation *getGraphicsAllocation() const;
     void replaceGraphicsAllocation(GraphicsAllocation *gfxAllocation);
 
@@ -44,6 +45,7 @@ class LinearStream {
     size_t maxAvailableSpace;
     void *buffer;
     GraphicsAllocation *graphicsAllocation;
+    uint32_t generation = 0u;
 };
 
 inline void *LinearStream::getCpuBase() const {
@@ -78,6 +80,7 @@ inline void LinearStream::replaceBuffer(void *buffer, size_t bufferSize) {
     this->buffer = buffer;
     maxAvailableSpace = bufferSize;
     sizeUsed = 0;
+    generation++;
 }
 
 inline GraphicsAllocation *LinearStream::getGraphicsAllocation() const {
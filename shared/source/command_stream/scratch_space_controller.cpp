@@ -7,13 +7,18 @@
 
 #include "shared/source/command_stream/scratch_space_controller.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/hw_helper.h"
+#include "shared/source/helpers/interlocked_max.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
+#include <algorithm>
+
 namespace NEO {
 ScratchSpaceController::ScratchSpaceController(uint32_t rootDeviceIndex, ExecutionEnvironment &environment, InternalAllocationStorage &allocationStorage)
     : rootDeviceIndex(rootDeviceIndex), executionEnvironment(environment), csrAllocationStorage(allocationStorage) {
@@ -35,4 +40,23 @@ MemoryManager *ScratchSpaceController::getMemoryManager() const {
     UNRECOVERABLE_IF(executionEnvironment.memoryManager.get() == nullptr);
     return executionEnvironment.memoryManager.get();
 }
+
+bool ScratchSpaceController::isGeometricGrowthEnabled() {
+    return DebugManager.flags.EnableGeometricScratchSpaceGrowth.get() == 1;
+}
+
+void ScratchSpaceController::reserveScratchSpace(uint32_t perThreadScratchSize) {
+    interlockedMax(reservedPerThreadScratchSize, perThreadScratchSize);
+}
+
+// Growing scratch space replaces its allocation and reprograms state base address and VFE state, so with geometric
+// growth enabled it grows ahead of requirements: to reserved size, and to at least twice the current size.
+uint32_t ScratchSpaceController::getPerThreadScratchSizeToAllocate(uint32_t requiredPerThreadScratchSize) const {
+    if (!isGeometricGrowthEnabled()) {
+        return requiredPerThreadScratchSize;
+    }
+    auto sizeToAllocate = std::max({requiredPerThreadScratchSize, reservedPerThreadScratchSize.load(), 2 * perThreadScratchSize});
+    sizeToAllocate = std::min(Math::nextPowerOfTwo(sizeToAllocate), ScratchSpaceConstants::maxPerThreadScratchSize);
+    return std::max(sizeToAllocate, requiredPerThreadScratchSize);
+}
 } // namespace NEO
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/indirect_heap/indirect_heap.h"
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 
@@ -23,10 +24,19 @@ class OsContext;
 
 namespace ScratchSpaceConstants {
 constexpr size_t scratchSpaceOffsetFor64Bit = 4096u;
+constexpr uint32_t maxPerThreadScratchSize = 2 * 1024 * 1024;
 }
 
 class ScratchSpaceController {
   public:
+    struct Counters {
+        uint64_t allocations = 0u;
+        uint64_t reallocations = 0u;
+        uint64_t allocatedScratchSize = 0u;
+    };
+
+    static bool isGeometricGrowthEnabled();
+
     ScratchSpaceController(uint32_t rootDeviceIndex, ExecutionEnvironment &environment, InternalAllocationStorage &allocationStorage);
     virtual ~ScratchSpaceController();
 
@@ -48,8 +58,15 @@ class ScratchSpaceController {
 
     virtual void reserveHeap(IndirectHeap::Type heapType, IndirectHeap *&indirectHeap) = 0;
 
+    // Per thread scratch size kernels loaded for the device require, next scratch space grown is at least that big.
+    void reserveScratchSpace(uint32_t perThreadScratchSize);
+    // Per thread scratch size current scratch space is laid out for, it may exceed the size required so far.
+    uint32_t getPerThreadScratchSpaceSize() const { return perThreadScratchSize; }
+    const Counters &getCounters() const { return counters; }
+
   protected:
     MemoryManager *getMemoryManager() const;
+    uint32_t getPerThreadScratchSizeToAllocate(uint32_t requiredPerThreadScratchSize) const;
 
     const uint32_t rootDeviceIndex;
     ExecutionEnvironment &executionEnvironment;
@@ -60,5 +77,8 @@ class ScratchSpaceController {
     size_t privateScratchSizeBytes = 0;
     bool force32BitAllocation = false;
     uint32_t computeUnitsUsedForScratch = 0;
+    uint32_t perThreadScratchSize = 0u;
+    std::atomic<uint32_t> reservedPerThreadScratchSize{0u};
+    Counters counters;
 };
 } // namespace NEO
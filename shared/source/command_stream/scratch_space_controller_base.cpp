@@ -34,8 +34,10 @@ void ScratchSpaceControllerBase::setRequiredScratchSpace(void *sshBaseAddress,
         if (scratchAllocation) {
             scratchAllocation->updateTaskCount(currentTaskCount, osContext.getContextId());
             csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchAllocation), TEMPORARY_ALLOCATION);
+            counters.reallocations++;
         }
-        scratchSizeBytes = requiredScratchSizeInBytes;
+        perThreadScratchSize = getPerThreadScratchSizeToAllocate(requiredPerThreadScratchSize);
+        scratchSizeBytes = static_cast<size_t>(perThreadScratchSize) * computeUnitsUsedForScratch;
         createScratchSpaceAllocation();
         vfeStateDirty = true;
         force32BitAllocation = getMemoryManager()->peekForce32BitAllocations();
@@ -48,6 +50,8 @@ void ScratchSpaceControllerBase::setRequiredScratchSpace(void *sshBaseAddress,
 void ScratchSpaceControllerBase::createScratchSpaceAllocation() {
     scratchAllocation = getMemoryManager()->allocateGraphicsMemoryWithProperties({rootDeviceIndex, scratchSizeBytes, GraphicsAllocation::AllocationType::SCRATCH_SURFACE});
     UNRECOVERABLE_IF(scratchAllocation == nullptr);
+    counters.allocations++;
+    counters.allocatedScratchSize += scratchSizeBytes;
 }
 
 uint64_t ScratchSpaceControllerBase::calculateNewGSH() {
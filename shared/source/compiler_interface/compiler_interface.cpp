@@ -9,6 +9,7 @@
 
 #include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/compiler_interface/compiler_interface.inl"
+#include "shared/source/compiler_interface/in_memory_compiler_cache.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/hw_info.h"
@@ -36,6 +37,40 @@ enum CachingMode {
     PreProcess
 };
 
+namespace {
+// Owns the single-flight reservation taken in the in-memory cache on a miss.
+// Any exit path that did not store a binary releases it, so waiting builds can retry.
+struct InMemoryCacheReservation : NonCopyableOrMovableClass {
+    ~InMemoryCacheReservation() {
+        if (inMemoryCache && (false == kernelFileHash.empty())) {
+            inMemoryCache->abandon(kernelFileHash);
+        }
+    }
+
+    bool lookup(const std::string &hash, TranslationOutput &output) {
+        if (nullptr == inMemoryCache) {
+            return false;
+        }
+        output.deviceBinary.mem = inMemoryCache->acquire(hash, output.deviceBinary.size);
+        if (output.deviceBinary.mem) {
+            return true;
+        }
+        kernelFileHash = hash;
+        return false;
+    }
+
+    void store(const char *binary, size_t binarySize) {
+        if (inMemoryCache && (false == kernelFileHash.empty())) {
+            inMemoryCache->store(kernelFileHash, binary, binarySize);
+            kernelFileHash.clear();
+        }
+    }
+
+    InMemoryCompilerCache *inMemoryCache = nullptr;
+    std::string kernelFileHash;
+};
+} // namespace
+
 CompilerInterface::CompilerInterface()
     : cache() {
 }
@@ -66,14 +101,21 @@ TranslationOutput::ErrorCode CompilerInterface::build(
         }
     }
 
+    InMemoryCacheReservation inMemoryCacheReservation;
+    inMemoryCacheReservation.inMemoryCache = inMemoryCache.get();
+
     std::string kernelFileHash;
     if (cachingMode == CachingMode::Direct) {
         kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(),
                                                           input.src,
                                                           input.apiOptions,
                                                           input.internalOptions);
+        if (inMemoryCacheReservation.lookup(kernelFileHash, output)) {
+            return TranslationOutput::ErrorCode::Success;
+        }
         output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
         if (output.deviceBinary.mem) {
+            inMemoryCacheReservation.store(output.deviceBinary.mem.get(), output.deviceBinary.size);
             return TranslationOutput::ErrorCode::Success;
         }
     }
@@ -125,8 +167,12 @@ TranslationOutput::ErrorCode CompilerInterface::build(
         kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(), ArrayRef<const char>(intermediateRepresentation->GetMemory<char>(), intermediateRepresentation->GetSize<char>()),
                                                           input.apiOptions,
                                                           input.internalOptions);
+        if (inMemoryCacheReservation.lookup(kernelFileHash, output)) {
+            return TranslationOutput::ErrorCode::Success;
+        }
         output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
         if (output.deviceBinary.mem) {
+            inMemoryCacheReservation.store(output.deviceBinary.mem.get(), output.deviceBinary.size);
             return TranslationOutput::ErrorCode::Success;
         }
     }
@@ -148,6 +194,7 @@ TranslationOutput::ErrorCode CompilerInterface::build(
 
     if (input.allowCaching) {
         cache->cacheBinary(kernelFileHash, igcOutput->GetOutput()->GetMemory<char>(), static_cast<uint32_t>(igcOutput->GetOutput()->GetSize<char>()));
+        inMemoryCacheReservation.store(igcOutput->GetOutput()->GetMemory<char>(), igcOutput->GetOutput()->GetSize<char>());
     }
 
     TranslationOutput::makeCopy(output.deviceBinary, igcOutput->GetOutput());
@@ -343,6 +390,10 @@ bool CompilerInterface::initialize(std::unique_ptr<CompilerCache> cache, bool re
 
     this->cache.swap(cache);
 
+    if (DebugManager.flags.EnableInMemoryCompilerCache.get() == 1) {
+        this->inMemoryCache = std::make_unique<InMemoryCompilerCache>(InMemoryCompilerCache::defaultMaxCachedSize);
+    }
+
     return this->cache && igcAvailable && (fclAvailable || (false == requireFcl));
 }
 
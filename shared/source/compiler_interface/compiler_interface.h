@@ -23,6 +23,7 @@
 
 namespace NEO {
 class Device;
+class InMemoryCompilerCache;
 
 using specConstValuesMap = std::unordered_map<uint32_t, uint64_t>;
 
@@ -145,6 +146,7 @@ class CompilerInterface {
         return std::unique_lock<SpinLock>{spinlock};
     }
     std::unique_ptr<CompilerCache> cache = nullptr;
+    std::unique_ptr<InMemoryCompilerCache> inMemoryCache;
 
     using igcDevCtxUptr = CIF::RAII::UPtr_t<IGC::IgcOclDeviceCtxTagOCL>;
     using fclDevCtxUptr = CIF::RAII::UPtr_t<IGC::FclOclDeviceCtxTagOCL>;
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/in_memory_compiler_cache.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NEO {
+
+constexpr size_t InMemoryCompilerCache::defaultMaxCachedSize;
+
+InMemoryCompilerCache::InMemoryCompilerCache(size_t maxCachedSize) : maxCachedSize(maxCachedSize) {}
+
+std::unique_ptr<char[]> InMemoryCompilerCache::acquire(const std::string &kernelFileHash, size_t &binarySize) {
+    std::unique_lock<std::mutex> lock(mtx);
+    bool waited = false;
+    while (true) {
+        auto it = entries.find(kernelFileHash);
+        if (it == entries.end()) {
+            entries.insert({kernelFileHash, std::make_shared<Entry>()});
+            return nullptr;
+        }
+
+        // hold a reference, so the result survives eviction while waiting
+        auto entry = it->second;
+        if (entry->inFlight) {
+            if (false == waited) {
+                coalescedRequests++;
+                waited = true;
+            }
+            buildFinished.wait(lock, [&entry] { return false == entry->inFlight; });
+        }
+
+        if (entry->valid) {
+            hits++;
+            binarySize = entry->binary.size();
+            auto binary = std::unique_ptr<char[]>(new char[binarySize]);
+            memcpy(binary.get(), entry->binary.data(), binarySize);
+            return binary;
+        }
+        // builder gave up, retry and possibly become the builder
+    }
+}
+
+void InMemoryCompilerCache::store(const std::string &kernelFileHash, const char *binary, size_t binarySize) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = entries.find(kernelFileHash);
+    if ((it == entries.end()) || (false == it->second->inFlight)) {
+        return;
+    }
+    auto &entry = *it->second;
+    if (entry.valid) {
+        cachedSize -= entry.binary.size();
+    }
+    entry.binary.assign(binary, binary + binarySize);
+    entry.valid = true;
+    entry.inFlight = false;
+    cachedSize += binarySize;
+    // key stored again becomes the newest one, it has to be listed once so it is evicted once
+    auto position = std::find(storeOrder.begin(), storeOrder.end(), kernelFileHash);
+    if (position != storeOrder.end()) {
+        storeOrder.erase(position);
+    }
+    storeOrder.push_back(kernelFileHash);
+    evict();
+    buildFinished.notify_all();
+}
+
+void InMemoryCompilerCache::abandon(const std::string &kernelFileHash) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = entries.find(kernelFileHash);
+    if ((it == entries.end()) || (false == it->second->inFlight)) {
+        return;
+    }
+    it->second->inFlight = false;
+    entries.erase(it);
+    buildFinished.notify_all();
+}
+
+void InMemoryCompilerCache::evict() {
+    while ((cachedSize > maxCachedSize) && (false == storeOrder.empty())) {
+        auto it = entries.find(storeOrder.front());
+        storeOrder.pop_front();
+        if ((it != entries.end()) && it->second->valid) {
+            cachedSize -= it->second->binary.size();
+            entries.erase(it);
+        }
+    }
+}
+
+size_t InMemoryCompilerCache::getCachedEntriesCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return storeOrder.size();
+}
+
+size_t InMemoryCompilerCache::getCachedSize() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return cachedSize;
+}
+
+uint64_t InMemoryCompilerCache::getHitsCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return hits;
+}
+
+uint64_t InMemoryCompilerCache::getCoalescedRequestsCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return coalescedRequests;
+}
+
+} // namespace NEO
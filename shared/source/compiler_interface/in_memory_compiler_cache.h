@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+
+// In-process front of CompilerCache, keyed with the same hash.
+// A lookup that misses makes the caller the only builder of that key: concurrent
+// lookups for the same key wait for it to store() or abandon() instead of compiling too.
+class InMemoryCompilerCache : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t defaultMaxCachedSize = 64 * 1024 * 1024;
+
+    InMemoryCompilerCache(size_t maxCachedSize);
+
+    std::unique_ptr<char[]> acquire(const std::string &kernelFileHash, size_t &binarySize);
+    void store(const std::string &kernelFileHash, const char *binary, size_t binarySize);
+    void abandon(const std::string &kernelFileHash);
+
+    size_t getCachedEntriesCount();
+    size_t getCachedSize();
+    uint64_t getHitsCount();
+    uint64_t getCoalescedRequestsCount();
+
+  protected:
+    struct Entry {
+        std::vector<char> binary;
+        bool inFlight = true;
+        bool valid = false;
+    };
+
+    void evict();
+
+    const size_t maxCachedSize;
+    size_t cachedSize = 0u;
+    uint64_t hits = 0u;
+    uint64_t coalescedRequests = 0u;
+    std::unordered_map<std::string, std::shared_ptr<Entry>> entries;
+    std::deque<std::string> storeOrder;
+    std::mutex mtx;
+    std::condition_variable buildFinished;
+};
+
+} // namespace NEO
@@ -122,6 +122,41 @@ DECLARE_DEBUG_VARIABLE(bool, DisableStatelessToStatefulOptimization, false, "Dis
 DECLARE_DEBUG_VARIABLE(bool, DisableConcurrentBlockExecution, false, "disables concurrent block kernel execution")
 DECLARE_DEBUG_VARIABLE(bool, UseNoRingFlushesKmdMode, true, "Windows only, passes flag to KMD that informs KMD to not emit any ring buffer flushes.")
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForUseHostPtr, false, "When active all buffer allocations created with CL_MEM_USE_HOST_PTR flag will not share memory with CPU.")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableEventPoolSlabAllocator, -1, "-1: default (disabled), 0: disable, 1: enable. Level Zero event pools are sub-allocated from shared per-device allocations and event objects are recycled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableReusableAllocationsIndex, -1, "-1: default (disabled), 0: disable, 1: enable. Reusable internal allocations are indexed by allocation type and size class instead of a single list")
+DECLARE_DEBUG_VARIABLE(int32_t, ReusableAllocationsMaxRetainedSize, -1, "-1: default (256MB), >=0: max size in bytes of completed reusable allocations retained per command stream receiver when EnableReusableAllocationsIndex is set")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableUnifiedMemoryPooling, -1, "-1: default (disabled), 0: disable, 1: enable. Small host and device USM allocations are sub-allocated from per-device pools, pooled allocations cannot be exported with IPC handles")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableInMemoryCompilerCache, -1, "-1: default (disabled), 0: disable, 1: enable. Keep built binaries in process memory and let concurrent builds of the same source wait for a single compilation")
+DECLARE_DEBUG_VARIABLE(int32_t, CsrAdaptiveBatchingDeadlineUs, -1, "-1: default (disabled), >0: in BatchedDispatch flush recorded command buffers once the oldest one waited given number of microseconds")
+DECLARE_DEBUG_VARIABLE(int32_t, CsrAdaptiveBatchingMaxCommandBuffers, -1, "-1: default (disabled), >0: in BatchedDispatch flush once given number of command buffers is recorded")
+DECLARE_DEBUG_VARIABLE(int32_t, CsrAdaptiveBatchingMaxSize, -1, "-1: default (disabled), >0: in BatchedDispatch flush once recorded command buffers exceed given size in bytes")
+DECLARE_DEBUG_VARIABLE(int32_t, CsrAdaptiveBatchingFlushOnGpuIdle, -1, "-1: default (disabled), 0: disable, 1: enable. In BatchedDispatch flush recorded command buffers right away when GPU completed all submitted work")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterCopyPlanner, -1, "-1: default (disabled), 0: disable, 1: enable. Buffer blits use the widest color depth allowed by alignment and rect copies are collapsed into 2D blits")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHybridBufferCopy, -1, "-1: default (disabled), 0: disable, 1: enable. Large clEnqueueCopyBuffer operations are split between blitter and compute engines")
+DECLARE_DEBUG_VARIABLE(int32_t, HybridBufferCopyMinSize, -1, "-1: default (64MB), >=0: minimal size in bytes of a buffer copy split between blitter and compute engines")
+DECLARE_DEBUG_VARIABLE(int32_t, HybridBufferCopyBlitterPercentage, -1, "-1: default (learned from measured engine throughput), 0-100: fixed percentage of a split buffer copy done by blitter")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSysmanSysfsReader, -1, "-1: default (disabled), 0: disable, 1: enable. Sysman keeps sysfs attributes open and rereads them with pread")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanSysfsReaderTtlUs, -1, "-1: default (0), >=0: time in microseconds for which a value read by sysman sysfs reader is reused")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableMetricTracerDrainer, -1, "-1: default (disabled), 0: disable, 1: enable. Metric tracer drains oa reports into a ring buffer on a background thread")
+DECLARE_DEBUG_VARIABLE(int32_t, MetricTracerDrainerRingSize, -1, "-1: default (8 oa buffers), >0: number of reports held by metric tracer ring buffer")
+DECLARE_DEBUG_VARIABLE(int32_t, MetricTracerDrainerHighWater, -1, "-1: default (notifyEveryNReports), >0: number of drained reports that signals metric tracer notification event")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCpuGpuTimeCorrelation, -1, "-1: default (disabled), 0: disable, 1: enable. Cpu/gpu timestamp pairs are predicted from periodically measured ones instead of reading gpu timestamp register on each query")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuGpuTimeCorrelationResyncPeriodMs, -1, "-1: default (100 ms), >0: time in milliseconds after which cpu/gpu timestamp pair is measured again")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuGpuTimeCorrelationMaxErrorNs, -1, "-1: default (10000 ns), >0: prediction error in nanoseconds above which cpu/gpu timestamp correlation is calibrated again")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableParallelDeviceProbe, -1, "-1: default (disabled), 0: disabled, 1: enabled; query render nodes on separate threads during device discovery")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDeviceProbeCache, -1, "-1: default (disabled), 0: disabled, 1: enabled; reuse render node query results stored by an earlier process within the same boot")
+DECLARE_DEBUG_VARIABLE(std::string, DeviceProbeCacheDir, std::string("unk"), "unk: default (XDG_RUNTIME_DIR), otherwise directory for the device probe cache file")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSurfaceStateHeapCache, -1, "-1: default (disabled), 0: disabled, 1: enabled; reuse surface states and binding table already pushed to surface state heap when kernel arguments did not change")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableEnqueuePhaseProfiler, -1, "-1: default (disabled), 0: disabled, 1: enabled; collect host time of enqueue phases, requires build with ENQUEUE_PHASE_PROFILING=1, dumped to EnqueuePhaseProfile.log at exit and when EnqueuePhaseProfile.request file is created")
+DECLARE_DEBUG_VARIABLE(int32_t, EnqueuePhaseProfilerDumpInterval, -1, "-1: default (dump at exit only), >0: additionally dump enqueue phase profile every n dispatches")
+DECLARE_DEBUG_VARIABLE(int32_t, HostPtrStagingThreshold, -1, "-1: default (disabled), 0: disabled, >0: size in bytes up to which buffer reads and writes with host pointers are copied through staging ring of command stream receiver")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDispatchStateReuse, -1, "-1: default (disabled), 0: disabled, 1: enabled; consecutive identical dispatches in a command list reuse surface states, indirect data and interface descriptor of the previous one")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuMappingCacheMaxSize, -1, "-1: default (disabled), 0: disabled, >0: max size in bytes of idle CPU mappings of unlocked buffer objects kept for next lock")
+DECLARE_DEBUG_VARIABLE(int32_t, KernelInitializationThreadCount, -1, "-1: default (serial), 0: use all hardware threads, >0: max number of threads initializing kernels of a program or module")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLazyKernelInitialization, -1, "-1: default (disabled), 0: disabled, 1: enabled; kernels of a module without linker input are initialized on first kernel create")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableGeometricScratchSpaceGrowth, -1, "-1: default (disabled), 0: disabled, 1: enabled; scratch space grows to power of two at least twice its size and is pre-reserved for kernels of loaded modules")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableTimestampPacketDependencyPruning, -1, "-1: default (disabled), 0: disabled, 1: enabled; timestamp packet dependencies already completed, duplicated or implied by later event of the same in order queue are not waited for")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSizeEstimateCache, -1, "-1: default (disabled), 0: disabled, 1: enabled, 2: enabled and every cached estimate verified against fresh one; kernels memoise command stream and heap size estimates of enqueues")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
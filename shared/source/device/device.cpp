@@ -10,6 +10,7 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/experimental_command_buffer.h"
 #include "shared/source/command_stream/preemption.h"
+#include "shared/source/command_stream/scratch_space_controller.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/hw_helper.h"
@@ -37,6 +38,7 @@ Device::~Device() {
     }
 
     for (auto &engine : engines) {
+        engine.commandStreamReceiver->stopAdaptiveBatchingTimer();
         engine.commandStreamReceiver->flushBatchedSubmissions();
     }
 
@@ -215,6 +217,12 @@ EngineControl &Device::getEngine(uint32_t index) {
     return engines[index];
 }
 
+void Device::reserveScratchSpace(uint32_t perThreadScratchSize) {
+    for (auto &engine : engines) {
+        engine.commandStreamReceiver->getScratchSpaceController()->reserveScratchSpace(perThreadScratchSize);
+    }
+}
+
 bool Device::getDeviceAndHostTimer(uint64_t *deviceTimestamp, uint64_t *hostTimestamp) const {
     TimeStampData queueTimeStamp;
     bool retVal = getOSTime()->getCpuGpuTime(&queueTimeStamp);
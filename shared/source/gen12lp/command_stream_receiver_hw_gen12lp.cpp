@@ -60,9 +60,19 @@ void populateFactoryTable<CommandStreamReceiverHw<Family>>() {
 }
 
 template <>
-void BlitCommandsHelper<Family>::appendColorDepth(const BlitProperties &blitProperites, typename Family::XY_COPY_BLT &blitCmd) {
+uint64_t BlitCommandsHelper<Family>::getMaxBlitPitch() {
+    return 0x3FFC0; // 0x3FFFF aligned to cacheline size
+}
+
+template <>
+uint32_t BlitCommandsHelper<Family>::getMaxBytesPerPixelForBufferCopy() {
+    return 16;
+}
+
+template <>
+void BlitCommandsHelper<Family>::appendColorDepthForBytesPerPixel(size_t bytesPerPixel, typename Family::XY_COPY_BLT &blitCmd) {
     using XY_COPY_BLT = typename Family::XY_COPY_BLT;
-    switch (blitProperites.bytesPerPixel) {
+    switch (bytesPerPixel) {
     default:
         UNRECOVERABLE_IF(true);
     case 1:
@@ -83,6 +93,11 @@ void BlitCommandsHelper<Family>::appendColorDepth(const BlitProperties &blitProp
     }
 }
 
+template <>
+void BlitCommandsHelper<Family>::appendColorDepth(const BlitProperties &blitProperites, typename Family::XY_COPY_BLT &blitCmd) {
+    appendColorDepthForBytesPerPixel(blitProperites.bytesPerPixel, blitCmd);
+}
+
 template <>
 void BlitCommandsHelper<Family>::appendTilingType(const GMM_TILE_TYPE srcTilingType, const GMM_TILE_TYPE dstTilingType, typename Family::XY_COPY_BLT &blitCmd) {
     using XY_COPY_BLT = typename Family::XY_COPY_BLT;
@@ -77,15 +77,34 @@ struct BlitProperties {
     Vec3<uint32_t> srcSize = 0;
 };
 
+struct BlitCopyRegion {
+    uint64_t srcAddress = 0;
+    uint64_t dstAddress = 0;
+    uint64_t width = 0;
+    uint64_t height = 0;
+    uint64_t srcPitch = 0;
+    uint64_t dstPitch = 0;
+    uint32_t bytesPerPixel = 1;
+};
+
 template <typename GfxFamily>
 struct BlitCommandsHelper {
     using COLOR_DEPTH = typename GfxFamily::XY_COLOR_BLT::COLOR_DEPTH;
     static uint64_t getMaxBlitWidth();
     static uint64_t getMaxBlitHeight();
+    static uint64_t getMaxBlitPitch();
+    static uint32_t getMaxBytesPerPixelForBufferCopy();
     static void dispatchPostBlitCommand(LinearStream &linearStream);
     static size_t estimatePostBlitCommandSize();
     static size_t estimateBlitCommandsSize(Vec3<size_t> copySize, const CsrDependencies &csrDependencies, bool updateTimestampPacket, bool profilingEnabled);
     static size_t estimateBlitCommandsSize(const BlitPropertiesContainer &blitPropertiesContainer, const HardwareInfo &hwInfo, bool profilingEnabled, bool debugPauseEnabled);
+    static size_t estimateBlitCommandsSizeForNumberOfBlits(size_t numberOfBlits, const CsrDependencies &csrDependencies, bool updateTimestampPacket, bool profilingEnabled);
+    static size_t getNumberOfBlitCommandsForBuffer(const BlitProperties &blitProperties);
+    template <typename RegionHandlerT>
+    static void planBlitCommandsForBuffer(const BlitProperties &blitProperties, RegionHandlerT &&regionHandler);
+    template <typename RegionHandlerT>
+    static void planLinearBlitCopy(uint64_t srcAddress, uint64_t dstAddress, uint64_t size, uint32_t bytesPerPixel, RegionHandlerT &&regionHandler);
+    static uint32_t selectBytesPerPixelForLinearCopy(uint64_t srcAddress, uint64_t dstAddress, uint64_t size);
     static uint64_t calculateBlitCommandDestinationBaseAddress(const BlitProperties &blitProperties, uint64_t offset, uint64_t row, uint64_t slice);
     static uint64_t calculateBlitCommandSourceBaseAddress(const BlitProperties &blitProperties, uint64_t offset, uint64_t row, uint64_t slice);
     static void dispatchBlitCommandsForBuffer(const BlitProperties &blitProperties, LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment);
@@ -96,6 +115,7 @@ struct BlitCommandsHelper {
     static void appendBlitCommandsForBuffer(const BlitProperties &blitProperties, typename GfxFamily::XY_COPY_BLT &blitCmd, const RootDeviceEnvironment &rootDeviceEnvironment);
     static void appendBlitCommandsForImages(const BlitProperties &blitProperties, typename GfxFamily::XY_COPY_BLT &blitCmd);
     static void appendColorDepth(const BlitProperties &blitProperties, typename GfxFamily::XY_COPY_BLT &blitCmd);
+    static void appendColorDepthForBytesPerPixel(size_t bytesPerPixel, typename GfxFamily::XY_COPY_BLT &blitCmd);
     static void appendBlitCommandsForFillBuffer(NEO::GraphicsAllocation *dstAlloc, typename GfxFamily::XY_COLOR_BLT &blitCmd, const RootDeviceEnvironment &rootDeviceEnvironment);
     static void appendSurfaceType(const BlitProperties &blitProperties, typename GfxFamily::XY_COPY_BLT &blitCmd);
     static void appendTilingEnable(typename GfxFamily::XY_COLOR_BLT &blitCmd);
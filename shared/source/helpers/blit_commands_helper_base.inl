@@ -13,6 +13,8 @@
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/timestamp_packet.h"
 
+#include <limits>
+
 namespace NEO {
 
 template <typename GfxFamily>
@@ -61,30 +63,17 @@ size_t BlitCommandsHelper<GfxFamily>::estimatePostBlitCommandSize() {
 
 template <typename GfxFamily>
 size_t BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(Vec3<size_t> copySize, const CsrDependencies &csrDependencies, bool updateTimestampPacket, bool profilingEnabled) {
-    size_t numberOfBlits = 0;
-    uint64_t width = 1;
-    uint64_t height = 1;
+    // Only size is known, so the copy is planned as packed rows and slices at aligned addresses.
+    BlitProperties blitProperties = {};
+    blitProperties.copySize = copySize;
+    blitProperties.srcRowPitch = blitProperties.dstRowPitch = copySize.x;
+    blitProperties.srcSlicePitch = blitProperties.dstSlicePitch = copySize.x * copySize.y;
 
-    for (uint64_t slice = 0; slice < copySize.z; slice++) {
-        for (uint64_t row = 0; row < copySize.y; row++) {
-            uint64_t sizeToBlit = copySize.x;
-            while (sizeToBlit != 0) {
-                if (sizeToBlit > getMaxBlitWidth()) {
-                    // dispatch 2D blit: maxBlitWidth x (1 .. maxBlitHeight)
-                    width = getMaxBlitWidth();
-                    height = std::min((sizeToBlit / width), getMaxBlitHeight());
-
-                } else {
-                    // dispatch 1D blt: (1 .. maxBlitWidth) x 1
-                    width = sizeToBlit;
-                    height = 1;
-                }
-                sizeToBlit -= (width * height);
-                numberOfBlits++;
-            }
-        }
-    }
+    return estimateBlitCommandsSizeForNumberOfBlits(getNumberOfBlitCommandsForBuffer(blitProperties), csrDependencies, updateTimestampPacket, profilingEnabled);
+}
 
+template <typename GfxFamily>
+size_t BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSizeForNumberOfBlits(size_t numberOfBlits, const CsrDependencies &csrDependencies, bool updateTimestampPacket, bool profilingEnabled) {
     const size_t cmdsSizePerBlit = (sizeof(typename GfxFamily::XY_COPY_BLT) + estimatePostBlitCommandSize());
 
     size_t timestampCmdSize = 0;
@@ -104,8 +93,8 @@ template <typename GfxFamily>
 size_t BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(const BlitPropertiesContainer &blitPropertiesContainer, const HardwareInfo &hwInfo, bool profilingEnabled, bool debugPauseEnabled) {
     size_t size = 0;
     for (auto &blitProperties : blitPropertiesContainer) {
-        size += BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(blitProperties.copySize, blitProperties.csrDependencies,
-                                                                        blitProperties.outputTimestampPacket != nullptr, profilingEnabled);
+        size += BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSizeForNumberOfBlits(getNumberOfBlitCommandsForBuffer(blitProperties), blitProperties.csrDependencies,
+                                                                                        blitProperties.outputTimestampPacket != nullptr, profilingEnabled);
     }
     size += MemorySynchronizationCommands<GfxFamily>::getSizeForAdditonalSynchronization(hwInfo);
     size += EncodeMiFlushDW<GfxFamily>::getMiFlushDwCmdSizeForDataWrite() + sizeof(typename GfxFamily::MI_BATCH_BUFFER_END);
@@ -136,54 +125,150 @@ uint64_t BlitCommandsHelper<GfxFamily>::calculateBlitCommandSourceBaseAddress(co
 }
 
 template <typename GfxFamily>
-void BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsForBuffer(const BlitProperties &blitProperties, LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment) {
-    uint64_t width = 1;
-    uint64_t height = 1;
-
-    for (uint64_t slice = 0; slice < blitProperties.copySize.z; slice++) {
-        for (uint64_t row = 0; row < blitProperties.copySize.y; row++) {
-            uint64_t offset = 0;
-            uint64_t sizeToBlit = blitProperties.copySize.x;
-            while (sizeToBlit != 0) {
-                if (sizeToBlit > getMaxBlitWidth()) {
-                    // dispatch 2D blit: maxBlitWidth x (1 .. maxBlitHeight)
-                    width = getMaxBlitWidth();
-                    height = std::min((sizeToBlit / width), getMaxBlitHeight());
-                } else {
-                    // dispatch 1D blt: (1 .. maxBlitWidth) x 1
-                    width = sizeToBlit;
-                    height = 1;
-                }
+size_t BlitCommandsHelper<GfxFamily>::getNumberOfBlitCommandsForBuffer(const BlitProperties &blitProperties) {
+    size_t numberOfBlits = 0;
+    planBlitCommandsForBuffer(blitProperties, [&numberOfBlits](const BlitCopyRegion &) { numberOfBlits++; });
+    return numberOfBlits;
+}
 
-                {
-                    auto bltCmd = GfxFamily::cmdInitXyCopyBlt;
+template <typename GfxFamily>
+template <typename RegionHandlerT>
+void BlitCommandsHelper<GfxFamily>::planLinearBlitCopy(uint64_t srcAddress, uint64_t dstAddress, uint64_t size, uint32_t bytesPerPixel, RegionHandlerT &&regionHandler) {
+    // unaligned head and tail are copied byte-wise, the body with the requested color depth
+    uint64_t headSize = std::min(static_cast<uint64_t>((bytesPerPixel - (dstAddress % bytesPerPixel)) % bytesPerPixel), size);
+    uint64_t pixelsToBlit = (size - headSize) / bytesPerPixel;
+    uint64_t tailSize = size - headSize - pixelsToBlit * bytesPerPixel;
+    uint64_t maxWidth = std::min(getMaxBlitWidth(), getMaxBlitPitch() / bytesPerPixel);
+
+    if (headSize != 0) {
+        regionHandler(BlitCopyRegion{srcAddress, dstAddress, headSize, 1, headSize, headSize, 1});
+        srcAddress += headSize;
+        dstAddress += headSize;
+    }
 
-                    bltCmd.setTransferWidth(static_cast<uint32_t>(width));
-                    bltCmd.setTransferHeight(static_cast<uint32_t>(height));
-                    bltCmd.setDestinationPitch(static_cast<uint32_t>(width));
-                    bltCmd.setSourcePitch(static_cast<uint32_t>(width));
+    while (pixelsToBlit != 0) {
+        uint64_t width = 1;
+        uint64_t height = 1;
+        if (pixelsToBlit > maxWidth) {
+            // dispatch 2D blit: maxWidth x (1 .. maxBlitHeight)
+            width = maxWidth;
+            height = std::min((pixelsToBlit / width), getMaxBlitHeight());
+        } else {
+            // dispatch 1D blt: (1 .. maxWidth) x 1
+            width = pixelsToBlit;
+        }
+        auto pitch = width * bytesPerPixel;
+        regionHandler(BlitCopyRegion{srcAddress, dstAddress, width, height, pitch, pitch, bytesPerPixel});
 
-                    auto dstAddr = calculateBlitCommandDestinationBaseAddress(blitProperties, offset, row, slice);
-                    auto srcAddr = calculateBlitCommandSourceBaseAddress(blitProperties, offset, row, slice);
+        pixelsToBlit -= width * height;
+        srcAddress += pitch * height;
+        dstAddress += pitch * height;
+    }
 
-                    bltCmd.setDestinationBaseAddress(dstAddr);
-                    bltCmd.setSourceBaseAddress(srcAddr);
+    if (tailSize != 0) {
+        regionHandler(BlitCopyRegion{srcAddress, dstAddress, tailSize, 1, tailSize, tailSize, 1});
+    }
+}
 
-                    appendBlitCommandsForBuffer(blitProperties, bltCmd, rootDeviceEnvironment);
+template <typename GfxFamily>
+uint32_t BlitCommandsHelper<GfxFamily>::selectBytesPerPixelForLinearCopy(uint64_t srcAddress, uint64_t dstAddress, uint64_t size) {
+    uint32_t selectedBytesPerPixel = 1;
+    size_t selectedNumberOfBlits = std::numeric_limits<size_t>::max();
 
-                    auto bltStream = linearStream.getSpaceForCmd<typename GfxFamily::XY_COPY_BLT>();
-                    *bltStream = bltCmd;
-                }
+    for (uint32_t bytesPerPixel = getMaxBytesPerPixelForBufferCopy(); bytesPerPixel >= 1; bytesPerPixel /= 2) {
+        if ((srcAddress % bytesPerPixel) != (dstAddress % bytesPerPixel)) {
+            continue;
+        }
+        size_t numberOfBlits = 0;
+        planLinearBlitCopy(srcAddress, dstAddress, size, bytesPerPixel, [&numberOfBlits](const BlitCopyRegion &) { numberOfBlits++; });
+        // on equal command count prefer the wider color depth
+        if (numberOfBlits < selectedNumberOfBlits) {
+            selectedNumberOfBlits = numberOfBlits;
+            selectedBytesPerPixel = bytesPerPixel;
+        }
+    }
+    return selectedBytesPerPixel;
+}
 
-                dispatchPostBlitCommand(linearStream);
+template <typename GfxFamily>
+template <typename RegionHandlerT>
+void BlitCommandsHelper<GfxFamily>::planBlitCommandsForBuffer(const BlitProperties &blitProperties, RegionHandlerT &&regionHandler) {
+    auto &copySize = blitProperties.copySize;
+    bool optimizedPlan = (DebugManager.flags.EnableBlitterCopyPlanner.get() == 1) &&
+                         (blitProperties.auxTranslationDirection == AuxTranslationDirection::None);
+
+    if (optimizedPlan && copySize.x != 0 && copySize.y != 0 && copySize.z != 0) {
+        auto srcAddress = calculateBlitCommandSourceBaseAddress(blitProperties, 0, 0, 0);
+        auto dstAddress = calculateBlitCommandDestinationBaseAddress(blitProperties, 0, 0, 0);
+
+        bool rowsPacked = (copySize.y == 1) || (blitProperties.srcRowPitch == copySize.x && blitProperties.dstRowPitch == copySize.x);
+        bool slicesPacked = (copySize.z == 1) || (blitProperties.srcSlicePitch == copySize.x * copySize.y && blitProperties.dstSlicePitch == copySize.x * copySize.y);
+        if (rowsPacked && slicesPacked) {
+            uint64_t size = copySize.x * copySize.y * copySize.z;
+            planLinearBlitCopy(srcAddress, dstAddress, size, selectBytesPerPixelForLinearCopy(srcAddress, dstAddress, size), regionHandler);
+            return;
+        }
 
-                auto blitSize = width * height;
-                sizeToBlit -= blitSize;
-                offset += blitSize;
+        // rows of a rect copy become one 2D blit using row pitches, if every row of every slice starts equally aligned
+        bool rowsCollapsible = (copySize.y > 1) &&
+                               (blitProperties.srcRowPitch >= copySize.x) && (blitProperties.srcRowPitch <= getMaxBlitPitch()) &&
+                               (blitProperties.dstRowPitch >= copySize.x) && (blitProperties.dstRowPitch <= getMaxBlitPitch());
+        if (rowsCollapsible) {
+            for (uint32_t bytesPerPixel = getMaxBytesPerPixelForBufferCopy(); bytesPerPixel >= 1; bytesPerPixel /= 2) {
+                bool aligned = (srcAddress % bytesPerPixel == 0) && (dstAddress % bytesPerPixel == 0) && (copySize.x % bytesPerPixel == 0) &&
+                               (blitProperties.srcRowPitch % bytesPerPixel == 0) && (blitProperties.dstRowPitch % bytesPerPixel == 0) &&
+                               ((copySize.z == 1) || ((blitProperties.srcSlicePitch % bytesPerPixel == 0) && (blitProperties.dstSlicePitch % bytesPerPixel == 0)));
+                if (!aligned || (copySize.x / bytesPerPixel) > getMaxBlitWidth()) {
+                    continue;
+                }
+                for (uint64_t slice = 0; slice < copySize.z; slice++) {
+                    for (uint64_t row = 0; row < copySize.y;) {
+                        auto height = std::min(static_cast<uint64_t>(copySize.y - row), getMaxBlitHeight());
+                        regionHandler(BlitCopyRegion{calculateBlitCommandSourceBaseAddress(blitProperties, 0, row, slice),
+                                                     calculateBlitCommandDestinationBaseAddress(blitProperties, 0, row, slice),
+                                                     copySize.x / bytesPerPixel, height,
+                                                     blitProperties.srcRowPitch, blitProperties.dstRowPitch, bytesPerPixel});
+                        row += height;
+                    }
+                }
+                return;
             }
         }
     }
+
+    for (uint64_t slice = 0; slice < copySize.z; slice++) {
+        for (uint64_t row = 0; row < copySize.y; row++) {
+            auto srcAddress = calculateBlitCommandSourceBaseAddress(blitProperties, 0, row, slice);
+            auto dstAddress = calculateBlitCommandDestinationBaseAddress(blitProperties, 0, row, slice);
+            uint32_t bytesPerPixel = optimizedPlan ? selectBytesPerPixelForLinearCopy(srcAddress, dstAddress, copySize.x) : 1u;
+            planLinearBlitCopy(srcAddress, dstAddress, copySize.x, bytesPerPixel, regionHandler);
+        }
+    }
 }
+
+template <typename GfxFamily>
+void BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsForBuffer(const BlitProperties &blitProperties, LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment) {
+    planBlitCommandsForBuffer(blitProperties, [&](const BlitCopyRegion &copyRegion) {
+        auto bltCmd = GfxFamily::cmdInitXyCopyBlt;
+
+        bltCmd.setTransferWidth(static_cast<uint32_t>(copyRegion.width));
+        bltCmd.setTransferHeight(static_cast<uint32_t>(copyRegion.height));
+        bltCmd.setDestinationPitch(static_cast<uint32_t>(copyRegion.dstPitch));
+        bltCmd.setSourcePitch(static_cast<uint32_t>(copyRegion.srcPitch));
+
+        bltCmd.setDestinationBaseAddress(copyRegion.dstAddress);
+        bltCmd.setSourceBaseAddress(copyRegion.srcAddress);
+
+        appendColorDepthForBytesPerPixel(copyRegion.bytesPerPixel, bltCmd);
+        appendBlitCommandsForBuffer(blitProperties, bltCmd, rootDeviceEnvironment);
+
+        auto bltStream = linearStream.getSpaceForCmd<typename GfxFamily::XY_COPY_BLT>();
+        *bltStream = bltCmd;
+
+        dispatchPostBlitCommand(linearStream);
+    });
+}
+
 template <typename GfxFamily>
 template <size_t patternSize>
 void BlitCommandsHelper<GfxFamily>::dispatchBlitMemoryFill(NEO::GraphicsAllocation *dstAlloc, uint32_t *pattern, LinearStream &linearStream, size_t size, const RootDeviceEnvironment &rootDeviceEnvironment, COLOR_DEPTH depth) {
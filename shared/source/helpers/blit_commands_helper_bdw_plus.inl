@@ -55,6 +55,21 @@ template <typename GfxFamily>
 void BlitCommandsHelper<GfxFamily>::appendColorDepth(const BlitProperties &blitProperites, typename GfxFamily::XY_COPY_BLT &blitCmd) {
 }
 
+template <typename GfxFamily>
+void BlitCommandsHelper<GfxFamily>::appendColorDepthForBytesPerPixel(size_t bytesPerPixel, typename GfxFamily::XY_COPY_BLT &blitCmd) {
+    UNRECOVERABLE_IF(bytesPerPixel != 1);
+}
+
+template <typename GfxFamily>
+uint64_t BlitCommandsHelper<GfxFamily>::getMaxBlitPitch() {
+    return getMaxBlitWidth();
+}
+
+template <typename GfxFamily>
+uint32_t BlitCommandsHelper<GfxFamily>::getMaxBytesPerPixelForBufferCopy() {
+    return 1;
+}
+
 template <typename GfxFamily>
 void BlitCommandsHelper<GfxFamily>::appendSliceOffsets(const BlitProperties &blitProperties, typename GfxFamily::XY_COPY_BLT &blitCmd, uint32_t sliceIndex) {
 }
@@ -16,6 +16,7 @@
 
 #include "pipe_control_args.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <vector>
@@ -120,6 +121,30 @@ struct TimestampPacketHelper {
 
     static void overrideSupportedDevicesCount(uint32_t &numSupportedDevices);
 
+    static bool isDependencyPruningEnabled() {
+        return DebugManager.flags.EnableTimestampPacketDependencyPruning.get() == 1;
+    }
+
+    // Visits nodes of dependencies that need a wait. With pruning enabled nodes already completed and nodes visited
+    // for another container are skipped; completion only progresses, so estimated size never underestimates programmed one.
+    template <typename NodeVisitor>
+    static void forEachRequiredNode(const CsrDependencies &csrDependencies, NodeVisitor visitor) {
+        auto pruneDependencies = isDependencyPruningEnabled();
+        StackVec<const TagNode<TimestampPacketStorage> *, 32> visitedNodes;
+        for (auto timestampPacketContainer : csrDependencies) {
+            for (auto &node : timestampPacketContainer->peekNodes()) {
+                if (pruneDependencies) {
+                    if (node->tagForCpuAccess->isCompleted() ||
+                        std::find(visitedNodes.begin(), visitedNodes.end(), node) != visitedNodes.end()) {
+                        continue;
+                    }
+                    visitedNodes.push_back(node);
+                }
+                visitor(*node);
+            }
+        }
+    }
+
     template <typename GfxFamily>
     static void programSemaphoreWithImplicitDependency(LinearStream &cmdStream, TagNode<TimestampPacketStorage> &timestampPacketNode, uint32_t numSupportedDevices) {
         using MI_ATOMIC = typename GfxFamily::MI_ATOMIC;
@@ -155,11 +180,9 @@ struct TimestampPacketHelper {
 
     template <typename GfxFamily>
     static void programCsrDependencies(LinearStream &cmdStream, const CsrDependencies &csrDependencies, uint32_t numSupportedDevices) {
-        for (auto timestampPacketContainer : csrDependencies) {
-            for (auto &node : timestampPacketContainer->peekNodes()) {
-                TimestampPacketHelper::programSemaphoreWithImplicitDependency<GfxFamily>(cmdStream, *node, numSupportedDevices);
-            }
-        }
+        forEachRequiredNode(csrDependencies, [&](TagNode<TimestampPacketStorage> &node) {
+            TimestampPacketHelper::programSemaphoreWithImplicitDependency<GfxFamily>(cmdStream, node, numSupportedDevices);
+        });
     }
 
     template <typename GfxFamily, AuxTranslationDirection auxTranslationDirection>
@@ -212,11 +235,9 @@ struct TimestampPacketHelper {
     template <typename GfxFamily>
     static size_t getRequiredCmdStreamSize(const CsrDependencies &csrDependencies) {
         size_t totalCommandsSize = 0;
-        for (auto timestampPacketContainer : csrDependencies) {
-            for (auto &node : timestampPacketContainer->peekNodes()) {
-                totalCommandsSize += getRequiredCmdStreamSizeForNodeDependency<GfxFamily>(*node);
-            }
-        }
+        forEachRequiredNode(csrDependencies, [&](TagNode<TimestampPacketStorage> &node) {
+            totalCommandsSize += getRequiredCmdStreamSizeForNodeDependency<GfxFamily>(node);
+        });
 
         return totalCommandsSize;
     }
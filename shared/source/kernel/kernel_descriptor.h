@@ -11,6 +11,7 @@
 #include "shared/source/kernel/debug_data.h"
 #include "shared/source/kernel/kernel_arg_descriptor.h"
 #include "shared/source/kernel/kernel_arg_metadata.h"
+#include "shared/source/program/printf_format_program.h"
 #include "shared/source/utilities/arrayref.h"
 #include "shared/source/utilities/stackvec.h"
 
@@ -150,6 +151,7 @@ struct KernelDescriptor final {
         std::string kernelName;
         std::string kernelLanguageAttributes;
         StringMap printfStringsMap;
+        PrintfFormatProgramMap printfFormatPrograms;
         std::vector<std::pair<uint32_t, uint32_t>> deviceSideEnqueueChildrenKernelsIdOffset;
         uint32_t deviceSideEnqueueBlockInterfaceDescriptorOffset = 0U;
 
@@ -11,6 +11,7 @@
 #include "shared/source/kernel/kernel_arg_descriptor_extended_device_side_enqueue.h"
 #include "shared/source/kernel/kernel_arg_descriptor_extended_vme.h"
 #include "shared/source/kernel/kernel_descriptor.h"
+#include "shared/source/program/print_formatter.h"
 
 #include <sstream>
 #include <string>
@@ -177,7 +178,9 @@ void populateKernelDescriptor(KernelDescriptor &dst, const SPatchAllocateSyncBuf
 void populateKernelDescriptor(KernelDescriptor &dst, const SPatchString &token) {
     uint32_t stringIndex = token.Index;
     const char *stringData = reinterpret_cast<const char *>(&token + 1);
-    dst.kernelMetadata.printfStringsMap[stringIndex].assign(stringData, stringData + token.StringSize);
+    auto &printfString = dst.kernelMetadata.printfStringsMap[stringIndex];
+    printfString.assign(stringData, stringData + token.StringSize);
+    dst.kernelMetadata.printfFormatPrograms[stringIndex] = PrintFormatter::compileFormatString(printfString.c_str());
 }
 
 template <typename TokenT, typename... ArgsT>
@@ -9,9 +9,56 @@
 
 #include "shared/source/memory_manager/memory_manager.h"
 
+#include <algorithm>
+
 using namespace NEO;
 
-HostPtrFragmentsContainer::iterator HostPtrManager::findElement(const void *ptr) {
+constexpr size_t HostPtrManager::stripeCount;
+constexpr uint32_t HostPtrManager::regionSizeShift;
+
+HostPtrManager::StripesLock::StripesLock(HostPtrManager &hostPtrManager, const void *ptr, size_t size) : hostPtrManager(hostPtrManager) {
+    if (isSpanningRegions(ptr, size)) {
+        for (auto &stripe : hostPtrManager.stripes) {
+            stripe.mtx.lock();
+        }
+        allStripes = true;
+    } else {
+        stripeIndex = getRegion(ptr) % stripeCount;
+        hostPtrManager.stripes[stripeIndex].mtx.lock();
+    }
+}
+
+HostPtrManager::StripesLock::~StripesLock() {
+    unlock();
+}
+
+// Stripe locked so far is released first, so fragments looked up before have to be looked up again.
+void HostPtrManager::StripesLock::lockAllStripes() {
+    if (allStripes) {
+        return;
+    }
+    hostPtrManager.stripes[stripeIndex].mtx.unlock();
+    for (auto &stripe : hostPtrManager.stripes) {
+        stripe.mtx.lock();
+    }
+    allStripes = true;
+}
+
+void HostPtrManager::StripesLock::unlock() {
+    if (allStripes) {
+        for (auto stripe = hostPtrManager.stripes.rbegin(); stripe != hostPtrManager.stripes.rend(); stripe++) {
+            stripe->mtx.unlock();
+        }
+    } else {
+        hostPtrManager.stripes[stripeIndex].mtx.unlock();
+    }
+}
+
+uintptr_t HostPtrManager::getLastRegion(const void *ptr, size_t size) {
+    return getRegion(ptrOffset(ptr, size > 0 ? size - 1 : 0));
+}
+
+HostPtrFragmentsContainer::iterator HostPtrManager::findElement(HostPtrFragmentsContainer &partialAllocations, const void *ptr) {
     auto nextElement = partialAllocations.lower_bound(ptr);
     auto element = nextElement;
     if (element != partialAllocations.end()) {
@@ -43,6 +90,19 @@ HostPtrFragmentsContainer::iterator HostPtrManager::findElement(const void *ptr)
     return partialAllocations.end();
 }
 
+HostPtrFragmentsContainer *HostPtrManager::findElement(const void *ptr, HostPtrFragmentsContainer::iterator &element) {
+    auto &fragments = getStripe(ptr).fragments;
+    element = findElement(fragments, ptr);
+    if (element != fragments.end()) {
+        return &fragments;
+    }
+    element = findElement(spanningFragments, ptr);
+    if (element != spanningFragments.end()) {
+        return &spanningFragments;
+    }
+    return nullptr;
+}
+
 AllocationRequirements HostPtrManager::getAllocationRequirements(const void *inputPtr, size_t size) {
     AllocationRequirements requiredAllocations;
 
@@ -123,13 +183,19 @@ OsHandleStorage HostPtrManager::populateAlreadyAllocatedFragments(AllocationRequ
 }
 
 void HostPtrManager::storeFragment(FragmentStorage &fragment) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
-    auto element = findElement(fragment.fragmentCpuPointer);
-    if (element != partialAllocations.end()) {
+    StripesLock lock(*this, fragment.fragmentCpuPointer, fragment.fragmentSize);
+    HostPtrFragmentsContainer::iterator element;
+    auto fragments = findElement(fragment.fragmentCpuPointer, element);
+    if (fragments == &spanningFragments && !lock.ownsAllStripes()) {
+        lock.lockAllStripes();
+        fragments = findElement(fragment.fragmentCpuPointer, element);
+    }
+    if (fragments != nullptr) {
         element->second.refCount++;
     } else {
         fragment.refCount++;
-        partialAllocations.insert(std::pair<const void *, FragmentStorage>(fragment.fragmentCpuPointer, fragment));
+        auto &container = isSpanningRegions(fragment.fragmentCpuPointer, fragment.fragmentSize) ? spanningFragments : getStripe(fragment.fragmentCpuPointer).fragments;
+        container.insert(std::pair<const void *, FragmentStorage>(fragment.fragmentCpuPointer, fragment));
     }
 }
 
@@ -142,10 +208,6 @@ void HostPtrManager::storeFragment(AllocationStorageData &storageData) {
     storeFragment(fragment);
 }
 
-std::unique_lock<std::recursive_mutex> HostPtrManager::obtainOwnership() {
-    return std::unique_lock<std::recursive_mutex>(allocationsMutex);
-}
-
 void HostPtrManager::releaseHandleStorage(OsHandleStorage &fragments) {
     for (int i = 0; i < maxFragmentsCount; i++) {
         if (fragments.fragmentStorageData[i].fragmentSize || fragments.fragmentStorageData[i].cpuPtr) {
@@ -155,26 +217,34 @@ void HostPtrManager::releaseHandleStorage(OsHandleStorage &fragments) {
 }
 
 bool HostPtrManager::releaseHostPtr(const void *ptr) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
+    StripesLock lock(*this, ptr, 0u);
     bool fragmentReadyToBeReleased = false;
 
-    auto element = findElement(ptr);
+    HostPtrFragmentsContainer::iterator element;
+    auto fragments = findElement(ptr, element);
+    if (fragments == &spanningFragments) {
+        lock.lockAllStripes();
+        fragments = findElement(ptr, element);
+    }
 
-    DEBUG_BREAK_IF(element == partialAllocations.end());
+    DEBUG_BREAK_IF(fragments == nullptr);
+    if (fragments == nullptr) {
+        return false;
+    }
 
     element->second.refCount--;
     if (element->second.refCount <= 0) {
         fragmentReadyToBeReleased = true;
-        partialAllocations.erase(element);
+        fragments->erase(element);
     }
 
     return fragmentReadyToBeReleased;
 }
 
 FragmentStorage *HostPtrManager::getFragment(const void *inputPtr) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
-    auto element = findElement(inputPtr);
-    if (element != partialAllocations.end()) {
+    StripesLock lock(*this, inputPtr, 0u);
+    HostPtrFragmentsContainer::iterator element;
+    if (findElement(inputPtr, element) != nullptr) {
         return &element->second;
     }
     return nullptr;
@@ -182,7 +252,30 @@ FragmentStorage *HostPtrManager::getFragment(const void *inputPtr) {
 
 //for given inputs see if any allocation overlaps
 FragmentStorage *HostPtrManager::getFragmentAndCheckForOverlaps(const void *inPtr, size_t size, OverlapStatus &overlappingStatus) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
+    StripesLock lock(*this, inPtr, size);
+    auto fragment = checkForOverlaps(spanningFragments, inPtr, size, overlappingStatus);
+
+    auto firstRegion = getRegion(inPtr);
+    auto regionCount = std::min(static_cast<size_t>(getLastRegion(inPtr, size) - firstRegion + 1), stripeCount);
+    for (size_t region = 0; region < regionCount; region++) {
+        OverlapStatus stripeOverlappingStatus = OverlapStatus::FRAGMENT_NOT_CHECKED;
+        auto stripeFragment = checkForOverlaps(stripes[(firstRegion + region) % stripeCount].fragments, inPtr, size, stripeOverlappingStatus);
+        if (stripeOverlappingStatus == OverlapStatus::FRAGMENT_NOT_OVERLAPING_WITH_ANY_OTHER) {
+            continue;
+        }
+        if (overlappingStatus == OverlapStatus::FRAGMENT_NOT_OVERLAPING_WITH_ANY_OTHER && regionCount == 1) {
+            overlappingStatus = stripeOverlappingStatus;
+            fragment = stripeFragment;
+        } else {
+            // stripe fragments are within one region, so input crossing regions can't be within any of them
+            overlappingStatus = OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT;
+            return nullptr;
+        }
+    }
+    return fragment;
+}
+
+FragmentStorage *HostPtrManager::checkForOverlaps(HostPtrFragmentsContainer &partialAllocations, const void *inPtr, size_t size, OverlapStatus &overlappingStatus) {
     void *inputPtr = const_cast<void *>(inPtr);
     auto nextElement = partialAllocations.lower_bound(inputPtr);
     auto element = nextElement;
@@ -240,18 +333,49 @@ FragmentStorage *HostPtrManager::getFragmentAndCheckForOverlaps(const void *inPt
     return nullptr;
 }
 
+bool HostPtrManager::overlapsSpanningFragment(AllocationRequirements &requirements) {
+    for (unsigned int i = 0; i < requirements.requiredFragmentsCount; i++) {
+        OverlapStatus overlapStatus = OverlapStatus::FRAGMENT_NOT_CHECKED;
+        checkForOverlaps(spanningFragments, requirements.allocationFragments[i].allocationPtr, requirements.allocationFragments[i].allocationSize, overlapStatus);
+        if (overlapStatus != OverlapStatus::FRAGMENT_NOT_OVERLAPING_WITH_ANY_OTHER) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Overlaps are resolved by cleaning temporary allocations without holding any stripe, as that may wait for other
+// threads releasing their host pointers. Once stripes are locked the requirements are checked again and the whole
+// sequence is retried if a bigger overlapping fragment was stored in the meantime.
 OsHandleStorage HostPtrManager::prepareOsStorageForAllocation(MemoryManager &memoryManager, size_t size, const void *ptr, uint32_t rootDeviceIndex) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
     auto requirements = HostPtrManager::getAllocationRequirements(ptr, size);
-    UNRECOVERABLE_IF(checkAllocationsForOverlapping(memoryManager, &requirements) == RequirementsStatus::FATAL);
-    auto osStorage = populateAlreadyAllocatedFragments(requirements);
-    if (osStorage.fragmentCount > 0) {
-        if (memoryManager.populateOsHandles(osStorage, rootDeviceIndex) != MemoryManager::AllocationStatus::Success) {
-            memoryManager.cleanOsHandles(osStorage, rootDeviceIndex);
-            osStorage.fragmentCount = 0;
+    while (true) {
+        UNRECOVERABLE_IF(checkAllocationsForOverlapping(memoryManager, &requirements) == RequirementsStatus::FATAL);
+
+        StripesLock lock(*this, alignDown(ptr, MemoryConstants::pageSize), requirements.totalRequiredSize);
+        if (!lock.ownsAllStripes() && overlapsSpanningFragment(requirements)) {
+            lock.lockAllStripes();
+        }
+
+        bool overlapsBiggerFragment = false;
+        for (unsigned int i = 0; i < requirements.requiredFragmentsCount; i++) {
+            OverlapStatus overlapStatus = OverlapStatus::FRAGMENT_NOT_CHECKED;
+            getFragmentAndCheckForOverlaps(requirements.allocationFragments[i].allocationPtr, requirements.allocationFragments[i].allocationSize, overlapStatus);
+            overlapsBiggerFragment |= (overlapStatus == OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT);
+        }
+        if (overlapsBiggerFragment) {
+            continue;
+        }
+
+        auto osStorage = populateAlreadyAllocatedFragments(requirements);
+        if (osStorage.fragmentCount > 0) {
+            if (memoryManager.populateOsHandles(osStorage, rootDeviceIndex) != MemoryManager::AllocationStatus::Success) {
+                memoryManager.cleanOsHandles(osStorage, rootDeviceIndex);
+                osStorage.fragmentCount = 0;
+            }
         }
+        return osStorage;
     }
-    return osStorage;
 }
 
 RequirementsStatus HostPtrManager::checkAllocationsForOverlapping(MemoryManager &memoryManager, AllocationRequirements *requirements) {
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/memory_manager/host_ptr_defines.h"
 
+#include <array>
 #include <map>
 #include <mutex>
 
@@ -15,24 +16,63 @@ namespace NEO {
 
 using HostPtrFragmentsContainer = std::map<const void *, FragmentStorage>;
 class MemoryManager;
+
+// Fragments are tracked per address region: a fragment within one region is stored in the stripe the region maps to,
+// a fragment crossing region boundary is stored in spanningFragments. Every stripe has its own lock, spanning fragments
+// are read under any stripe lock and modified only with all stripes locked.
 class HostPtrManager {
   public:
+    static constexpr size_t stripeCount = 16u;
+    static constexpr uint32_t regionSizeShift = 21u;
+
     FragmentStorage *getFragment(const void *inputPtr);
     OsHandleStorage prepareOsStorageForAllocation(MemoryManager &memoryManager, size_t size, const void *ptr, uint32_t rootDeviceIndex);
     void releaseHandleStorage(OsHandleStorage &fragments);
     bool releaseHostPtr(const void *ptr);
     void storeFragment(AllocationStorageData &storageData);
     void storeFragment(FragmentStorage &fragment);
-    std::unique_lock<std::recursive_mutex> obtainOwnership();
 
   protected:
+    struct Stripe {
+        std::recursive_mutex mtx;
+        HostPtrFragmentsContainer fragments;
+    };
+
+    // Locks stripe of a range within one region, or all stripes in order for a range crossing regions.
+    class StripesLock {
+      public:
+        StripesLock(HostPtrManager &hostPtrManager, const void *ptr, size_t size);
+        ~StripesLock();
+        StripesLock(const StripesLock &) = delete;
+        StripesLock &operator=(const StripesLock &) = delete;
+
+        bool ownsAllStripes() const { return allStripes; }
+        void lockAllStripes();
+
+      protected:
+        void unlock();
+
+        HostPtrManager &hostPtrManager;
+        size_t stripeIndex = 0u;
+        bool allStripes = false;
+    };
+
     static AllocationRequirements getAllocationRequirements(const void *inputPtr, size_t size);
     OsHandleStorage populateAlreadyAllocatedFragments(AllocationRequirements &requirements);
     FragmentStorage *getFragmentAndCheckForOverlaps(const void *inputPtr, size_t size, OverlapStatus &overlappingStatus);
     RequirementsStatus checkAllocationsForOverlapping(MemoryManager &memoryManager, AllocationRequirements *requirements);
+    bool overlapsSpanningFragment(AllocationRequirements &requirements);
+
+    static uintptr_t getRegion(const void *ptr) { return reinterpret_cast<uintptr_t>(ptr) >> regionSizeShift; }
+    static uintptr_t getLastRegion(const void *ptr, size_t size);
+    static bool isSpanningRegions(const void *ptr, size_t size) { return getRegion(ptr) != getLastRegion(ptr, size); }
+    Stripe &getStripe(const void *ptr) { return stripes[getRegion(ptr) % stripeCount]; }
+
+    static HostPtrFragmentsContainer::iterator findElement(HostPtrFragmentsContainer &fragments, const void *ptr);
+    static FragmentStorage *checkForOverlaps(HostPtrFragmentsContainer &fragments, const void *inputPtr, size_t size, OverlapStatus &overlappingStatus);
+    HostPtrFragmentsContainer *findElement(const void *ptr, HostPtrFragmentsContainer::iterator &element);
 
-    HostPtrFragmentsContainer::iterator findElement(const void *ptr);
-    HostPtrFragmentsContainer partialAllocations;
-    std::recursive_mutex allocationsMutex;
+    std::array<Stripe, stripeCount> stripes;
+    HostPtrFragmentsContainer spanningFragments;
 };
 } // namespace NEO
@@ -13,10 +13,20 @@
 
 namespace NEO {
 
+constexpr size_t InternalAllocationStorage::defaultMaxRetainedReusableSize;
+
 InternalAllocationStorage::InternalAllocationStorage(CommandStreamReceiver &commandStreamReceiver)
     : commandStreamReceiver(commandStreamReceiver),
       temporaryAllocations(TEMPORARY_ALLOCATION),
-      allocationsForReuse(REUSABLE_ALLOCATION){};
+      allocationsForReuse(REUSABLE_ALLOCATION) {
+    if (DebugManager.flags.EnableReusableAllocationsIndex.get() == 1) {
+        size_t maxRetainedSize = defaultMaxRetainedReusableSize;
+        if (DebugManager.flags.ReusableAllocationsMaxRetainedSize.get() != -1) {
+            maxRetainedSize = static_cast<size_t>(DebugManager.flags.ReusableAllocationsMaxRetainedSize.get());
+        }
+        reusableAllocationsIndex = std::make_unique<ReusableAllocationsIndex>(maxRetainedSize);
+    }
+}
 
 void InternalAllocationStorage::storeAllocation(std::unique_ptr<GraphicsAllocation> gfxAllocation, uint32_t allocationUsage) {
     uint32_t taskCount = gfxAllocation->getTaskCount(commandStreamReceiver.getOsContext().getContextId());
@@ -36,16 +46,50 @@ void InternalAllocationStorage::storeAllocationWithTaskCount(std::unique_ptr<Gra
     }
     auto &allocationsList = (allocationUsage == TEMPORARY_ALLOCATION) ? temporaryAllocations : allocationsForReuse;
     gfxAllocation->updateTaskCount(taskCount, commandStreamReceiver.getOsContext().getContextId());
+    if (allocationUsage == REUSABLE_ALLOCATION && reusableAllocationsIndex) {
+        reusableAllocationsIndex->store(gfxAllocation.release(), taskCount);
+        trimReusableAllocations();
+        return;
+    }
     allocationsList.pushTailOne(*gfxAllocation.release());
 }
 
 void InternalAllocationStorage::cleanAllocationList(uint32_t waitTaskCount, uint32_t allocationUsage) {
+    if (allocationUsage == REUSABLE_ALLOCATION && reusableAllocationsIndex) {
+        std::vector<GraphicsAllocation *> completedAllocations;
+        reusableAllocationsIndex->detachCompleted(waitTaskCount, completedAllocations);
+        freeAllocations(completedAllocations);
+        // reusable allocations are never listed while the index is in use
+        return;
+    }
     freeAllocationsList(waitTaskCount, (allocationUsage == TEMPORARY_ALLOCATION) ? temporaryAllocations : allocationsForReuse);
 }
 
+void InternalAllocationStorage::trimReusableAllocations() {
+    if (reusableAllocationsIndex->getRetainedSize() <= reusableAllocationsIndex->getMaxRetainedSize()) {
+        return;
+    }
+    std::vector<GraphicsAllocation *> trimmed;
+    reusableAllocationsIndex->detachOverLimit(*commandStreamReceiver.getTagAddress(), trimmed);
+    for (auto allocation : trimmed) {
+        trimmedBytes += allocation->getUnderlyingBufferSize();
+    }
+    trimmedAllocations += trimmed.size();
+    freeAllocations(trimmed);
+}
+
+void InternalAllocationStorage::freeAllocations(const std::vector<GraphicsAllocation *> &allocations) {
+    if (allocations.empty()) {
+        return;
+    }
+    auto memoryManager = commandStreamReceiver.getMemoryManager();
+    for (auto allocation : allocations) {
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+}
+
 void InternalAllocationStorage::freeAllocationsList(uint32_t waitTaskCount, AllocationsList &allocationsList) {
     auto memoryManager = commandStreamReceiver.getMemoryManager();
-    auto lock = memoryManager->getHostPtrManager()->obtainOwnership();
 
     GraphicsAllocation *curr = allocationsList.detachNodes();
 
@@ -66,10 +110,29 @@ void InternalAllocationStorage::freeAllocationsList(uint32_t waitTaskCount, Allo
 }
 
 std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainReusableAllocation(size_t requiredSize, GraphicsAllocation::AllocationType allocationType) {
-    auto allocation = allocationsForReuse.detachAllocation(requiredSize, nullptr, commandStreamReceiver, allocationType);
+    std::unique_ptr<GraphicsAllocation> allocation;
+    if (reusableAllocationsIndex) {
+        allocation.reset(reusableAllocationsIndex->obtain(requiredSize, allocationType, *commandStreamReceiver.getTagAddress()));
+    } else {
+        allocation = allocationsForReuse.detachAllocation(requiredSize, nullptr, commandStreamReceiver, allocationType);
+    }
+    if (allocation) {
+        reuseHits++;
+    } else {
+        reuseMisses++;
+    }
     return allocation;
 }
 
+AllocationReuseCounters InternalAllocationStorage::getReuseCounters() const {
+    AllocationReuseCounters counters;
+    counters.hits = reuseHits.load();
+    counters.misses = reuseMisses.load();
+    counters.trimmedAllocations = trimmedAllocations.load();
+    counters.trimmedBytes = trimmedBytes.load();
+    return counters;
+}
+
 std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainTemporaryAllocationWithPtr(size_t requiredSize, const void *requiredPtr, GraphicsAllocation::AllocationType allocationType) {
     auto allocation = temporaryAllocations.detachAllocation(requiredSize, requiredPtr, commandStreamReceiver, allocationType);
     return allocation;
@@ -6,11 +6,22 @@
  */
 
 #pragma once
+#include "shared/source/helpers/constants.h"
 #include "shared/source/memory_manager/allocations_list.h"
+#include "shared/source/memory_manager/reusable_allocations_index.h"
+
+#include <atomic>
 
 namespace NEO {
 class CommandStreamReceiver;
 
+struct AllocationReuseCounters {
+    uint64_t hits = 0u;
+    uint64_t misses = 0u;
+    uint64_t trimmedAllocations = 0u;
+    uint64_t trimmedBytes = 0u;
+};
+
 class InternalAllocationStorage {
   public:
     MOCKABLE_VIRTUAL ~InternalAllocationStorage() = default;
@@ -22,12 +33,24 @@ class InternalAllocationStorage {
     std::unique_ptr<GraphicsAllocation> obtainTemporaryAllocationWithPtr(size_t requiredSize, const void *requiredPtr, GraphicsAllocation::AllocationType allocationType);
     AllocationsList &getTemporaryAllocations() { return temporaryAllocations; }
     AllocationsList &getAllocationsForReuse() { return allocationsForReuse; }
+    ReusableAllocationsIndex *getReusableAllocationsIndex() { return reusableAllocationsIndex.get(); }
+    AllocationReuseCounters getReuseCounters() const;
+
+    static constexpr size_t defaultMaxRetainedReusableSize = 256 * MemoryConstants::megaByte;
 
   protected:
     void freeAllocationsList(uint32_t waitTaskCount, AllocationsList &allocationsList);
+    void freeAllocations(const std::vector<GraphicsAllocation *> &allocations);
+    void trimReusableAllocations();
     CommandStreamReceiver &commandStreamReceiver;
 
     AllocationsList temporaryAllocations;
     AllocationsList allocationsForReuse;
+    std::unique_ptr<ReusableAllocationsIndex> reusableAllocationsIndex;
+
+    std::atomic<uint64_t> reuseHits{0u};
+    std::atomic<uint64_t> reuseMisses{0u};
+    std::atomic<uint64_t> trimmedAllocations{0u};
+    std::atomic<uint64_t> trimmedBytes{0u};
 };
 } // namespace NEO
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/reusable_allocations_index.h"
+
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace NEO {
+
+ReusableAllocationsIndex::ReusableAllocationsIndex(size_t maxRetainedSize)
+    : maxRetainedSize(maxRetainedSize) {}
+
+ReusableAllocationsIndex::~ReusableAllocationsIndex() {
+    DEBUG_BREAK_IF(allocationsCount != 0u);
+}
+
+uint32_t ReusableAllocationsIndex::getSizeClass(size_t size) {
+    return (size == 0u) ? 0u : Math::log2(static_cast<uint64_t>(size));
+}
+
+void ReusableAllocationsIndex::store(GraphicsAllocation *allocation, uint32_t taskCount) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto &bucket = buckets[{allocation->getAllocationType(), getSizeClass(allocation->getUnderlyingBufferSize())}];
+
+    // allocations are almost always stored with increasing task counts, so search from the back
+    auto position = bucket.end();
+    while ((position != bucket.begin()) && (std::prev(position)->taskCount > taskCount)) {
+        --position;
+    }
+    bucket.insert(position, Entry{allocation, taskCount});
+
+    retainedSize += allocation->getUnderlyingBufferSize();
+    allocationsCount++;
+}
+
+GraphicsAllocation *ReusableAllocationsIndex::obtain(size_t requiredMinimalSize, GraphicsAllocation::AllocationType allocationType, uint32_t completedTaskCount) {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto bucketIt = buckets.lower_bound({allocationType, getSizeClass(requiredMinimalSize)});
+         (bucketIt != buckets.end()) && (bucketIt->first.first == allocationType); ++bucketIt) {
+        auto &bucket = bucketIt->second;
+        for (auto entryIt = bucket.begin(); (entryIt != bucket.end()) && (entryIt->taskCount <= completedTaskCount); ++entryIt) {
+            // only the lowest size class may hold allocations smaller than requested
+            if (entryIt->allocation->getUnderlyingBufferSize() >= requiredMinimalSize) {
+                auto allocation = entryIt->allocation;
+                detachEntry(bucketIt, entryIt, nullptr);
+                if (bucket.empty()) {
+                    buckets.erase(bucketIt);
+                }
+                return allocation;
+            }
+        }
+    }
+    return nullptr;
+}
+
+void ReusableAllocationsIndex::detachCompleted(uint32_t waitTaskCount, std::vector<GraphicsAllocation *> &detached) {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (auto bucketIt = buckets.begin(); bucketIt != buckets.end();) {
+        auto &bucket = bucketIt->second;
+        while (!bucket.empty() && (bucket.front().taskCount <= waitTaskCount)) {
+            detached.push_back(bucket.front().allocation);
+            retainedSize -= bucket.front().allocation->getUnderlyingBufferSize();
+            allocationsCount--;
+            bucket.pop_front();
+        }
+        bucketIt = bucket.empty() ? buckets.erase(bucketIt) : std::next(bucketIt);
+    }
+}
+
+void ReusableAllocationsIndex::detachOverLimit(uint32_t completedTaskCount, std::vector<GraphicsAllocation *> &detached) {
+    std::lock_guard<std::mutex> lock(mtx);
+    // trim the largest size classes first to get under the limit with the fewest releases,
+    // buckets are ordered by allocation type first, so they are sorted by size class here
+    std::vector<std::map<BucketKey, Bucket>::iterator> bucketsBySizeClass;
+    bucketsBySizeClass.reserve(buckets.size());
+    for (auto bucketIt = buckets.begin(); bucketIt != buckets.end(); ++bucketIt) {
+        bucketsBySizeClass.push_back(bucketIt);
+    }
+    std::stable_sort(bucketsBySizeClass.begin(), bucketsBySizeClass.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs->first.second > rhs->first.second;
+    });
+
+    for (auto bucketIt : bucketsBySizeClass) {
+        if (retainedSize <= maxRetainedSize) {
+            break;
+        }
+        auto &bucket = bucketIt->second;
+        while ((retainedSize > maxRetainedSize) && !bucket.empty() && (bucket.front().taskCount <= completedTaskCount)) {
+            detachEntry(bucketIt, bucket.begin(), &detached);
+        }
+        if (bucket.empty()) {
+            buckets.erase(bucketIt);
+        }
+    }
+}
+
+size_t ReusableAllocationsIndex::getRetainedSize() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return retainedSize;
+}
+
+size_t ReusableAllocationsIndex::getAllocationsCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return allocationsCount;
+}
+
+void ReusableAllocationsIndex::detachEntry(std::map<BucketKey, Bucket>::iterator bucketIt, Bucket::iterator entryIt, std::vector<GraphicsAllocation *> *detached) {
+    auto allocation = entryIt->allocation;
+    if (detached) {
+        detached->push_back(allocation);
+    }
+    retainedSize -= allocation->getUnderlyingBufferSize();
+    allocationsCount--;
+    bucketIt->second.erase(entryIt);
+}
+
+} // namespace NEO
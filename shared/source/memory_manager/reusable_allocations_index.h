@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+
+#include <deque>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+
+// Reusable allocations bucketed by (allocation type, power-of-two size class).
+// Entries within a bucket are kept in task count order, so lookups stop at the first
+// allocation that is still in use instead of walking every stored allocation.
+class ReusableAllocationsIndex : NonCopyableOrMovableClass {
+  public:
+    ReusableAllocationsIndex(size_t maxRetainedSize);
+    ~ReusableAllocationsIndex();
+
+    void store(GraphicsAllocation *allocation, uint32_t taskCount);
+    GraphicsAllocation *obtain(size_t requiredMinimalSize, GraphicsAllocation::AllocationType allocationType, uint32_t completedTaskCount);
+
+    void detachCompleted(uint32_t waitTaskCount, std::vector<GraphicsAllocation *> &detached);
+    void detachOverLimit(uint32_t completedTaskCount, std::vector<GraphicsAllocation *> &detached);
+
+    size_t getRetainedSize();
+    size_t getAllocationsCount();
+    size_t getMaxRetainedSize() const { return maxRetainedSize; }
+
+    static uint32_t getSizeClass(size_t size);
+
+  protected:
+    struct Entry {
+        GraphicsAllocation *allocation;
+        uint32_t taskCount;
+    };
+    using BucketKey = std::pair<GraphicsAllocation::AllocationType, uint32_t>;
+    using Bucket = std::deque<Entry>;
+
+    void detachEntry(std::map<BucketKey, Bucket>::iterator bucketIt, Bucket::iterator entryIt, std::vector<GraphicsAllocation *> *detached);
+
+    const size_t maxRetainedSize;
+    size_t retainedSize = 0u;
+    size_t allocationsCount = 0u;
+    std::map<BucketKey, Bucket> buckets;
+    std::mutex mtx;
+};
+} // namespace NEO
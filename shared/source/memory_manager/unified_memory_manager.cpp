@@ -10,18 +10,26 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/unified_memory_pool.h"
+#include "shared/source/os_interface/os_context.h"
 
 #include "opencl/source/mem_obj/mem_obj_helper.h"
 
+#include <algorithm>
+
 namespace NEO {
 
+uint64_t SvmAllocationData::getGpuAddress() const {
+    return gpuAllocation->getGpuAddress() + poolOffset;
+}
+
 void SVMAllocsManager::MapBasedAllocationTracker::insert(SvmAllocationData allocationsPair) {
-    allocations.insert(std::make_pair(reinterpret_cast<void *>(allocationsPair.gpuAllocation->getGpuAddress()), allocationsPair));
+    allocations.insert(std::make_pair(reinterpret_cast<void *>(allocationsPair.getGpuAddress()), allocationsPair));
 }
 
 void SVMAllocsManager::MapBasedAllocationTracker::remove(SvmAllocationData allocationsPair) {
     SvmAllocationContainer::iterator iter;
-    iter = allocations.find(reinterpret_cast<void *>(allocationsPair.gpuAllocation->getGpuAddress()));
+    iter = allocations.find(reinterpret_cast<void *>(allocationsPair.getGpuAddress()));
     allocations.erase(iter);
 }
 
@@ -43,7 +51,7 @@ SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *
     }
     if (Iter != End) {
         svmAllocData = &Iter->second;
-        char *charPtr = reinterpret_cast<char *>(svmAllocData->gpuAllocation->getGpuAddress());
+        char *charPtr = reinterpret_cast<char *>(svmAllocData->getGpuAddress());
         if (ptr < (charPtr + svmAllocData->size)) {
             return svmAllocData;
         }
@@ -72,18 +80,23 @@ SvmMapOperation *SVMAllocsManager::MapOperationsTracker::get(const void *regionP
 
 void SVMAllocsManager::addInternalAllocationsToResidencyContainer(ResidencyContainer &residencyContainer, uint32_t requestedTypesMask) {
     std::unique_lock<SpinLock> lock(mtx);
+    GraphicsAllocation *lastAddedAllocation = nullptr;
     for (auto &allocation : this->SVMAllocs.allocations) {
-        if (allocation.second.memoryType & requestedTypesMask) {
+        // pooled allocations are adjacent in the map and share the pool's graphics allocation
+        if ((allocation.second.memoryType & requestedTypesMask) && (allocation.second.gpuAllocation != lastAddedAllocation)) {
             residencyContainer.push_back(allocation.second.gpuAllocation);
+            lastAddedAllocation = allocation.second.gpuAllocation;
         }
     }
 }
 
 void SVMAllocsManager::makeInternalAllocationsResident(CommandStreamReceiver &commandStreamReceiver, uint32_t requestedTypesMask) {
     std::unique_lock<SpinLock> lock(mtx);
+    GraphicsAllocation *lastResidentAllocation = nullptr;
     for (auto &allocation : this->SVMAllocs.allocations) {
-        if (allocation.second.memoryType & requestedTypesMask) {
+        if ((allocation.second.memoryType & requestedTypesMask) && (allocation.second.gpuAllocation != lastResidentAllocation)) {
             commandStreamReceiver.makeResident(*allocation.second.gpuAllocation);
+            lastResidentAllocation = allocation.second.gpuAllocation;
         }
     }
 }
@@ -91,6 +104,13 @@ void SVMAllocsManager::makeInternalAllocationsResident(CommandStreamReceiver &co
 SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager) : memoryManager(memoryManager) {
 }
 
+SVMAllocsManager::~SVMAllocsManager() {
+    for (auto &pool : unifiedMemoryPools) {
+        memoryManager->freeGraphicsMemory(pool->getAllocation());
+    }
+    unifiedMemoryPools.clear();
+}
+
 void *SVMAllocsManager::createSVMAlloc(uint32_t rootDeviceIndex, size_t size, const SvmAllocationProperties svmProperties, const DeviceBitfield &deviceBitfield) {
     if (size == 0)
         return nullptr;
@@ -105,18 +125,28 @@ void *SVMAllocsManager::createSVMAlloc(uint32_t rootDeviceIndex, size_t size, co
     }
 }
 
-void *SVMAllocsManager::createUnifiedMemoryAllocation(uint32_t rootDeviceIndex, size_t size, const UnifiedMemoryProperties &memoryProperties) {
-    size_t alignedSize = alignUp<size_t>(size, MemoryConstants::pageSize64k);
-
-    GraphicsAllocation::AllocationType allocationType = GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY;
+static GraphicsAllocation::AllocationType getUnifiedMemoryAllocationType(const SVMAllocsManager::UnifiedMemoryProperties &memoryProperties) {
     if (memoryProperties.memoryType == InternalMemoryType::DEVICE_UNIFIED_MEMORY) {
         if (memoryProperties.allocationFlags.allocFlags.allocWriteCombined) {
-            allocationType = GraphicsAllocation::AllocationType::WRITE_COMBINED;
-        } else {
-            allocationType = GraphicsAllocation::AllocationType::BUFFER;
+            return GraphicsAllocation::AllocationType::WRITE_COMBINED;
+        }
+        return GraphicsAllocation::AllocationType::BUFFER;
+    }
+    return GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY;
+}
+
+void *SVMAllocsManager::createUnifiedMemoryAllocation(uint32_t rootDeviceIndex, size_t size, const UnifiedMemoryProperties &memoryProperties) {
+    if (isUnifiedMemoryPoolingCandidate(size, memoryProperties)) {
+        auto pooledPtr = createPooledUnifiedMemoryAllocation(rootDeviceIndex, size, memoryProperties);
+        if (pooledPtr) {
+            return pooledPtr;
         }
     }
 
+    size_t alignedSize = alignUp<size_t>(size, MemoryConstants::pageSize64k);
+
+    GraphicsAllocation::AllocationType allocationType = getUnifiedMemoryAllocationType(memoryProperties);
+
     AllocationProperties unifiedMemoryProperties{rootDeviceIndex,
                                                  true,
                                                  alignedSize,
@@ -144,6 +174,87 @@ void *SVMAllocsManager::createUnifiedMemoryAllocation(uint32_t rootDeviceIndex,
     return reinterpret_cast<void *>(unifiedMemoryAllocation->getGpuAddress());
 }
 
+bool SVMAllocsManager::isUnifiedMemoryPoolingCandidate(size_t size, const UnifiedMemoryProperties &memoryProperties) const {
+    if (DebugManager.flags.EnableUnifiedMemoryPooling.get() != 1) {
+        return false;
+    }
+    bool supportedType = (memoryProperties.memoryType == InternalMemoryType::DEVICE_UNIFIED_MEMORY) ||
+                         (memoryProperties.memoryType == InternalMemoryType::HOST_UNIFIED_MEMORY);
+    return supportedType &&
+           (size > 0u) &&
+           (size <= UnifiedMemoryPool::maxPooledSize) &&
+           (memoryProperties.alignment <= UnifiedMemoryPool::subAllocationAlignment) &&
+           (memoryProperties.subdeviceBitfield.count() <= 1);
+}
+
+void *SVMAllocsManager::createPooledUnifiedMemoryAllocation(uint32_t rootDeviceIndex, size_t size, const UnifiedMemoryProperties &memoryProperties) {
+    auto allocationType = getUnifiedMemoryAllocationType(memoryProperties);
+
+    std::unique_lock<SpinLock> lock(mtx);
+    uint64_t gpuAddress = 0u;
+    UnifiedMemoryPool *pool = allocateFromUnifiedMemoryPools(rootDeviceIndex, size, memoryProperties, gpuAddress);
+
+    if (pool == nullptr) {
+        // pool allocation is slow, other allocations and frees must not wait for it
+        lock.unlock();
+        AllocationProperties poolProperties{rootDeviceIndex,
+                                            true,
+                                            UnifiedMemoryPool::chunkSize,
+                                            allocationType,
+                                            false,
+                                            false,
+                                            memoryProperties.subdeviceBitfield};
+        GraphicsAllocation *poolAllocation = memoryManager->allocateGraphicsMemoryWithProperties(poolProperties);
+        if (!poolAllocation) {
+            return nullptr;
+        }
+        lock.lock();
+
+        pool = allocateFromUnifiedMemoryPools(rootDeviceIndex, size, memoryProperties, gpuAddress);
+        if (pool) {
+            // other thread made room in the meantime
+            memoryManager->freeGraphicsMemory(poolAllocation);
+        } else {
+            unifiedMemoryPools.push_back(std::make_unique<UnifiedMemoryPool>(poolAllocation, memoryProperties.memoryType, memoryProperties.device, memoryProperties.subdeviceBitfield));
+            pool = unifiedMemoryPools.back().get();
+            gpuAddress = pool->allocate(size);
+            UNRECOVERABLE_IF(gpuAddress == 0u);
+        }
+    }
+
+    SvmAllocationData allocData;
+    allocData.gpuAllocation = pool->getAllocation();
+    allocData.cpuAllocation = nullptr;
+    allocData.size = size;
+    allocData.memoryType = memoryProperties.memoryType;
+    allocData.allocationFlagsProperty = memoryProperties.allocationFlags;
+    allocData.device = memoryProperties.device;
+    allocData.pool = pool;
+    allocData.poolOffset = static_cast<size_t>(gpuAddress - pool->getAllocation()->getGpuAddress());
+    for (auto &engine : memoryManager->getRegisteredEngines()) {
+        auto osContextId = engine.osContext->getContextId();
+        if (pool->getAllocation()->isUsedByOsContext(osContextId)) {
+            allocData.poolTaskCountsAtCreation.push_back({osContextId, pool->getAllocation()->getTaskCount(osContextId)});
+        }
+    }
+
+    this->SVMAllocs.insert(allocData);
+    return reinterpret_cast<void *>(gpuAddress);
+}
+
+UnifiedMemoryPool *SVMAllocsManager::allocateFromUnifiedMemoryPools(uint32_t rootDeviceIndex, size_t size, const UnifiedMemoryProperties &memoryProperties, uint64_t &gpuAddress) {
+    auto allocationType = getUnifiedMemoryAllocationType(memoryProperties);
+    for (auto &pool : unifiedMemoryPools) {
+        if (pool->isCompatible(rootDeviceIndex, memoryProperties.memoryType, allocationType, memoryProperties.device, memoryProperties.subdeviceBitfield)) {
+            gpuAddress = pool->allocate(size);
+            if (gpuAddress != 0u) {
+                return pool.get();
+            }
+        }
+    }
+    return nullptr;
+}
+
 void *SVMAllocsManager::createSharedUnifiedMemoryAllocation(uint32_t rootDeviceIndex, size_t size, const UnifiedMemoryProperties &memoryProperties, void *cmdQ) {
     auto supportDualStorageSharedMemory = memoryManager->isLocalMemorySupported(rootDeviceIndex);
 
@@ -187,7 +298,13 @@ void SVMAllocsManager::removeSVMAlloc(const SvmAllocationData &svmAllocData) {
 bool SVMAllocsManager::freeSVMAlloc(void *ptr, bool blocking) {
     SvmAllocationData *svmData = getSVMAlloc(ptr);
     if (svmData) {
-        if (blocking) {
+        if (blocking && svmData->pool) {
+            EngineTaskCounts pendingTaskCounts;
+            getPendingPooledAllocationTaskCounts(*svmData, pendingTaskCounts);
+            for (auto &taskCount : pendingTaskCounts) {
+                taskCount.first->waitForCompletionWithTimeout(false, TimeoutControls::maxTimeout, taskCount.second);
+            }
+        } else if (blocking) {
             if (svmData->cpuAllocation) {
                 this->memoryManager->waitForEnginesCompletion(*svmData->cpuAllocation);
             }
@@ -199,7 +316,9 @@ bool SVMAllocsManager::freeSVMAlloc(void *ptr, bool blocking) {
             pageFaultManager->removeAllocation(ptr);
         }
         std::unique_lock<SpinLock> lock(mtx);
-        if (svmData->gpuAllocation->getAllocationType() == GraphicsAllocation::AllocationType::SVM_ZERO_COPY) {
+        if (svmData->pool) {
+            freePooledUnifiedMemoryAllocation(svmData);
+        } else if (svmData->gpuAllocation->getAllocationType() == GraphicsAllocation::AllocationType::SVM_ZERO_COPY) {
             freeZeroCopySvmAllocation(svmData);
         } else {
             freeSvmAllocationWithDeviceStorage(svmData);
@@ -284,6 +403,59 @@ void SVMAllocsManager::freeZeroCopySvmAllocation(SvmAllocationData *svmData) {
     memoryManager->freeGraphicsMemory(gpuAllocation);
 }
 
+void SVMAllocsManager::freePooledUnifiedMemoryAllocation(SvmAllocationData *svmData) {
+    auto pool = svmData->pool;
+
+    // engines may still use the sub-allocation, it is handed out again once they complete pool's current task counts
+    EngineTaskCounts engineTaskCounts;
+    getPendingPooledAllocationTaskCounts(*svmData, engineTaskCounts);
+    UnifiedMemoryPool::EngineTaskCounts pendingTaskCounts;
+    for (auto &taskCount : engineTaskCounts) {
+        pendingTaskCounts.push_back({taskCount.first->getTagAddress(), taskCount.second});
+    }
+    if (pendingTaskCounts.empty()) {
+        pool->free(svmData->getGpuAddress());
+    } else {
+        pool->freeWhenCompleted(svmData->getGpuAddress(), pendingTaskCounts);
+    }
+    SVMAllocs.remove(*svmData);
+
+    if (!pool->isEmpty()) {
+        return;
+    }
+    // keep one pool per allocation kind to absorb alloc/free churn
+    auto sameKindPools = std::count_if(unifiedMemoryPools.begin(), unifiedMemoryPools.end(), [pool](const std::unique_ptr<UnifiedMemoryPool> &otherPool) {
+        return otherPool->isSameKind(*pool);
+    });
+    if (sameKindPools > 1) {
+        auto it = std::find_if(unifiedMemoryPools.begin(), unifiedMemoryPools.end(), [pool](const std::unique_ptr<UnifiedMemoryPool> &otherPool) {
+            return otherPool.get() == pool;
+        });
+        memoryManager->freeGraphicsMemory(pool->getAllocation());
+        unifiedMemoryPools.erase(it);
+    }
+}
+
+void SVMAllocsManager::getPendingPooledAllocationTaskCounts(const SvmAllocationData &svmData, EngineTaskCounts &taskCounts) const {
+    // Pool allocation tracks usage of all sub-allocations together. Engines which did not submit work
+    // using the pool since the sub-allocation was created cannot use it.
+    auto poolAllocation = svmData.pool->getAllocation();
+    for (auto &engine : memoryManager->getRegisteredEngines()) {
+        auto osContextId = engine.osContext->getContextId();
+        auto allocationTaskCount = poolAllocation->getTaskCount(osContextId);
+        if (!poolAllocation->isUsedByOsContext(osContextId) ||
+            allocationTaskCount <= *engine.commandStreamReceiver->getTagAddress()) {
+            continue;
+        }
+        auto taskCountAtCreation = std::find_if(svmData.poolTaskCountsAtCreation.begin(), svmData.poolTaskCountsAtCreation.end(),
+                                                [osContextId](const std::pair<uint32_t, uint32_t> &taskCount) { return taskCount.first == osContextId; });
+        if (taskCountAtCreation != svmData.poolTaskCountsAtCreation.end() && taskCountAtCreation->second == allocationTaskCount) {
+            continue;
+        }
+        taskCounts.push_back({engine.commandStreamReceiver, allocationTaskCount});
+    }
+}
+
 void SVMAllocsManager::freeSvmAllocationWithDeviceStorage(SvmAllocationData *svmData) {
     GraphicsAllocation *gpuAllocation = svmData->gpuAllocation;
     GraphicsAllocation *cpuAllocation = svmData->cpuAllocation;
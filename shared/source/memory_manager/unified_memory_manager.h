@@ -10,17 +10,21 @@
 #include "shared/source/memory_manager/residency_container.h"
 #include "shared/source/unified_memory/unified_memory.h"
 #include "shared/source/utilities/spinlock.h"
+#include "shared/source/utilities/stackvec.h"
 
 #include "memory_properties_flags.h"
 
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace NEO {
 class CommandStreamReceiver;
 class GraphicsAllocation;
 class MemoryManager;
+class UnifiedMemoryPool;
 
 struct SvmAllocationData {
     GraphicsAllocation *cpuAllocation = nullptr;
@@ -29,6 +33,13 @@ struct SvmAllocationData {
     InternalMemoryType memoryType = InternalMemoryType::SVM;
     MemoryProperties allocationFlagsProperty;
     void *device = nullptr;
+    UnifiedMemoryPool *pool = nullptr;
+    size_t poolOffset = 0;
+    // Os context id and task count of the pool allocation when the sub-allocation was created,
+    // work submitted up to that task count cannot use the sub-allocation.
+    StackVec<std::pair<uint32_t, uint32_t>, 4> poolTaskCountsAtCreation;
+
+    uint64_t getGpuAddress() const;
 };
 
 struct SvmMapOperation {
@@ -79,9 +90,11 @@ class SVMAllocsManager {
         MemoryProperties allocationFlags;
         void *device = nullptr;
         DeviceBitfield subdeviceBitfield;
+        size_t alignment = 0u;
     };
 
     SVMAllocsManager(MemoryManager *memoryManager);
+    ~SVMAllocsManager();
     void *createSVMAlloc(uint32_t rootDeviceIndex, size_t size, const SvmAllocationProperties svmProperties, const DeviceBitfield &deviceBitfield);
     void *createUnifiedMemoryAllocation(uint32_t rootDeviceIndex, size_t size, const UnifiedMemoryProperties &svmProperties);
     void *createSharedUnifiedMemoryAllocation(uint32_t rootDeviceIndex, size_t size, const UnifiedMemoryProperties &svmProperties, void *cmdQ);
@@ -100,15 +113,23 @@ class SVMAllocsManager {
     void makeInternalAllocationsResident(CommandStreamReceiver &commandStreamReceiver, uint32_t requestedTypesMask);
     void *createUnifiedAllocationWithDeviceStorage(uint32_t rootDeviceIndex, size_t size, const SvmAllocationProperties &svmProperties, const UnifiedMemoryProperties &unifiedMemoryProperties);
     void freeSvmAllocationWithDeviceStorage(SvmAllocationData *svmData);
+    size_t getNumUnifiedMemoryPools() const { return unifiedMemoryPools.size(); }
 
   protected:
     void *createZeroCopySvmAllocation(uint32_t rootDeviceIndex, size_t size, const SvmAllocationProperties &svmProperties, const DeviceBitfield &deviceBitfield);
+    void *createPooledUnifiedMemoryAllocation(uint32_t rootDeviceIndex, size_t size, const UnifiedMemoryProperties &memoryProperties);
+    UnifiedMemoryPool *allocateFromUnifiedMemoryPools(uint32_t rootDeviceIndex, size_t size, const UnifiedMemoryProperties &memoryProperties, uint64_t &gpuAddress);
+    bool isUnifiedMemoryPoolingCandidate(size_t size, const UnifiedMemoryProperties &memoryProperties) const;
 
     void freeZeroCopySvmAllocation(SvmAllocationData *svmData);
+    void freePooledUnifiedMemoryAllocation(SvmAllocationData *svmData);
+    using EngineTaskCounts = StackVec<std::pair<CommandStreamReceiver *, uint32_t>, 4>;
+    void getPendingPooledAllocationTaskCounts(const SvmAllocationData &svmData, EngineTaskCounts &taskCounts) const;
 
     MapBasedAllocationTracker SVMAllocs;
     MapOperationsTracker svmMapOperations;
     MemoryManager *memoryManager;
     SpinLock mtx;
+    std::vector<std::unique_ptr<UnifiedMemoryPool>> unifiedMemoryPools;
 };
 } // namespace NEO
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/unified_memory_pool.h"
+
+#include "shared/source/utilities/heap_allocator.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+constexpr size_t UnifiedMemoryPool::chunkSize;
+constexpr size_t UnifiedMemoryPool::maxPooledSize;
+constexpr size_t UnifiedMemoryPool::subAllocationAlignment;
+
+class UnifiedMemoryPoolHeapAllocator : public HeapAllocator {
+  public:
+    UnifiedMemoryPoolHeapAllocator(uint64_t address, uint64_t size) : HeapAllocator(address, size, UnifiedMemoryPool::maxPooledSize) {
+        allocationAlignment = UnifiedMemoryPool::subAllocationAlignment;
+    }
+};
+
+UnifiedMemoryPool::UnifiedMemoryPool(GraphicsAllocation *allocation, InternalMemoryType memoryType, void *device, const DeviceBitfield &subdeviceBitfield)
+    : allocation(allocation), memoryType(memoryType), device(device), subdeviceBitfield(subdeviceBitfield) {
+    heapAllocator = std::make_unique<UnifiedMemoryPoolHeapAllocator>(allocation->getGpuAddress(), allocation->getUnderlyingBufferSize());
+}
+
+UnifiedMemoryPool::~UnifiedMemoryPool() = default;
+
+uint64_t UnifiedMemoryPool::allocate(size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+    releaseCompletedFreesLocked();
+    size_t sizeToAllocate = size;
+    auto gpuAddress = heapAllocator->allocate(sizeToAllocate);
+    if (gpuAddress == 0llu) {
+        return 0llu;
+    }
+    subAllocations.insert({gpuAddress, sizeToAllocate});
+    usedSize += sizeToAllocate;
+    return gpuAddress;
+}
+
+void UnifiedMemoryPool::free(uint64_t gpuAddress) {
+    std::lock_guard<std::mutex> lock(mtx);
+    freeLocked(gpuAddress);
+}
+
+void UnifiedMemoryPool::freeWhenCompleted(uint64_t gpuAddress, const EngineTaskCounts &taskCounts) {
+    std::lock_guard<std::mutex> lock(mtx);
+    UNRECOVERABLE_IF(subAllocations.find(gpuAddress) == subAllocations.end());
+    pendingFrees.push_back({gpuAddress, taskCounts});
+    releaseCompletedFreesLocked();
+}
+
+void UnifiedMemoryPool::releaseCompletedFrees() {
+    std::lock_guard<std::mutex> lock(mtx);
+    releaseCompletedFreesLocked();
+}
+
+void UnifiedMemoryPool::freeLocked(uint64_t gpuAddress) {
+    auto it = subAllocations.find(gpuAddress);
+    UNRECOVERABLE_IF(it == subAllocations.end());
+    heapAllocator->free(it->first, it->second);
+    usedSize -= it->second;
+    subAllocations.erase(it);
+}
+
+void UnifiedMemoryPool::releaseCompletedFreesLocked() {
+    auto completedEnd = std::partition(pendingFrees.begin(), pendingFrees.end(), [](const PendingFree &pendingFree) {
+        return std::any_of(pendingFree.taskCounts.begin(), pendingFree.taskCounts.end(), [](const std::pair<volatile uint32_t *, uint32_t> &taskCount) {
+            return taskCount.second > *taskCount.first;
+        });
+    });
+    for (auto it = completedEnd; it != pendingFrees.end(); it++) {
+        freeLocked(it->gpuAddress);
+    }
+    pendingFrees.erase(completedEnd, pendingFrees.end());
+}
+
+bool UnifiedMemoryPool::isCompatible(uint32_t rootDeviceIndex, InternalMemoryType memoryType, GraphicsAllocation::AllocationType allocationType,
+                                     void *device, const DeviceBitfield &subdeviceBitfield) const {
+    return (allocation->getRootDeviceIndex() == rootDeviceIndex) &&
+           (allocation->getAllocationType() == allocationType) &&
+           (this->memoryType == memoryType) &&
+           (this->device == device) &&
+           (this->subdeviceBitfield == subdeviceBitfield);
+}
+
+bool UnifiedMemoryPool::isSameKind(const UnifiedMemoryPool &other) const {
+    return isCompatible(other.allocation->getRootDeviceIndex(), other.memoryType, other.allocation->getAllocationType(), other.device, other.subdeviceBitfield);
+}
+
+bool UnifiedMemoryPool::isEmpty() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return subAllocations.empty();
+}
+
+size_t UnifiedMemoryPool::getUsedSize() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return usedSize;
+}
+
+size_t UnifiedMemoryPool::getSubAllocationsCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return subAllocations.size();
+}
+
+size_t UnifiedMemoryPool::getPendingFreesCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return pendingFrees.size();
+}
+
+} // namespace NEO
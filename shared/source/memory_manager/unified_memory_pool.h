@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/common_types.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/unified_memory/unified_memory.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+class HeapAllocator;
+
+// Single large USM allocation that small unified memory allocations are carved out of.
+// Sub-allocations share the chunk's graphics allocation, so they need no BO of their own
+// and appear in residency lists only once.
+class UnifiedMemoryPool : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t chunkSize = 2 * MemoryConstants::megaByte;
+    static constexpr size_t maxPooledSize = 64 * MemoryConstants::kiloByte;
+    static constexpr size_t subAllocationAlignment = 256u;
+
+    // Tag address of an engine and task count it has to reach before freed sub-allocation may be handed out again.
+    using EngineTaskCounts = StackVec<std::pair<volatile uint32_t *, uint32_t>, 4>;
+
+    UnifiedMemoryPool(GraphicsAllocation *allocation, InternalMemoryType memoryType, void *device, const DeviceBitfield &subdeviceBitfield);
+    ~UnifiedMemoryPool();
+
+    uint64_t allocate(size_t size);
+    void free(uint64_t gpuAddress);
+    // Sub-allocation stays used until every engine completes the given task count.
+    void freeWhenCompleted(uint64_t gpuAddress, const EngineTaskCounts &taskCounts);
+    void releaseCompletedFrees();
+
+    bool isCompatible(uint32_t rootDeviceIndex, InternalMemoryType memoryType, GraphicsAllocation::AllocationType allocationType,
+                      void *device, const DeviceBitfield &subdeviceBitfield) const;
+    bool isSameKind(const UnifiedMemoryPool &other) const;
+    bool isEmpty();
+    size_t getUsedSize();
+    size_t getSubAllocationsCount();
+    size_t getPendingFreesCount();
+    GraphicsAllocation *getAllocation() const { return allocation; }
+
+  protected:
+    struct PendingFree {
+        uint64_t gpuAddress;
+        EngineTaskCounts taskCounts;
+    };
+
+    void freeLocked(uint64_t gpuAddress);
+    void releaseCompletedFreesLocked();
+
+    GraphicsAllocation *allocation = nullptr;
+    const InternalMemoryType memoryType;
+    void *device = nullptr;
+    const DeviceBitfield subdeviceBitfield;
+    std::unique_ptr<HeapAllocator> heapAllocator;
+    std::unordered_map<uint64_t, size_t> subAllocations;
+    std::vector<PendingFree> pendingFrees;
+    size_t usedSize = 0u;
+    std::mutex mtx;
+};
+} // namespace NEO
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/cpu_gpu_time_correlator.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace NEO {
+
+constexpr size_t CpuGpuTimeCorrelator::maxSamples;
+constexpr uint64_t CpuGpuTimeCorrelator::defaultResyncPeriodNs;
+constexpr uint64_t CpuGpuTimeCorrelator::defaultMaxErrorNs;
+
+CpuGpuTimeCorrelator::CpuGpuTimeCorrelator(uint32_t timestampSizeInBits, uint64_t resyncPeriodNs, uint64_t maxErrorNs)
+    : timestampMask(timestampSizeInBits >= 64u ? std::numeric_limits<uint64_t>::max() : (1ull << timestampSizeInBits) - 1),
+      resyncPeriodNs(resyncPeriodNs), minSampleDistanceNs(resyncPeriodNs / 4), maxErrorNs(maxErrorNs) {
+}
+
+std::unique_ptr<CpuGpuTimeCorrelator> CpuGpuTimeCorrelator::create(uint32_t timestampSizeInBits) {
+    if (DebugManager.flags.EnableCpuGpuTimeCorrelation.get() != 1) {
+        return nullptr;
+    }
+    uint64_t resyncPeriodNs = defaultResyncPeriodNs;
+    if (DebugManager.flags.CpuGpuTimeCorrelationResyncPeriodMs.get() > 0) {
+        resyncPeriodNs = static_cast<uint64_t>(DebugManager.flags.CpuGpuTimeCorrelationResyncPeriodMs.get()) * 1000 * 1000;
+    }
+    uint64_t maxErrorNs = defaultMaxErrorNs;
+    if (DebugManager.flags.CpuGpuTimeCorrelationMaxErrorNs.get() > 0) {
+        maxErrorNs = static_cast<uint64_t>(DebugManager.flags.CpuGpuTimeCorrelationMaxErrorNs.get());
+    }
+    return std::make_unique<CpuGpuTimeCorrelator>(timestampSizeInBits, resyncPeriodNs, maxErrorNs);
+}
+
+bool CpuGpuTimeCorrelator::getGpuTimestamp(uint64_t cpuTimeNs, uint64_t &gpuTimestamp) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (!calibrated || resyncRequested || cpuTimeNs >= lastSampleCpuTimeNs + resyncPeriodNs) {
+        return false;
+    }
+    gpuTimestamp = predict(cpuTimeNs) & timestampMask;
+    return true;
+}
+
+void CpuGpuTimeCorrelator::addSample(const TimeStampData &sample) {
+    std::lock_guard<std::mutex> lock(mtx);
+
+    // Only a large step back is a wrap, a small one comes from pairs measured concurrently.
+    auto gpuTimestamp = sample.GPUTimeStamp & timestampMask;
+    if (gpuTimestamp < lastGpuTimestamp && lastGpuTimestamp - gpuTimestamp > timestampMask / 2) {
+        gpuTimestampWrapBase += timestampMask + 1;
+        lastGpuTimestamp = gpuTimestamp;
+    } else {
+        lastGpuTimestamp = std::max(lastGpuTimestamp, gpuTimestamp);
+    }
+
+    Sample newSample;
+    newSample.cpuTimeNs = sample.CPUTimeinNS;
+    newSample.gpuTimestamp = gpuTimestampWrapBase + gpuTimestamp;
+
+    if (calibrated) {
+        auto predictedGpuTimestamp = predict(newSample.cpuTimeNs);
+        auto errorTicks = newSample.gpuTimestamp > predictedGpuTimestamp ? newSample.gpuTimestamp - predictedGpuTimestamp
+                                                                         : predictedGpuTimestamp - newSample.gpuTimestamp;
+        newSample.errorNs = static_cast<uint64_t>(std::ceil(errorTicks / gpuTicksPerNs));
+        if (newSample.errorNs > maxErrorNs) {
+            // Clock changed its rate, calibrate again from scratch.
+            sampleCount = 0u;
+            calibrated = false;
+            errorBoundNs = 0u;
+            newSample.errorNs = 0u;
+        }
+    }
+
+    resyncRequested = false;
+    lastSampleCpuTimeNs = std::max(lastSampleCpuTimeNs, newSample.cpuTimeNs);
+
+    if (sampleCount != 0u) {
+        auto &newestSample = samples[(firstSample + sampleCount - 1) % maxSamples];
+        if (newSample.cpuTimeNs < newestSample.cpuTimeNs + minSampleDistanceNs) {
+            newestSample.errorNs = std::max(newestSample.errorNs, newSample.errorNs);
+            errorBoundNs = std::max(errorBoundNs, newSample.errorNs);
+            return;
+        }
+    }
+    if (sampleCount == maxSamples) {
+        firstSample = (firstSample + 1) % maxSamples;
+        sampleCount--;
+    }
+    samples[(firstSample + sampleCount) % maxSamples] = newSample;
+    sampleCount++;
+
+    fitModel();
+}
+
+void CpuGpuTimeCorrelator::resync() {
+    std::lock_guard<std::mutex> lock(mtx);
+    resyncRequested = true;
+}
+
+bool CpuGpuTimeCorrelator::isCalibrated() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return calibrated;
+}
+
+uint64_t CpuGpuTimeCorrelator::getErrorBound() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return errorBoundNs;
+}
+
+double CpuGpuTimeCorrelator::getGpuTicksPerNs() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return gpuTicksPerNs;
+}
+
+void CpuGpuTimeCorrelator::fitModel() {
+    const auto &oldestSample = samples[firstSample];
+    const auto &newestSample = samples[(firstSample + sampleCount - 1) % maxSamples];
+    if (sampleCount < 2u || newestSample.cpuTimeNs - oldestSample.cpuTimeNs < resyncPeriodNs) {
+        calibrated = false;
+        return;
+    }
+
+    // Least squares fit, relative to the newest sample to keep precision of doubles.
+    double meanCpu = 0.0;
+    double meanGpu = 0.0;
+    for (size_t i = 0; i < sampleCount; i++) {
+        const auto &sample = samples[(firstSample + i) % maxSamples];
+        meanCpu += static_cast<double>(static_cast<int64_t>(sample.cpuTimeNs - newestSample.cpuTimeNs));
+        meanGpu += static_cast<double>(static_cast<int64_t>(sample.gpuTimestamp - newestSample.gpuTimestamp));
+    }
+    meanCpu /= sampleCount;
+    meanGpu /= sampleCount;
+
+    double covariance = 0.0;
+    double variance = 0.0;
+    uint64_t maxSampleErrorNs = 0u;
+    for (size_t i = 0; i < sampleCount; i++) {
+        const auto &sample = samples[(firstSample + i) % maxSamples];
+        auto cpu = static_cast<double>(static_cast<int64_t>(sample.cpuTimeNs - newestSample.cpuTimeNs)) - meanCpu;
+        auto gpu = static_cast<double>(static_cast<int64_t>(sample.gpuTimestamp - newestSample.gpuTimestamp)) - meanGpu;
+        covariance += cpu * gpu;
+        variance += cpu * cpu;
+        maxSampleErrorNs = std::max(maxSampleErrorNs, sample.errorNs);
+    }
+
+    auto slope = covariance / variance;
+    if (!(slope > 0.0)) {
+        calibrated = false;
+        return;
+    }
+
+    gpuTicksPerNs = slope;
+    referenceCpuTimeNs = newestSample.cpuTimeNs;
+    referenceGpuTimestamp = newestSample.gpuTimestamp + static_cast<int64_t>(std::llround(meanGpu - slope * meanCpu));
+    errorBoundNs = maxSampleErrorNs;
+    calibrated = true;
+}
+
+uint64_t CpuGpuTimeCorrelator::predict(uint64_t cpuTimeNs) const {
+    auto cpuDelta = static_cast<double>(static_cast<int64_t>(cpuTimeNs - referenceCpuTimeNs));
+    return referenceGpuTimestamp + static_cast<int64_t>(std::llround(gpuTicksPerNs * cpuDelta));
+}
+
+} // namespace NEO
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/os_interface/os_time.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace NEO {
+
+// Answers CPU to GPU timestamp queries from a linear model fitted to measured CPU/GPU
+// timestamp pairs, so that most queries do not read the GPU timestamp register.
+// A new pair has to be measured once the last one is older than the resync period;
+// its distance from the model is the error bound of the following predictions.
+class CpuGpuTimeCorrelator : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t maxSamples = 8u;
+    static constexpr uint64_t defaultResyncPeriodNs = 100 * 1000 * 1000;
+    static constexpr uint64_t defaultMaxErrorNs = 10 * 1000;
+
+    CpuGpuTimeCorrelator(uint32_t timestampSizeInBits, uint64_t resyncPeriodNs, uint64_t maxErrorNs);
+
+    static std::unique_ptr<CpuGpuTimeCorrelator> create(uint32_t timestampSizeInBits);
+
+    // Returns false when a new pair has to be measured and passed to addSample().
+    bool getGpuTimestamp(uint64_t cpuTimeNs, uint64_t &gpuTimestamp);
+    void addSample(const TimeStampData &sample);
+    void resync();
+
+    bool isCalibrated();
+    uint64_t getErrorBound();
+    double getGpuTicksPerNs();
+
+  protected:
+    struct Sample {
+        uint64_t cpuTimeNs = 0;
+        uint64_t gpuTimestamp = 0;
+        uint64_t errorNs = 0;
+    };
+
+    void fitModel();
+    uint64_t predict(uint64_t cpuTimeNs) const;
+
+    const uint64_t timestampMask;
+    const uint64_t resyncPeriodNs;
+    const uint64_t minSampleDistanceNs;
+    const uint64_t maxErrorNs;
+
+    std::array<Sample, maxSamples> samples;
+    size_t firstSample = 0u;
+    size_t sampleCount = 0u;
+
+    uint64_t lastGpuTimestamp = 0u;
+    uint64_t gpuTimestampWrapBase = 0u;
+    uint64_t lastSampleCpuTimeNs = 0u;
+    bool resyncRequested = false;
+
+    bool calibrated = false;
+    uint64_t referenceCpuTimeNs = 0u;
+    uint64_t referenceGpuTimestamp = 0u;
+    double gpuTicksPerNs = 0.0;
+    uint64_t errorBoundNs = 0u;
+
+    std::mutex mtx;
+};
+} // namespace NEO
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_cpu_mapping_cache.h"
+
+namespace NEO {
+
+bool DrmCpuMappingCache::acquire(BufferObject *bo) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto lookup = entryLookup.find(bo);
+    if (lookup == entryLookup.end()) {
+        missCount++;
+        return false;
+    }
+    cachedSize -= lookup->second->size;
+    entries.erase(lookup->second);
+    entryLookup.erase(lookup);
+    hitCount++;
+    return true;
+}
+
+void DrmCpuMappingCache::add(const Entry &entry, std::vector<Entry> &evictedEntries) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (entry.size > maxSize || entryLookup.find(entry.bo) != entryLookup.end()) {
+        evictedEntries.push_back(entry);
+        evictionCount++;
+        return;
+    }
+
+    entries.push_front(entry);
+    entryLookup[entry.bo] = entries.begin();
+    cachedSize += entry.size;
+
+    while (cachedSize > maxSize) {
+        auto &oldestEntry = entries.back();
+        evictedEntries.push_back(oldestEntry);
+        evictionCount++;
+        cachedSize -= oldestEntry.size;
+        entryLookup.erase(oldestEntry.bo);
+        entries.pop_back();
+    }
+}
+
+bool DrmCpuMappingCache::remove(BufferObject *bo, Entry &entry) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto lookup = entryLookup.find(bo);
+    if (lookup == entryLookup.end()) {
+        return false;
+    }
+    entry = *lookup->second;
+    cachedSize -= entry.size;
+    entries.erase(lookup->second);
+    entryLookup.erase(lookup);
+    return true;
+}
+
+void DrmCpuMappingCache::removeAll(std::vector<Entry> &evictedEntries) {
+    std::lock_guard<std::mutex> lock(mtx);
+    evictedEntries.insert(evictedEntries.end(), entries.begin(), entries.end());
+    entries.clear();
+    entryLookup.clear();
+    cachedSize = 0u;
+}
+
+size_t DrmCpuMappingCache::getCachedSize() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return cachedSize;
+}
+
+} // namespace NEO
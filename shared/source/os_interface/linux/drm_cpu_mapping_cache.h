@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class BufferObject;
+
+// CPU mappings of buffer objects kept alive after unlock, so locking the same buffer object again does not
+// create a new mapping. Idle mappings are evicted least recently unlocked first once their total size exceeds
+// the budget; the caller releases evicted mappings. A mapping is owned by the cache only while it is idle.
+class DrmCpuMappingCache : NonCopyableOrMovableClass {
+  public:
+    struct Entry {
+        BufferObject *bo = nullptr;
+        void *lockedAddress = nullptr; // mapping owned by the entry, buffer object may be mapped again after eviction
+        size_t size = 0u;
+        uint32_t rootDeviceIndex = 0u;
+        bool localMemory = false;
+    };
+
+    explicit DrmCpuMappingCache(size_t maxSize) : maxSize(maxSize) {}
+
+    // Returns true when buffer object has idle mapping, the mapping is in use again until it is added back.
+    bool acquire(BufferObject *bo);
+    void add(const Entry &entry, std::vector<Entry> &evictedEntries);
+    bool remove(BufferObject *bo, Entry &entry);
+    void removeAll(std::vector<Entry> &evictedEntries);
+
+    size_t getMaxSize() const { return maxSize; }
+    size_t getCachedSize() const;
+    uint64_t getHitCount() const { return hitCount; }
+    uint64_t getMissCount() const { return missCount; }
+    uint64_t getEvictionCount() const { return evictionCount; }
+
+  protected:
+    using EntryList = std::list<Entry>;
+
+    const size_t maxSize;
+    mutable std::mutex mtx;
+    EntryList entries; // most recently unlocked first
+    std::unordered_map<BufferObject *, EntryList::iterator> entryLookup;
+    size_t cachedSize = 0u;
+    uint64_t hitCount = 0u;
+    uint64_t missCount = 0u;
+    uint64_t evictionCount = 0u;
+};
+} // namespace NEO
@@ -0,0 +1,279 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_device_probe.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/os_interface/linux/drm_neo.h"
+#include "shared/source/os_interface/linux/hw_device_id.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include "drm/i915_drm.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#include <unistd.h>
+
+namespace NEO {
+
+constexpr const char *DrmProbeCache::fileName;
+constexpr uint32_t DrmProbeCache::formatVersion;
+
+namespace {
+int probeIoctl(int fileDescriptor, unsigned long request, void *arg) {
+    int ret;
+    do {
+        ret = SysCalls::ioctl(fileDescriptor, request, arg);
+    } while (ret == -1 && (errno == EINTR || errno == EAGAIN));
+    return ret;
+}
+
+int probeParam(int fileDescriptor, int param, int &value) {
+    drm_i915_getparam_t getParam = {};
+    getParam.param = param;
+    getParam.value = &value;
+    return probeIoctl(fileDescriptor, DRM_IOCTL_I915_GETPARAM, &getParam);
+}
+
+bool probeTopology(int fileDescriptor, DrmDeviceProbe &probe) {
+    drm_i915_query query = {};
+    drm_i915_query_item queryItem = {};
+    queryItem.query_id = DRM_I915_QUERY_TOPOLOGY_INFO;
+    query.items_ptr = castToUint64(&queryItem);
+    query.num_items = 1;
+
+    if (probeIoctl(fileDescriptor, DRM_IOCTL_I915_QUERY, &query) != 0 || queryItem.length <= 0) {
+        return false;
+    }
+    auto data = std::make_unique<uint8_t[]>(queryItem.length);
+    memset(data.get(), 0, queryItem.length);
+    queryItem.data_ptr = castToUint64(data.get());
+    if (probeIoctl(fileDescriptor, DRM_IOCTL_I915_QUERY, &query) != 0 || queryItem.length <= 0) {
+        return false;
+    }
+    return Drm::translateTopologyInfo(reinterpret_cast<drm_i915_query_topology_info *>(data.get()),
+                                      probe.sliceCount, probe.subSliceCount, probe.euCount);
+}
+
+struct ProbeTask {
+    int fileDescriptor = -1;
+    std::string pciPath;
+    std::string key;
+    DrmDeviceProbe probe;
+    bool cached = false;
+    bool valid = false;
+};
+
+void *runProbeTask(void *arg) {
+    auto task = reinterpret_cast<ProbeTask *>(arg);
+    task->valid = DrmDeviceProbe::probe(task->fileDescriptor, task->probe);
+    return nullptr;
+}
+} // namespace
+
+bool DrmDeviceProbe::probe(int fileDescriptor, DrmDeviceProbe &probe) {
+    if (probeParam(fileDescriptor, I915_PARAM_CHIPSET_ID, probe.deviceId) != 0 ||
+        probeParam(fileDescriptor, I915_PARAM_REVISION, probe.revisionId) != 0 ||
+        probeParam(fileDescriptor, I915_PARAM_HAS_EXEC_SOFTPIN, probe.hasExecSoftPin) != 0) {
+        return false;
+    }
+
+    probe.topologyValid = probeTopology(fileDescriptor, probe);
+    if (!probe.topologyValid) {
+        probe.sliceCount = 0;
+        if (probeParam(fileDescriptor, I915_PARAM_EU_TOTAL, probe.euCount) != 0 ||
+            probeParam(fileDescriptor, I915_PARAM_SUBSLICE_TOTAL, probe.subSliceCount) != 0) {
+            return false;
+        }
+    }
+
+    drm_i915_gem_context_param contextParam = {};
+    contextParam.param = I915_CONTEXT_PARAM_GTT_SIZE;
+    probe.gttSizeValid = probeIoctl(fileDescriptor, DRM_IOCTL_I915_GEM_CONTEXT_GETPARAM, &contextParam) == 0;
+    probe.gttSize = probe.gttSizeValid ? contextParam.value : 0u;
+
+    return true;
+}
+
+void DrmDeviceProbe::probeDevices(std::vector<std::unique_ptr<HwDeviceId>> &hwDeviceIds) {
+    const bool parallelProbe = DebugManager.flags.EnableParallelDeviceProbe.get() == 1;
+    const bool probeCache = DebugManager.flags.EnableDeviceProbeCache.get() == 1;
+    if (!parallelProbe && !probeCache) {
+        return;
+    }
+
+    std::unique_ptr<DrmProbeCache> cache;
+    if (probeCache) {
+        auto cacheDirectory = DrmProbeCache::getCacheDirectory();
+        auto bootId = DrmProbeCache::readBootId();
+        if (!cacheDirectory.empty() && !bootId.empty()) {
+            cache = std::make_unique<DrmProbeCache>(cacheDirectory, bootId);
+            cache->load();
+        }
+    }
+
+    std::vector<ProbeTask> tasks(hwDeviceIds.size());
+    for (size_t i = 0; i < hwDeviceIds.size(); i++) {
+        auto &task = tasks[i];
+        task.fileDescriptor = hwDeviceIds[i]->getFileDescriptor();
+        task.pciPath = hwDeviceIds[i]->getPciPath();
+        if (cache) {
+            task.key = DrmProbeCache::createKey(task.fileDescriptor, task.pciPath);
+            task.cached = !task.key.empty() && cache->find(task.key, task.probe);
+            task.valid = task.cached;
+        }
+    }
+
+    std::vector<std::unique_ptr<Thread>> threads;
+    for (auto &task : tasks) {
+        if (task.cached) {
+            continue;
+        }
+        if (parallelProbe) {
+            threads.push_back(Thread::create(runProbeTask, reinterpret_cast<void *>(&task)));
+        } else {
+            runProbeTask(&task);
+        }
+    }
+    for (auto &thread : threads) {
+        thread->join();
+    }
+
+    for (size_t i = 0; i < hwDeviceIds.size(); i++) {
+        auto &task = tasks[i];
+        if (!task.valid) {
+            continue;
+        }
+        hwDeviceIds[i]->setProbe(std::make_unique<DrmDeviceProbe>(task.probe));
+        if (cache && !task.cached && !task.key.empty()) {
+            cache->add(task.key, task.probe);
+        }
+    }
+
+    if (cache && !cache->save()) {
+        printDebugString(DebugManager.flags.PrintDebugMessages.get(), stderr, "%s", "WARNING: Failed to save device probe cache\n");
+    }
+}
+
+DrmProbeCache::DrmProbeCache(const std::string &cacheDirectory, const std::string &bootId)
+    : path(cacheDirectory + "/" + fileName), bootId(bootId) {
+}
+
+std::string DrmProbeCache::getCacheDirectory() {
+    if (DebugManager.flags.DeviceProbeCacheDir.get() != "unk") {
+        return DebugManager.flags.DeviceProbeCacheDir.get();
+    }
+    // Per-user runtime directory, cleaned up at logout and reboot.
+    auto runtimeDirectory = getenv("XDG_RUNTIME_DIR");
+    return runtimeDirectory ? runtimeDirectory : "";
+}
+
+std::string DrmProbeCache::readBootId() {
+    std::string bootId;
+    std::ifstream file("/proc/sys/kernel/random/boot_id");
+    std::getline(file, bootId);
+    return bootId;
+}
+
+std::string DrmProbeCache::createKey(int fileDescriptor, const std::string &pciPath) {
+    char name[16] = {};
+    char date[16] = {};
+    drm_version_t version = {};
+    version.name = name;
+    version.name_len = sizeof(name) - 1;
+    version.date = date;
+    version.date_len = sizeof(date) - 1;
+    if (probeIoctl(fileDescriptor, DRM_IOCTL_VERSION, &version) != 0) {
+        return {};
+    }
+
+    std::string renderNode = "-";
+    struct stat fileStat = {};
+    if (fstat(fileDescriptor, &fileStat) == 0 && S_ISCHR(fileStat.st_mode)) {
+        renderNode = std::to_string(minor(fileStat.st_rdev));
+    }
+
+    return pciPath + "/" + renderNode + "/" + name + "-" + std::to_string(version.version_major) + "." +
+           std::to_string(version.version_minor) + "." + std::to_string(version.version_patchlevel) + "-" + date;
+}
+
+bool DrmProbeCache::load() {
+    // Probe results configure the device, so only a file that nobody else could modify is trusted.
+    struct stat fileStat = {};
+    if (stat(path.c_str(), &fileStat) != 0 || !S_ISREG(fileStat.st_mode) ||
+        fileStat.st_uid != geteuid() || (fileStat.st_mode & (S_IWGRP | S_IWOTH)) != 0) {
+        return false;
+    }
+
+    std::ifstream file(path);
+    uint32_t fileFormatVersion = 0;
+    std::string fileBootId;
+    file >> fileFormatVersion >> fileBootId;
+    if (!file || fileFormatVersion != formatVersion || fileBootId != bootId) {
+        return false;
+    }
+
+    std::string key;
+    DrmDeviceProbe probe;
+    while (file >> key >> probe.deviceId >> probe.revisionId >> probe.hasExecSoftPin >> probe.topologyValid >> probe.sliceCount >> probe.subSliceCount >> probe.euCount >> probe.gttSizeValid >> probe.gttSize) {
+        entries[key] = probe;
+    }
+    return true;
+}
+
+bool DrmProbeCache::save() {
+    if (!modified) {
+        return true;
+    }
+
+    auto temporaryPath = path + "." + std::to_string(getpid());
+    {
+        std::ofstream file(temporaryPath, std::ios::trunc);
+        file << formatVersion << " " << bootId << "\n";
+        for (auto &entry : entries) {
+            auto &probe = entry.second;
+            file << entry.first << " " << probe.deviceId << " " << probe.revisionId << " " << probe.hasExecSoftPin << " "
+                 << probe.topologyValid << " " << probe.sliceCount << " " << probe.subSliceCount << " " << probe.euCount << " "
+                 << probe.gttSizeValid << " " << probe.gttSize << "\n";
+        }
+        if (!file) {
+            std::remove(temporaryPath.c_str());
+            return false;
+        }
+    }
+
+    // Concurrently starting processes replace the whole file, readers never see a partial one.
+    if (chmod(temporaryPath.c_str(), S_IRUSR | S_IWUSR) != 0 || std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+    modified = false;
+    return true;
+}
+
+bool DrmProbeCache::find(const std::string &key, DrmDeviceProbe &probe) const {
+    auto entry = entries.find(key);
+    if (entry == entries.end()) {
+        return false;
+    }
+    probe = entry->second;
+    return true;
+}
+
+void DrmProbeCache::add(const std::string &key, const DrmDeviceProbe &probe) {
+    entries[key] = probe;
+    modified = true;
+}
+
+} // namespace NEO
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class HwDeviceId;
+
+// Values queried from a render node while creating Drm. Devices are probed during discovery,
+// all at once, and Drm queries are then answered from the probe instead of the kernel.
+// Only values fixed for the boot are probed, values that can be changed at runtime, as frequency limits, are read live.
+struct DrmDeviceProbe {
+    int deviceId = 0;
+    int revisionId = 0;
+    int hasExecSoftPin = 0;
+    bool topologyValid = false;
+    int sliceCount = 0;
+    int subSliceCount = 0;
+    int euCount = 0;
+    bool gttSizeValid = false;
+    uint64_t gttSize = 0;
+
+    static bool probe(int fileDescriptor, DrmDeviceProbe &probe);
+    static void probeDevices(std::vector<std::unique_ptr<HwDeviceId>> &hwDeviceIds);
+};
+
+// Probes of devices valid for the current boot, kept in a file owned by the user.
+// Entries are keyed by pci path, render node and kernel driver version.
+class DrmProbeCache {
+  public:
+    static constexpr const char *fileName = "neo_drm_probe_cache";
+    static constexpr uint32_t formatVersion = 2u;
+
+    DrmProbeCache(const std::string &cacheDirectory, const std::string &bootId);
+
+    static std::string getCacheDirectory();
+    static std::string readBootId();
+    static std::string createKey(int fileDescriptor, const std::string &pciPath);
+
+    bool load();
+    bool save();
+    bool find(const std::string &key, DrmDeviceProbe &probe) const;
+    void add(const std::string &key, const DrmDeviceProbe &probe);
+    size_t size() const { return entries.size(); }
+
+  protected:
+    const std::string path;
+    const std::string bootId;
+    std::unordered_map<std::string, DrmDeviceProbe> entries;
+    bool modified = false;
+};
+} // namespace NEO
@@ -70,9 +70,14 @@ DrmMemoryManager::DrmMemoryManager(gemCloseWorkerMode mode,
 
         pinBBs.push_back(bo);
     }
+
+    if (DebugManager.flags.CpuMappingCacheMaxSize.get() > 0) {
+        cpuMappingCache = std::make_unique<DrmCpuMappingCache>(static_cast<size_t>(DebugManager.flags.CpuMappingCacheMaxSize.get()));
+    }
 }
 
 DrmMemoryManager::~DrmMemoryManager() {
+    clearCpuMappingCache();
     for (auto &memoryForPinBB : memoryForPinBBs) {
         if (memoryForPinBB) {
             MemoryManager::alignedFreeWrapper(memoryForPinBB);
@@ -81,6 +86,8 @@ DrmMemoryManager::~DrmMemoryManager() {
 }
 
 void DrmMemoryManager::commonCleanup() {
+    clearCpuMappingCache();
+
     if (gemCloseWorker) {
         gemCloseWorker->close(false);
     }
@@ -570,6 +577,14 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation)
         cleanGraphicsMemoryCreatedFromHostPtr(gfxAllocation);
     } else {
         auto &bos = static_cast<DrmAllocation *>(gfxAllocation)->getBOs();
+        if (cpuMappingCache) {
+            for (auto bo : bos) {
+                DrmCpuMappingCache::Entry cachedMapping;
+                if (bo && cpuMappingCache->remove(bo, cachedMapping)) {
+                    releaseCpuMapping(cachedMapping);
+                }
+            }
+        }
         for (auto bo : bos) {
             unreference(bo, bo && bo->isReused ? false : true);
         }
@@ -681,6 +696,10 @@ bool DrmMemoryManager::setDomainCpu(GraphicsAllocation &graphicsAllocation, bool
 
 void *DrmMemoryManager::lockResourceImpl(GraphicsAllocation &graphicsAllocation) {
     if (MemoryPool::LocalMemory == graphicsAllocation.getMemoryPool()) {
+        auto bo = static_cast<DrmAllocation &>(graphicsAllocation).getBO();
+        if (cpuMappingCache && bo && cpuMappingCache->acquire(bo)) {
+            return bo->peekLockedAddress();
+        }
         return lockResourceInLocalMemoryImpl(graphicsAllocation);
     }
 
@@ -696,14 +715,16 @@ void *DrmMemoryManager::lockResourceImpl(GraphicsAllocation &graphicsAllocation)
     if (bo == nullptr)
         return nullptr;
 
-    drm_i915_gem_mmap mmap_arg = {};
-    mmap_arg.handle = bo->peekHandle();
-    mmap_arg.size = bo->peekSize();
-    if (getDrm(graphicsAllocation.getRootDeviceIndex()).ioctl(DRM_IOCTL_I915_GEM_MMAP, &mmap_arg) != 0) {
-        return nullptr;
-    }
+    if (!cpuMappingCache || !cpuMappingCache->acquire(bo)) {
+        drm_i915_gem_mmap mmap_arg = {};
+        mmap_arg.handle = bo->peekHandle();
+        mmap_arg.size = bo->peekSize();
+        if (getDrm(graphicsAllocation.getRootDeviceIndex()).ioctl(DRM_IOCTL_I915_GEM_MMAP, &mmap_arg) != 0) {
+            return nullptr;
+        }
 
-    bo->setLockedAddress(reinterpret_cast<void *>(mmap_arg.addr_ptr));
+        bo->setLockedAddress(reinterpret_cast<void *>(mmap_arg.addr_ptr));
+    }
 
     auto success = setDomainCpu(graphicsAllocation, false);
     DEBUG_BREAK_IF(!success);
@@ -713,16 +734,30 @@ void *DrmMemoryManager::lockResourceImpl(GraphicsAllocation &graphicsAllocation)
 }
 
 void DrmMemoryManager::unlockResourceImpl(GraphicsAllocation &graphicsAllocation) {
-    if (MemoryPool::LocalMemory == graphicsAllocation.getMemoryPool()) {
-        return unlockResourceInLocalMemoryImpl(static_cast<DrmAllocation &>(graphicsAllocation).getBO());
+    auto localMemory = MemoryPool::LocalMemory == graphicsAllocation.getMemoryPool();
+    if (!localMemory && graphicsAllocation.getUnderlyingBuffer() != nullptr) {
+        return;
     }
 
-    auto cpuPtr = graphicsAllocation.getUnderlyingBuffer();
-    if (cpuPtr != nullptr) {
+    auto bo = static_cast<DrmAllocation &>(graphicsAllocation).getBO();
+    if (cpuMappingCache && bo && bo->peekLockedAddress()) {
+        DrmCpuMappingCache::Entry cachedMapping;
+        cachedMapping.bo = bo;
+        cachedMapping.lockedAddress = bo->peekLockedAddress();
+        cachedMapping.size = bo->peekSize();
+        cachedMapping.rootDeviceIndex = graphicsAllocation.getRootDeviceIndex();
+        cachedMapping.localMemory = localMemory;
+
+        std::vector<DrmCpuMappingCache::Entry> evictedMappings;
+        cpuMappingCache->add(cachedMapping, evictedMappings);
+        releaseCpuMappings(evictedMappings);
         return;
     }
 
-    auto bo = static_cast<DrmAllocation &>(graphicsAllocation).getBO();
+    if (localMemory) {
+        return unlockResourceInLocalMemoryImpl(bo);
+    }
+
     if (bo == nullptr)
         return;
 
@@ -731,6 +766,33 @@ void DrmMemoryManager::unlockResourceImpl(GraphicsAllocation &graphicsAllocation
     bo->setLockedAddress(nullptr);
 }
 
+void DrmMemoryManager::releaseCpuMapping(const DrmCpuMappingCache::Entry &cachedMapping) {
+    if (cachedMapping.localMemory) {
+        return unlockResourceInLocalMemoryImpl(cachedMapping.bo);
+    }
+
+    releaseReservedCpuAddressRange(cachedMapping.lockedAddress, cachedMapping.size, cachedMapping.rootDeviceIndex);
+
+    // Evicted mappings are released outside of the cache lock, the buffer object may be locked and mapped again meanwhile.
+    if (cachedMapping.bo->peekLockedAddress() == cachedMapping.lockedAddress) {
+        cachedMapping.bo->setLockedAddress(nullptr);
+    }
+}
+
+void DrmMemoryManager::releaseCpuMappings(const std::vector<DrmCpuMappingCache::Entry> &cachedMappings) {
+    for (auto &cachedMapping : cachedMappings) {
+        releaseCpuMapping(cachedMapping);
+    }
+}
+
+void DrmMemoryManager::clearCpuMappingCache() {
+    if (cpuMappingCache) {
+        std::vector<DrmCpuMappingCache::Entry> cachedMappings;
+        cpuMappingCache->removeAll(cachedMappings);
+        releaseCpuMappings(cachedMappings);
+    }
+}
+
 int DrmMemoryManager::obtainFdFromHandle(int boHandle, uint32_t rootDeviceindex) {
     drm_prime_handle openFd = {0, 0, 0};
 
@@ -9,6 +9,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/linux/drm_allocation.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
+#include "shared/source/os_interface/linux/drm_cpu_mapping_cache.h"
 #include "shared/source/os_interface/linux/drm_neo.h"
 
 #include "drm_gem_close_worker.h"
@@ -81,6 +82,9 @@ class DrmMemoryManager : public MemoryManager {
     MOCKABLE_VIRTUAL void *lockResourceInLocalMemoryImpl(BufferObject *bo);
     MOCKABLE_VIRTUAL void unlockResourceInLocalMemoryImpl(BufferObject *bo);
     void unlockResourceImpl(GraphicsAllocation &graphicsAllocation) override;
+    void releaseCpuMapping(const DrmCpuMappingCache::Entry &cachedMapping);
+    void releaseCpuMappings(const std::vector<DrmCpuMappingCache::Entry> &cachedMappings);
+    void clearCpuMappingCache();
     DrmAllocation *allocate32BitGraphicsMemoryImpl(const AllocationData &allocationData) override;
     GraphicsAllocation *allocateGraphicsMemoryInDevicePool(const AllocationData &allocationData, AllocationStatus &status) override;
 
@@ -99,5 +103,6 @@ class DrmMemoryManager : public MemoryManager {
     decltype(&close) closeFunction = close;
     std::vector<BufferObject *> sharingBufferObjects;
     std::mutex mtx;
+    std::unique_ptr<DrmCpuMappingCache> cpuMappingCache;
 };
 } // namespace NEO
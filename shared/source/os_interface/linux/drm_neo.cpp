@@ -79,14 +79,26 @@ int Drm::getParamIoctl(int param, int *dstValue) {
 }
 
 int Drm::getDeviceID(int &devId) {
+    if (auto probe = hwDeviceId->getProbe()) {
+        devId = probe->deviceId;
+        return 0;
+    }
     return getParamIoctl(I915_PARAM_CHIPSET_ID, &devId);
 }
 
 int Drm::getDeviceRevID(int &revId) {
+    if (auto probe = hwDeviceId->getProbe()) {
+        revId = probe->revisionId;
+        return 0;
+    }
     return getParamIoctl(I915_PARAM_REVISION, &revId);
 }
 
 int Drm::getExecSoftPin(int &execSoftPin) {
+    if (auto probe = hwDeviceId->getProbe()) {
+        execSoftPin = probe->hasExecSoftPin;
+        return 0;
+    }
     return getParamIoctl(I915_PARAM_HAS_EXEC_SOFTPIN, &execSoftPin);
 }
 
@@ -115,6 +127,12 @@ std::string Drm::getSysFsPciPath() {
 }
 
 int Drm::queryGttSize(uint64_t &gttSizeOutput) {
+    auto probe = hwDeviceId->getProbe();
+    if (probe && probe->gttSizeValid) {
+        gttSizeOutput = probe->gttSize;
+        return 0;
+    }
+
     drm_i915_gem_context_param contextParam = {0};
     contextParam.param = I915_CONTEXT_PARAM_GTT_SIZE;
 
@@ -213,10 +231,20 @@ void Drm::destroyDrmContext(uint32_t drmContextId) {
 }
 
 int Drm::getEuTotal(int &euTotal) {
+    auto probe = hwDeviceId->getProbe();
+    if (probe && !probe->topologyValid) {
+        euTotal = probe->euCount;
+        return 0;
+    }
     return getParamIoctl(I915_PARAM_EU_TOTAL, &euTotal);
 }
 
 int Drm::getSubsliceTotal(int &subsliceTotal) {
+    auto probe = hwDeviceId->getProbe();
+    if (probe && !probe->topologyValid) {
+        subsliceTotal = probe->subSliceCount;
+        return 0;
+    }
     return getParamIoctl(I915_PARAM_SUBSLICE_TOTAL, &subsliceTotal);
 }
 
@@ -297,6 +325,7 @@ std::vector<std::unique_ptr<HwDeviceId>> OSInterface::discoverDevices(ExecutionE
                 break;
             }
         }
+        DrmDeviceProbe::probeDevices(hwDeviceIds);
         return hwDeviceIds;
     }
 
@@ -322,6 +351,7 @@ std::vector<std::unique_ptr<HwDeviceId>> OSInterface::discoverDevices(ExecutionE
             return hwDeviceIds;
         }
     } while (hwDeviceIds.size() < numRootDevices);
+    DrmDeviceProbe::probeDevices(hwDeviceIds);
     return hwDeviceIds;
 }
 
@@ -368,6 +398,13 @@ std::unique_ptr<uint8_t[]> Drm::query(uint32_t queryId, int32_t &length) {
 }
 
 bool Drm::queryTopology(int &sliceCount, int &subSliceCount, int &euCount) {
+    if (auto probe = hwDeviceId->getProbe()) {
+        sliceCount = probe->sliceCount;
+        subSliceCount = probe->subSliceCount;
+        euCount = probe->euCount;
+        return probe->topologyValid;
+    }
+
     int32_t length;
     auto dataQuery = this->query(DRM_I915_QUERY_TOPOLOGY_INFO, length);
     auto data = reinterpret_cast<drm_i915_query_topology_info *>(dataQuery.get());
@@ -375,7 +412,10 @@ bool Drm::queryTopology(int &sliceCount, int &subSliceCount, int &euCount) {
     if (!data) {
         return false;
     }
+    return translateTopologyInfo(data, sliceCount, subSliceCount, euCount);
+}
 
+bool Drm::translateTopologyInfo(const drm_i915_query_topology_info *data, int &sliceCount, int &subSliceCount, int &euCount) {
     sliceCount = 0;
     subSliceCount = 0;
     euCount = 0;
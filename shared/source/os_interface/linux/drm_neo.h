@@ -97,6 +97,7 @@ class Drm {
     static inline uint16_t getMemoryInstanceFromRegion(uint32_t region) { return Math::log2(region & 0xFFFF); };
 
     static bool isi915Version(int fd);
+    static bool translateTopologyInfo(const drm_i915_query_topology_info *data, int &sliceCount, int &subSliceCount, int &euCount);
 
     static Drm *create(std::unique_ptr<HwDeviceId> hwDeviceId, RootDeviceEnvironment &rootDeviceEnvironment);
 
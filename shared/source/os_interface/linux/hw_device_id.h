@@ -7,6 +7,9 @@
 
 #pragma once
 #include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/os_interface/linux/drm_device_probe.h"
+
+#include <memory>
 
 #include <string>
 namespace NEO {
@@ -17,9 +20,12 @@ class HwDeviceId : NonCopyableClass {
     ~HwDeviceId();
     int getFileDescriptor() const { return fileDescriptor; }
     const char *getPciPath() const { return pciPath.c_str(); }
+    const DrmDeviceProbe *getProbe() const { return probe.get(); }
+    void setProbe(std::unique_ptr<DrmDeviceProbe> &&probeIn) { probe = std::move(probeIn); }
 
   protected:
     const int fileDescriptor;
     const std::string pciPath;
+    std::unique_ptr<DrmDeviceProbe> probe;
 };
 } // namespace NEO
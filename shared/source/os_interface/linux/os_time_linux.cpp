@@ -51,6 +51,7 @@ void OSTimeLinux::timestampTypeDetect() {
         getGpuTime = &OSTimeLinux::getGpuTime36;
         timestampSizeInBits = OCLRT_NUM_TIMESTAMP_BITS;
     }
+    correlator = CpuGpuTimeCorrelator::create(timestampSizeInBits);
 }
 
 bool OSTimeLinux::getCpuTime(uint64_t *timestamp) {
@@ -117,16 +118,37 @@ bool OSTimeLinux::getCpuGpuTime(TimeStampData *pGpuCpuTime) {
     if (nullptr == this->getGpuTime) {
         return false;
     }
+    if (correlator) {
+        if (!getCpuTime(&pGpuCpuTime->CPUTimeinNS)) {
+            return false;
+        }
+        if (correlator->getGpuTimestamp(pGpuCpuTime->CPUTimeinNS, pGpuCpuTime->GPUTimeStamp)) {
+            return true;
+        }
+    }
     if (!(this->*getGpuTime)(&pGpuCpuTime->GPUTimeStamp)) {
         return false;
     }
     if (!getCpuTime(&pGpuCpuTime->CPUTimeinNS)) {
         return false;
     }
+    if (correlator) {
+        correlator->addSample(*pGpuCpuTime);
+    }
 
     return true;
 }
 
+uint64_t OSTimeLinux::getCpuGpuTimeErrorBound() {
+    return correlator ? correlator->getErrorBound() : 0u;
+}
+
+void OSTimeLinux::resyncCpuGpuTime() {
+    if (correlator) {
+        correlator->resync();
+    }
+}
+
 std::unique_ptr<OSTime> OSTime::create(OSInterface *osInterface) {
     return std::unique_ptr<OSTime>(new OSTimeLinux(osInterface));
 }
@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "shared/source/os_interface/cpu_gpu_time_correlator.h"
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/os_time.h"
 
@@ -31,6 +32,8 @@ class OSTimeLinux : public OSTime {
     double getHostTimerResolution() const override;
     double getDynamicDeviceTimerResolution(HardwareInfo const &hwInfo) const override;
     uint64_t getCpuRawTimestamp() override;
+    uint64_t getCpuGpuTimeErrorBound() override;
+    void resyncCpuGpuTime() override;
 
   protected:
     typedef int (*resolutionFunc_t)(clockid_t, struct timespec *);
@@ -39,6 +42,7 @@ class OSTimeLinux : public OSTime {
     unsigned timestampSizeInBits;
     resolutionFunc_t resolutionFunc;
     getTimeFunc_t getTimeFunc;
+    std::unique_ptr<CpuGpuTimeCorrelator> correlator;
 };
 
 } // namespace NEO
@@ -30,6 +30,8 @@ class OSTime {
     virtual double getHostTimerResolution() const = 0;
     virtual double getDynamicDeviceTimerResolution(HardwareInfo const &hwInfo) const = 0;
     virtual uint64_t getCpuRawTimestamp() = 0;
+    virtual uint64_t getCpuGpuTimeErrorBound() { return 0u; }
+    virtual void resyncCpuGpuTime() {}
     OSInterface *getOSInterface() const {
         return osInterface;
     }
@@ -14,13 +14,24 @@
 namespace NEO {
 
 PrintFormatter::PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t printfOutputBufferMaxSize,
-                               bool using32BitPointers, const StringMap &stringLiteralMap)
+                               bool using32BitPointers, const StringMap &stringLiteralMap,
+                               const PrintfFormatProgramMap *formatPrograms)
     : printfOutputBuffer(printfOutputBuffer),
       printfOutputBufferSize(printfOutputBufferMaxSize),
       stringLiteralMap(stringLiteralMap),
+      formatPrograms(formatPrograms),
       using32BitPointers(using32BitPointers) {
 }
 
+void PrintFormatter::printKernelOutput() {
+    // whole output is written at once, records are not flushed to stdout one by one
+    std::string output;
+    printKernelOutput([&output](char *str) { output.append(str); });
+    if (!output.empty()) {
+        printToSTDOUT(output.c_str());
+    }
+}
+
 void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print) {
     currentOffset = 0;
 
@@ -29,50 +40,106 @@ void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print)
     read(&printfOutputBufferSizeRead);
     printfOutputBufferSize = std::min(printfOutputBufferSizeRead, printfOutputBufferSize);
 
+    char output[maxPrintfOutputLength];
     uint32_t stringIndex = 0;
     while (currentOffset + 4 <= printfOutputBufferSize) {
         read(&stringIndex);
-        const char *formatString = queryPrintfString(stringIndex);
-        if (formatString != nullptr) {
-            printString(formatString, print);
+        auto formatProgram = queryFormatProgram(stringIndex);
+        if (formatProgram != nullptr) {
+            printProgram(*formatProgram, output);
+            print(output);
         }
     }
 }
 
-void PrintFormatter::printString(const char *formatString, const std::function<void(char *)> &print) {
+PrintfFormatProgram PrintFormatter::compileFormatString(const char *formatString) {
+    PrintfFormatProgram program;
     size_t length = strnlen_s(formatString, maxPrintfOutputLength);
-    char output[maxPrintfOutputLength];
 
-    size_t cursor = 0;
-    for (size_t i = 0; i <= length; i++) {
-        if (formatString[i] == '\\')
-            output[cursor++] = escapeChar(formatString[++i]);
-        else if (formatString[i] == '%') {
-            size_t end = i;
-            if (end + 1 <= length && formatString[end + 1] == '%') {
-                output[cursor++] = '%';
+    std::string literal;
+    auto addLiteral = [&program, &literal]() {
+        if (!literal.empty()) {
+            PrintfFormatToken token;
+            token.text.swap(literal);
+            program.push_back(std::move(token));
+        }
+    };
+
+    for (size_t i = 0; i < length; i++) {
+        if (formatString[i] == '\\') {
+            // trailing backslash terminates the output
+            if (++i < length) {
+                literal.push_back(escapeChar(formatString[i]));
+            }
+        } else if (formatString[i] == '%') {
+            if (i + 1 < length && formatString[i + 1] == '%') {
+                literal.push_back('%');
+                i++;
                 continue;
             }
 
+            size_t end = i;
             while (isConversionSpecifier(formatString[end++]) == false && end < length)
                 ;
-            char dataFormat[maxPrintfOutputLength];
 
-            memcpy_s(dataFormat, maxPrintfOutputLength, formatString + i, end - i);
-            dataFormat[end - i] = '\0';
+            addLiteral();
+            PrintfFormatToken token;
+            token.text.assign(formatString + i, end - i);
+            token.isConversion = true;
+            token.isStringConversion = formatString[end - 1] == 's';
 
-            if (formatString[end - 1] == 's')
-                cursor += printStringToken(output + cursor, maxPrintfOutputLength - cursor, dataFormat);
-            else
-                cursor += printToken(output + cursor, maxPrintfOutputLength - cursor, dataFormat);
+            char vectorElementFormat[maxPrintfOutputLength];
+            stripVectorFormat(token.text.c_str(), vectorElementFormat);
+            stripVectorTypeConversion(vectorElementFormat);
+            token.vectorElementFormat = vectorElementFormat;
+            program.push_back(std::move(token));
 
             i = end - 1;
         } else {
-            output[cursor++] = formatString[i];
+            literal.push_back(formatString[i]);
         }
     }
+    addLiteral();
+
+    return program;
+}
 
-    print(output);
+const PrintfFormatProgram *PrintFormatter::queryFormatProgram(uint32_t index) {
+    if (formatPrograms != nullptr) {
+        auto program = formatPrograms->find(index);
+        if (program != formatPrograms->end()) {
+            return &program->second;
+        }
+    }
+
+    auto program = compiledFormatPrograms.find(index);
+    if (program != compiledFormatPrograms.end()) {
+        return &program->second;
+    }
+
+    const char *formatString = queryPrintfString(index);
+    if (formatString == nullptr) {
+        return nullptr;
+    }
+    return &compiledFormatPrograms.emplace(index, compileFormatString(formatString)).first->second;
+}
+
+void PrintFormatter::printProgram(const PrintfFormatProgram &program, char *output) {
+    // last character is kept for the terminator, tokens printing past it are truncated
+    const size_t maxCursor = maxPrintfOutputLength - 1;
+    size_t cursor = 0;
+    for (auto &token : program) {
+        if (!token.isConversion) {
+            auto length = std::min(token.text.size(), maxCursor - cursor);
+            memcpy_s(output + cursor, maxPrintfOutputLength - cursor, token.text.c_str(), length);
+            cursor += length;
+        } else if (token.isStringConversion) {
+            cursor = std::min(cursor + printStringToken(output + cursor, maxPrintfOutputLength - cursor, token.text.c_str()), maxCursor);
+        } else {
+            cursor = std::min(cursor + printToken(output + cursor, maxPrintfOutputLength - cursor, token), maxCursor);
+        }
+    }
+    output[cursor] = '\0';
 }
 
 void PrintFormatter::stripVectorFormat(const char *format, char *stripped) {
@@ -101,7 +168,8 @@ void PrintFormatter::stripVectorTypeConversion(char *format) {
     }
 }
 
-size_t PrintFormatter::printToken(char *output, size_t size, const char *formatString) {
+size_t PrintFormatter::printToken(char *output, size_t size, const PrintfFormatToken &token) {
+    auto formatString = token.text.c_str();
     PRINTF_DATA_TYPE type(PRINTF_DATA_TYPE::INVALID);
     read(&type);
 
@@ -121,17 +189,17 @@ size_t PrintFormatter::printToken(char *output, size_t size, const char *formatS
     case PRINTF_DATA_TYPE::DOUBLE:
         return typedPrintToken<double>(output, size, formatString);
     case PRINTF_DATA_TYPE::VECTOR_BYTE:
-        return typedPrintVectorToken<int8_t>(output, size, formatString);
+        return typedPrintVectorToken<int8_t>(output, size, token);
     case PRINTF_DATA_TYPE::VECTOR_SHORT:
-        return typedPrintVectorToken<int16_t>(output, size, formatString);
+        return typedPrintVectorToken<int16_t>(output, size, token);
     case PRINTF_DATA_TYPE::VECTOR_INT:
-        return typedPrintVectorToken<int>(output, size, formatString);
+        return typedPrintVectorToken<int>(output, size, token);
     case PRINTF_DATA_TYPE::VECTOR_LONG:
-        return typedPrintVectorToken<int64_t>(output, size, formatString);
+        return typedPrintVectorToken<int64_t>(output, size, token);
     case PRINTF_DATA_TYPE::VECTOR_FLOAT:
-        return typedPrintVectorToken<float>(output, size, formatString);
+        return typedPrintVectorToken<float>(output, size, token);
     case PRINTF_DATA_TYPE::VECTOR_DOUBLE:
-        return typedPrintVectorToken<double>(output, size, formatString);
+        return typedPrintVectorToken<double>(output, size, token);
     default:
         return 0;
     }
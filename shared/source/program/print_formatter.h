@@ -9,6 +9,7 @@
 
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/os_interface/print.h"
+#include "shared/source/program/printf_format_program.h"
 
 #include <algorithm>
 #include <cctype>
@@ -44,22 +45,27 @@ enum class PRINTF_DATA_TYPE : int {
 class PrintFormatter {
   public:
     PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t printfOutputBufferMaxSize,
-                   bool using32BitPointers, const StringMap &stringLiteralMap);
-    void printKernelOutput(const std::function<void(char *)> &print = [](char *str) { printToSTDOUT(str); });
+                   bool using32BitPointers, const StringMap &stringLiteralMap,
+                   const PrintfFormatProgramMap *formatPrograms = nullptr);
+    void printKernelOutput();
+    void printKernelOutput(const std::function<void(char *)> &print);
+
+    static PrintfFormatProgram compileFormatString(const char *formatString);
 
     static const size_t maxPrintfOutputLength = 1024;
 
   protected:
     const char *queryPrintfString(uint32_t index) const;
-    void printString(const char *formatString, const std::function<void(char *)> &print);
-    size_t printToken(char *output, size_t size, const char *formatString);
+    const PrintfFormatProgram *queryFormatProgram(uint32_t index);
+    void printProgram(const PrintfFormatProgram &program, char *output);
+    size_t printToken(char *output, size_t size, const PrintfFormatToken &token);
     size_t printStringToken(char *output, size_t size, const char *formatString);
     size_t printPointerToken(char *output, size_t size, const char *formatString);
 
-    char escapeChar(char escape);
-    bool isConversionSpecifier(char c);
-    void stripVectorFormat(const char *format, char *stripped);
-    void stripVectorTypeConversion(char *format);
+    static char escapeChar(char escape);
+    static bool isConversionSpecifier(char c);
+    static void stripVectorFormat(const char *format, char *stripped);
+    static void stripVectorTypeConversion(char *format);
 
     template <class T>
     bool read(T *value) {
@@ -86,22 +92,17 @@ class PrintFormatter {
     }
 
     template <class T>
-    size_t typedPrintVectorToken(char *output, size_t size, const char *formatString) {
+    size_t typedPrintVectorToken(char *output, size_t size, const PrintfFormatToken &token) {
         T value = {0};
         int valueCount = 0;
         read(&valueCount);
 
         size_t charactersPrinted = 0;
-        char strippedFormat[1024];
-
-        stripVectorFormat(formatString, strippedFormat);
-        stripVectorTypeConversion(strippedFormat);
-
         for (int i = 0; i < valueCount; i++) {
             read(&value);
-            charactersPrinted += simple_sprintf(output + charactersPrinted, size - charactersPrinted, strippedFormat, value);
+            charactersPrinted = std::min(charactersPrinted + simple_sprintf(output + charactersPrinted, size - charactersPrinted, token.vectorElementFormat.c_str(), value), size - 1);
             if (i < valueCount - 1) {
-                charactersPrinted += simple_sprintf(output + charactersPrinted, size - charactersPrinted, "%c", ',');
+                charactersPrinted = std::min(charactersPrinted + simple_sprintf(output + charactersPrinted, size - charactersPrinted, "%c", ','), size - 1);
             }
         }
 
@@ -116,6 +117,8 @@ class PrintFormatter {
     uint32_t printfOutputBufferSize = 0;         // size of the data contained in the buffer
 
     const StringMap &stringLiteralMap;
+    const PrintfFormatProgramMap *formatPrograms = nullptr; // compiled when kernel was loaded
+    PrintfFormatProgramMap compiledFormatPrograms;          // compiled on first use when not provided
     bool using32BitPointers = false;
 
     uint32_t currentOffset = 0; // current position in currently parsed buffer
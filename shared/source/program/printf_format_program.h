@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+
+// Printf format string split into literal text and conversion specifications when the kernel is loaded,
+// printing kernel output only walks the tokens instead of parsing the format string for every record.
+struct PrintfFormatToken {
+    std::string text;                // literal text with escapes resolved or conversion specification
+    std::string vectorElementFormat; // conversion specification applied to every element of a vector value
+    bool isConversion = false;
+    bool isStringConversion = false;
+};
+
+using PrintfFormatProgram = std::vector<PrintfFormatToken>;
+using PrintfFormatProgramMap = std::unordered_map<uint32_t, PrintfFormatProgram>;
+
+} // namespace NEO
@@ -9,6 +9,12 @@
 
 #include <emmintrin.h>
 
+#if defined(_WIN32)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
 namespace NEO {
 namespace CpuIntrinsics {
 
@@ -20,5 +26,9 @@ void pause() {
     _mm_pause();
 }
 
+uint64_t rdtsc() {
+    return __rdtsc();
+}
+
 } // namespace CpuIntrinsics
 } // namespace NEO
@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/enqueue_phase_profiler.h"
+
+#include "shared/source/helpers/file_io.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+
+namespace NEO {
+
+constexpr uint32_t EnqueuePhaseProfiler::phaseCount;
+constexpr uint32_t EnqueuePhaseProfiler::histogramBucketCount;
+constexpr const char *EnqueuePhaseProfiler::dumpFileName;
+constexpr const char *EnqueuePhaseProfiler::dumpRequestFileName;
+constexpr uint32_t EnqueuePhaseProfiler::dumpRequestPollIntervalMs;
+constexpr const char *EnqueuePhaseProfiler::noKernelName;
+
+namespace {
+struct ThreadDispatch {
+    const EnqueuePhaseProfiler *owner = nullptr;
+    uint32_t depth = 0u;
+    std::string kernelName;
+    std::array<uint64_t, EnqueuePhaseProfiler::phaseCount> phaseTicks = {};
+    std::array<bool, EnqueuePhaseProfiler::phaseCount> phaseRecorded = {};
+};
+
+thread_local ThreadDispatch threadDispatch;
+} // namespace
+
+void EnqueuePhaseProfiler::PhaseStatistics::add(uint64_t ticks) {
+    count++;
+    totalTicks += ticks;
+    minTicks = std::min(minTicks, ticks);
+    maxTicks = std::max(maxTicks, ticks);
+    histogram[getBucketIndex(ticks)]++;
+}
+
+uint64_t EnqueuePhaseProfiler::PhaseStatistics::getPercentileTicks(uint32_t percentile) const {
+    const uint64_t threshold = (count * percentile + 99u) / 100u;
+    uint64_t samples = 0u;
+    for (uint32_t bucket = 0u; bucket < histogramBucketCount; bucket++) {
+        samples += histogram[bucket];
+        if (samples >= threshold && samples > 0u) {
+            return bucket == 0u ? 0u : std::min(maxTicks, (static_cast<uint64_t>(1u) << bucket) - 1u);
+        }
+    }
+    return maxTicks;
+}
+
+EnqueuePhaseProfiler &EnqueuePhaseProfiler::getInstance() {
+    static EnqueuePhaseProfiler profiler(true);
+    return profiler;
+}
+
+const char *EnqueuePhaseProfiler::getPhaseName(EnqueuePhase phase) {
+    switch (phase) {
+    case EnqueuePhase::Enqueue:
+        return "Enqueue";
+    case EnqueuePhase::ProcessDispatchForKernels:
+        return "ProcessDispatchForKernels";
+    case EnqueuePhase::DispatchWalker:
+        return "DispatchWalker";
+    case EnqueuePhase::EnqueueNonBlocked:
+        return "EnqueueNonBlocked";
+    case EnqueuePhase::FlushTask:
+        return "FlushTask";
+    case EnqueuePhase::Residency:
+        return "Residency";
+    case EnqueuePhase::Flush:
+        return "Flush";
+    default:
+        return "Unknown";
+    }
+}
+
+uint32_t EnqueuePhaseProfiler::getBucketIndex(uint64_t ticks) {
+    uint32_t bucket = 0u;
+    while (ticks != 0u && bucket < histogramBucketCount - 1) {
+        ticks >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+EnqueuePhaseProfiler::EnqueuePhaseProfiler(bool dumpAtExit)
+    : creationTicks(CpuIntrinsics::rdtsc()), creationTime(std::chrono::steady_clock::now()), dumpAtExit(dumpAtExit),
+      lastRequestPollTime(creationTime) {
+}
+
+EnqueuePhaseProfiler::~EnqueuePhaseProfiler() {
+    if (dumpAtExit && dispatchCount > 0u) {
+        dumpToFile(profileFileName);
+    }
+}
+
+void EnqueuePhaseProfiler::beginDispatch(const char *kernelName) {
+    auto &dispatch = threadDispatch;
+    if (dispatch.depth++ > 0u) {
+        return;
+    }
+    dispatch.owner = this;
+    // Assigning keeps the capacity of the thread's string, steady state dispatches do not allocate.
+    dispatch.kernelName.assign((kernelName != nullptr && kernelName[0] != '\0') ? kernelName : noKernelName);
+    dispatch.phaseTicks.fill(0u);
+    dispatch.phaseRecorded.fill(false);
+}
+
+void EnqueuePhaseProfiler::record(EnqueuePhase phase, uint64_t ticks) {
+    auto phaseIndex = static_cast<uint32_t>(phase);
+    auto &dispatch = threadDispatch;
+    if (dispatch.depth > 0u && dispatch.owner == this) {
+        dispatch.phaseTicks[phaseIndex] += ticks;
+        dispatch.phaseRecorded[phaseIndex] = true;
+        return;
+    }
+
+    std::array<uint64_t, phaseCount> phaseTicks = {};
+    std::array<bool, phaseCount> phaseRecorded = {};
+    phaseTicks[phaseIndex] = ticks;
+    phaseRecorded[phaseIndex] = true;
+    commit(noKernelName, phaseTicks, phaseRecorded);
+}
+
+void EnqueuePhaseProfiler::endDispatch() {
+    auto &dispatch = threadDispatch;
+    if (dispatch.depth == 0u || --dispatch.depth > 0u || dispatch.owner != this) {
+        return;
+    }
+    dispatch.owner = nullptr;
+    commit(dispatch.kernelName, dispatch.phaseTicks, dispatch.phaseRecorded);
+}
+
+void EnqueuePhaseProfiler::commit(const std::string &kernelName, const std::array<uint64_t, phaseCount> &phaseTicks, const std::array<bool, phaseCount> &phaseRecorded) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto &kernel = kernelStatistics[kernelName];
+    for (uint32_t phase = 0u; phase < phaseCount; phase++) {
+        if (phaseRecorded[phase]) {
+            statistics[phase].add(phaseTicks[phase]);
+            kernel[phase].add(phaseTicks[phase]);
+        }
+    }
+    dispatchCount++;
+
+    bool dumpNow = dumpRequested.exchange(false);
+    auto dumpInterval = DebugManager.flags.EnqueuePhaseProfilerDumpInterval.get();
+    if (dumpInterval > 0 && dispatchCount % static_cast<uint64_t>(dumpInterval) == 0u) {
+        dumpNow = true;
+    }
+
+    // File system is touched rarely and by one thread at a time, so that it does not distort measured phases.
+    bool pollRequestFile = false;
+    auto now = std::chrono::steady_clock::now();
+    if (now - lastRequestPollTime >= std::chrono::milliseconds(dumpRequestPollIntervalMs)) {
+        lastRequestPollTime = now;
+        pollRequestFile = true;
+    }
+    lock.unlock();
+
+    if (pollRequestFile && fileExists(requestFileName)) {
+        std::remove(requestFileName.c_str());
+        dumpNow = true;
+    }
+    if (dumpNow) {
+        dumpToFile(profileFileName);
+    }
+}
+
+uint64_t EnqueuePhaseProfiler::getDispatchCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return dispatchCount;
+}
+
+EnqueuePhaseProfiler::Statistics EnqueuePhaseProfiler::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return statistics;
+}
+
+bool EnqueuePhaseProfiler::getKernelStatistics(const std::string &kernelName, Statistics &statisticsOut) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto kernel = kernelStatistics.find(kernelName);
+    if (kernel == kernelStatistics.end()) {
+        return false;
+    }
+    statisticsOut = kernel->second;
+    return true;
+}
+
+double EnqueuePhaseProfiler::getTicksPerMicrosecond() const {
+    // Counter frequency is derived from the whole profiling period, no calibration delay at startup.
+    auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - creationTime).count();
+    auto elapsedTicks = CpuIntrinsics::rdtsc() - creationTicks;
+    if (elapsedUs <= 0 || elapsedTicks == 0u) {
+        return 1.0;
+    }
+    return static_cast<double>(elapsedTicks) / static_cast<double>(elapsedUs);
+}
+
+void EnqueuePhaseProfiler::dumpStatistics(std::ostream &out, const Statistics &phaseStatistics, double ticksPerMicrosecond) const {
+    out << std::left << std::setw(28) << "phase" << std::right
+        << std::setw(12) << "count" << std::setw(14) << "total[us]" << std::setw(12) << "mean[us]"
+        << std::setw(12) << "min[us]" << std::setw(12) << "p50[us]" << std::setw(12) << "p90[us]"
+        << std::setw(12) << "p99[us]" << std::setw(12) << "max[us]" << "\n";
+
+    for (uint32_t phase = 0u; phase < phaseCount; phase++) {
+        const auto &phaseStatistic = phaseStatistics[phase];
+        if (phaseStatistic.count == 0u) {
+            continue;
+        }
+        auto toUs = [ticksPerMicrosecond](uint64_t ticks) { return static_cast<double>(ticks) / ticksPerMicrosecond; };
+        out << std::left << std::setw(28) << getPhaseName(static_cast<EnqueuePhase>(phase)) << std::right
+            << std::setw(12) << phaseStatistic.count
+            << std::setw(14) << toUs(phaseStatistic.totalTicks)
+            << std::setw(12) << toUs(phaseStatistic.totalTicks) / static_cast<double>(phaseStatistic.count)
+            << std::setw(12) << toUs(phaseStatistic.minTicks)
+            << std::setw(12) << toUs(phaseStatistic.getPercentileTicks(50))
+            << std::setw(12) << toUs(phaseStatistic.getPercentileTicks(90))
+            << std::setw(12) << toUs(phaseStatistic.getPercentileTicks(99))
+            << std::setw(12) << toUs(phaseStatistic.maxTicks) << "\n";
+    }
+}
+
+void EnqueuePhaseProfiler::dump(std::ostream &out) const {
+    auto ticksPerMicrosecond = getTicksPerMicrosecond();
+    std::lock_guard<std::mutex> lock(mtx);
+
+    out << std::fixed << std::setprecision(3);
+    out << "Enqueue phase profile: " << dispatchCount << " dispatches, " << ticksPerMicrosecond << " ticks per us\n\n";
+    out << "All kernels\n";
+    dumpStatistics(out, statistics, ticksPerMicrosecond);
+
+    for (auto &kernel : kernelStatistics) {
+        out << "\nKernel " << kernel.first << "\n";
+        dumpStatistics(out, kernel.second, ticksPerMicrosecond);
+    }
+}
+
+bool EnqueuePhaseProfiler::dumpToFile(const std::string &fileName) const {
+    // Dumps from concurrent dispatches are written one at a time and replace the whole file,
+    // so that the profile can be read while the process is running.
+    std::lock_guard<std::mutex> lock(dumpMtx);
+    auto temporaryFileName = fileName + ".tmp";
+    {
+        std::ofstream file(temporaryFileName, std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        dump(file);
+        if (!file.good()) {
+            file.close();
+            std::remove(temporaryFileName.c_str());
+            return false;
+        }
+    }
+
+    if (std::rename(temporaryFileName.c_str(), fileName.c_str()) != 0) {
+        // Renaming onto an existing file fails on Windows.
+        std::remove(fileName.c_str());
+        if (std::rename(temporaryFileName.c_str(), fileName.c_str()) != 0) {
+            std::remove(temporaryFileName.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+void EnqueuePhaseProfiler::requestDump() {
+    dumpRequested = true;
+}
+
+void EnqueuePhaseProfiler::reset() {
+    std::lock_guard<std::mutex> lock(mtx);
+    dispatchCount = 0u;
+    statistics = {};
+    kernelStatistics.clear();
+}
+
+} // namespace NEO
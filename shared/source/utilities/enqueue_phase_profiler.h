@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+namespace NEO {
+
+enum class EnqueuePhase : uint32_t {
+    Enqueue = 0,
+    ProcessDispatchForKernels,
+    DispatchWalker,
+    EnqueueNonBlocked,
+    FlushTask,
+    Residency,
+    Flush,
+    Count
+};
+
+// Collects host CPU time spent in phases of the enqueue path, measured with the time stamp counter.
+// Phase times are summed per dispatch on the calling thread and added to per phase and per kernel
+// histograms once the outermost dispatch scope ends. Phases outside of a dispatch scope are
+// recorded as separate dispatches without kernel name.
+class EnqueuePhaseProfiler : NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t phaseCount = static_cast<uint32_t>(EnqueuePhase::Count);
+    static constexpr uint32_t histogramBucketCount = 48u;
+    static constexpr const char *dumpFileName = "EnqueuePhaseProfile.log";
+    // Creating this file requests a dump from a running process, it is checked at most every poll interval.
+    static constexpr const char *dumpRequestFileName = "EnqueuePhaseProfile.request";
+    static constexpr uint32_t dumpRequestPollIntervalMs = 500u;
+    static constexpr const char *noKernelName = "<no kernel>";
+
+    // Bucket n counts samples of [2^(n-1), 2^n) ticks, bucket 0 counts samples of 0 ticks.
+    struct PhaseStatistics {
+        uint64_t count = 0u;
+        uint64_t totalTicks = 0u;
+        uint64_t minTicks = std::numeric_limits<uint64_t>::max();
+        uint64_t maxTicks = 0u;
+        std::array<uint64_t, histogramBucketCount> histogram = {};
+
+        void add(uint64_t ticks);
+        // Upper bound of the bucket holding the given percentile.
+        uint64_t getPercentileTicks(uint32_t percentile) const;
+    };
+    using Statistics = std::array<PhaseStatistics, phaseCount>;
+
+    static bool isEnabled() {
+        return DebugManager.flags.EnableEnqueuePhaseProfiler.get() == 1;
+    }
+    static EnqueuePhaseProfiler &getInstance();
+    static const char *getPhaseName(EnqueuePhase phase);
+    static uint32_t getBucketIndex(uint64_t ticks);
+
+    EnqueuePhaseProfiler(bool dumpAtExit = false);
+    ~EnqueuePhaseProfiler();
+
+    void beginDispatch(const char *kernelName);
+    void record(EnqueuePhase phase, uint64_t ticks);
+    void endDispatch();
+
+    uint64_t getDispatchCount() const;
+    Statistics getStatistics() const;
+    bool getKernelStatistics(const std::string &kernelName, Statistics &statistics) const;
+    double getTicksPerMicrosecond() const;
+
+    void dump(std::ostream &out) const;
+    bool dumpToFile(const std::string &fileName) const;
+    // Profile is dumped to file when the next dispatch is committed.
+    void requestDump();
+    void reset();
+
+    class ScopedDispatch : NonCopyableOrMovableClass {
+      public:
+        ScopedDispatch(const char *kernelName) : active(isEnabled()) {
+            if (active) {
+                EnqueuePhaseProfiler::getInstance().beginDispatch(kernelName);
+            }
+        }
+        ~ScopedDispatch() {
+            if (active) {
+                EnqueuePhaseProfiler::getInstance().endDispatch();
+            }
+        }
+
+      protected:
+        const bool active;
+    };
+
+    class ScopedPhase : NonCopyableOrMovableClass {
+      public:
+        ScopedPhase(EnqueuePhase phase) : phase(phase), active(isEnabled()) {
+            if (active) {
+                startTicks = CpuIntrinsics::rdtsc();
+            }
+        }
+        ~ScopedPhase() {
+            if (active) {
+                EnqueuePhaseProfiler::getInstance().record(phase, CpuIntrinsics::rdtsc() - startTicks);
+            }
+        }
+
+      protected:
+        const EnqueuePhase phase;
+        const bool active;
+        uint64_t startTicks = 0u;
+    };
+
+  protected:
+    void commit(const std::string &kernelName, const std::array<uint64_t, phaseCount> &phaseTicks, const std::array<bool, phaseCount> &phaseRecorded);
+    void dumpStatistics(std::ostream &out, const Statistics &statistics, double ticksPerMicrosecond) const;
+
+    const uint64_t creationTicks;
+    const std::chrono::steady_clock::time_point creationTime;
+    const bool dumpAtExit;
+    std::string profileFileName = dumpFileName;
+    std::string requestFileName = dumpRequestFileName;
+
+    mutable std::mutex dumpMtx;
+    std::atomic<bool> dumpRequested{false};
+
+    mutable std::mutex mtx;
+    std::chrono::steady_clock::time_point lastRequestPollTime;
+    uint64_t dispatchCount = 0u;
+    Statistics statistics;
+    std::unordered_map<std::string, Statistics> kernelStatistics;
+};
+
+} // namespace NEO
+
+// Scoped timers are compiled in only with ENQUEUE_PHASE_PROFILING=1, then EnableEnqueuePhaseProfiler turns them on.
+#define ENQUEUE_PHASE_DISPATCH(kernelName)
+#define ENQUEUE_PHASE(phase)
+
+#if ENQUEUE_PHASE_PROFILING == 1
+#undef ENQUEUE_PHASE_DISPATCH
+#undef ENQUEUE_PHASE
+
+#define ENQUEUE_PHASE_DISPATCH(kernelName) \
+    NEO::EnqueuePhaseProfiler::ScopedDispatch enqueuePhaseDispatchScope(kernelName)
+#define ENQUEUE_PHASE(phase) \
+    NEO::EnqueuePhaseProfiler::ScopedPhase enqueuePhaseScope##phase(NEO::EnqueuePhase::phase)
+#endif
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_for.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+void parallelFor(size_t count, uint32_t maxThreads, const std::function<void(size_t index)> &task) {
+    auto threadCount = static_cast<size_t>(std::max(maxThreads, 1u));
+    threadCount = std::min(threadCount, count);
+    if (threadCount <= 1u) {
+        for (size_t index = 0; index < count; index++) {
+            task(index);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextIndex(0u);
+    std::vector<std::exception_ptr> exceptions(count);
+
+    auto worker = [&]() {
+        for (auto index = nextIndex++; index < count; index = nextIndex++) {
+            try {
+                task(index);
+            } catch (...) {
+                exceptions[index] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (size_t thread = 1; thread < threadCount; thread++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (auto &exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
+uint32_t getKernelInitializationThreadCount(size_t kernelCount) {
+    auto threadCount = DebugManager.flags.KernelInitializationThreadCount.get();
+    if (threadCount == 0) {
+        threadCount = static_cast<int32_t>(std::thread::hardware_concurrency());
+    }
+    if (threadCount <= 1 || kernelCount <= 1u) {
+        return 1u;
+    }
+    return static_cast<uint32_t>(std::min(static_cast<size_t>(threadCount), kernelCount));
+}
+
+} // namespace NEO
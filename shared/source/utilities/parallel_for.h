@@ -0,0 +1,23 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace NEO {
+
+// Calls task once for every index in [0, count) on at most maxThreads threads, calling thread included.
+// Tasks must only write state owned by their index, so the result does not depend on scheduling.
+// When tasks throw, all remaining indices still run and the exception of the lowest failing index is rethrown.
+void parallelFor(size_t count, uint32_t maxThreads, const std::function<void(size_t index)> &task);
+
+// Number of threads used to initialize kernels of a program or module, 1 means serial initialization.
+uint32_t getKernelInitializationThreadCount(size_t kernelCount);
+
+} // namespace NEO
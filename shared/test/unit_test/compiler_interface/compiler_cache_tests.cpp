@@ -7,10 +7,12 @@
 
 #include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
+#include "shared/source/compiler_interface/in_memory_compiler_cache.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/string.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 
 #include "opencl/source/compiler_interface/default_cl_cache_config.h"
 #include "opencl/test/unit_test/global_environment.h"
@@ -20,8 +22,10 @@
 #include "test.h"
 
 #include <array>
+#include <atomic>
 #include <list>
 #include <memory>
+#include <thread>
 
 using namespace NEO;
 
@@ -368,3 +372,151 @@ TEST(CompilerInterfaceCachedTests, givenKernelWithIncludesAndBinaryInCacheWhenCo
 
     gEnvironment->fclPopDebugVars();
 }
+
+TEST(InMemoryCompilerCacheTests, givenNotCachedKeyWhenAcquiringThenCallerBecomesBuilderAndStoredBinaryIsReturnedToNextCaller) {
+    InMemoryCompilerCache inMemoryCache(InMemoryCompilerCache::defaultMaxCachedSize);
+    size_t binarySize = 0u;
+    EXPECT_EQ(nullptr, inMemoryCache.acquire("hash", binarySize));
+
+    const char binary[] = "binary";
+    inMemoryCache.store("hash", binary, sizeof(binary));
+    EXPECT_EQ(1u, inMemoryCache.getCachedEntriesCount());
+    EXPECT_EQ(sizeof(binary), inMemoryCache.getCachedSize());
+
+    auto cachedBinary = inMemoryCache.acquire("hash", binarySize);
+    ASSERT_NE(nullptr, cachedBinary);
+    EXPECT_EQ(sizeof(binary), binarySize);
+    EXPECT_EQ(0, memcmp(binary, cachedBinary.get(), binarySize));
+    EXPECT_EQ(1u, inMemoryCache.getHitsCount());
+    EXPECT_EQ(0u, inMemoryCache.getCoalescedRequestsCount());
+}
+
+TEST(InMemoryCompilerCacheTests, givenAbandonedBuildWhenAcquiringAgainThenNextCallerBecomesBuilder) {
+    InMemoryCompilerCache inMemoryCache(InMemoryCompilerCache::defaultMaxCachedSize);
+    size_t binarySize = 0u;
+    EXPECT_EQ(nullptr, inMemoryCache.acquire("hash", binarySize));
+    inMemoryCache.abandon("hash");
+    EXPECT_EQ(nullptr, inMemoryCache.acquire("hash", binarySize));
+    EXPECT_EQ(0u, inMemoryCache.getCachedEntriesCount());
+    EXPECT_EQ(0u, inMemoryCache.getHitsCount());
+}
+
+TEST(InMemoryCompilerCacheTests, givenCachedSizeAboveLimitWhenStoringThenOldestEntriesAreEvicted) {
+    const char binary[16] = {};
+    InMemoryCompilerCache inMemoryCache(2 * sizeof(binary));
+    size_t binarySize = 0u;
+    for (auto hash : {"a", "b", "c"}) {
+        EXPECT_EQ(nullptr, inMemoryCache.acquire(hash, binarySize));
+        inMemoryCache.store(hash, binary, sizeof(binary));
+    }
+    EXPECT_EQ(2u, inMemoryCache.getCachedEntriesCount());
+    EXPECT_EQ(2 * sizeof(binary), inMemoryCache.getCachedSize());
+
+    EXPECT_NE(nullptr, inMemoryCache.acquire("c", binarySize));
+    EXPECT_NE(nullptr, inMemoryCache.acquire("b", binarySize));
+    EXPECT_EQ(nullptr, inMemoryCache.acquire("a", binarySize));
+    inMemoryCache.abandon("a");
+}
+
+struct MockInMemoryCompilerCache : public InMemoryCompilerCache {
+    using InMemoryCompilerCache::entries;
+    using InMemoryCompilerCache::InMemoryCompilerCache;
+    using InMemoryCompilerCache::storeOrder;
+};
+
+TEST(InMemoryCompilerCacheTests, givenKeyStoredTwiceWhenCachedSizeExceedsLimitThenKeyIsEvictedAsNewestEntry) {
+    const char binary[16] = {};
+    MockInMemoryCompilerCache inMemoryCache(2 * sizeof(binary));
+    size_t binarySize = 0u;
+    for (auto hash : {"a", "b"}) {
+        EXPECT_EQ(nullptr, inMemoryCache.acquire(hash, binarySize));
+        inMemoryCache.store(hash, binary, sizeof(binary));
+    }
+
+    inMemoryCache.entries["a"]->inFlight = true;
+    inMemoryCache.store("a", binary, sizeof(binary));
+    EXPECT_EQ(2u, inMemoryCache.getCachedEntriesCount());
+    EXPECT_EQ(2 * sizeof(binary), inMemoryCache.getCachedSize());
+    ASSERT_EQ(2u, inMemoryCache.storeOrder.size());
+    EXPECT_EQ("b", inMemoryCache.storeOrder[0]);
+    EXPECT_EQ("a", inMemoryCache.storeOrder[1]);
+
+    EXPECT_EQ(nullptr, inMemoryCache.acquire("c", binarySize));
+    inMemoryCache.store("c", binary, sizeof(binary));
+    EXPECT_EQ(2u, inMemoryCache.getCachedEntriesCount());
+    EXPECT_EQ(2 * sizeof(binary), inMemoryCache.getCachedSize());
+    EXPECT_NE(nullptr, inMemoryCache.acquire("a", binarySize));
+    EXPECT_NE(nullptr, inMemoryCache.acquire("c", binarySize));
+    EXPECT_EQ(nullptr, inMemoryCache.acquire("b", binarySize));
+    inMemoryCache.abandon("b");
+}
+
+TEST(InMemoryCompilerCacheTests, givenBuildInFlightWhenOtherThreadsAcquireSameKeyThenTheyWaitForStoredBinary) {
+    InMemoryCompilerCache inMemoryCache(InMemoryCompilerCache::defaultMaxCachedSize);
+    size_t binarySize = 0u;
+    EXPECT_EQ(nullptr, inMemoryCache.acquire("hash", binarySize));
+
+    constexpr size_t numThreads = 4u;
+    std::atomic<size_t> binariesReceived{0u};
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numThreads; i++) {
+        threads.push_back(std::thread([&] {
+            size_t size = 0u;
+            if (inMemoryCache.acquire("hash", size) != nullptr) {
+                binariesReceived++;
+            }
+        }));
+    }
+    while (inMemoryCache.getCoalescedRequestsCount() < numThreads) {
+        std::this_thread::yield();
+    }
+
+    const char binary[] = "binary";
+    inMemoryCache.store("hash", binary, sizeof(binary));
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(numThreads, binariesReceived);
+    EXPECT_EQ(numThreads, inMemoryCache.getHitsCount());
+}
+
+TEST(CompilerInterfaceCachedTests, givenInMemoryCompilerCacheEnabledWhenBuildingSameSourceTwiceThenSecondBuildIsServedFromMemory) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableInMemoryCompilerCache.set(1);
+
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+    auto src = "__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.allowCaching = true;
+
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::make_unique<CompilerCacheMock>(), true));
+    MockDevice device;
+    TranslationOutput firstOutput;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->build(device, inputArgs, firstOutput));
+
+    gEnvironment->fclPopDebugVars();
+    gEnvironment->igcPopDebugVars();
+
+    // disk cache misses and both compilers fail, so success means the binary came from memory
+    fclDebugVars.forceBuildFailure = true;
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+    igcDebugVars.forceBuildFailure = true;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    TranslationOutput secondOutput;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->build(device, inputArgs, secondOutput));
+    ASSERT_NE(nullptr, secondOutput.deviceBinary.mem);
+    EXPECT_EQ(firstOutput.deviceBinary.size, secondOutput.deviceBinary.size);
+    EXPECT_EQ(0, memcmp(firstOutput.deviceBinary.mem.get(), secondOutput.deviceBinary.mem.get(), secondOutput.deviceBinary.size));
+
+    gEnvironment->fclPopDebugVars();
+    gEnvironment->igcPopDebugVars();
+}
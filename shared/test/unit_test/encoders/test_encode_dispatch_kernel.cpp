@@ -12,6 +12,7 @@
 #include "shared/test/unit_test/cmd_parse/gen_cmd_parse.h"
 #include "shared/test/unit_test/device_binary_format/patchtokens_tests.h"
 #include "shared/test/unit_test/fixtures/command_container_fixture.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
 #include "shared/test/unit_test/mocks/mock_dispatch_kernel_encoder_interface.h"
 
 #include "opencl/source/helpers/hardware_commands_helper.h"
@@ -47,6 +48,142 @@ HWTEST_F(CommandEncodeStatesTest, givenenDispatchInterfaceWhenDispatchKernelThen
     ASSERT_NE(itorPC, commands.end());
 }
 
+HWTEST_F(CommandEncodeStatesTest, givenPatchInfoWhenDispatchKernelThenPatchDispatchUpdatesWalkerAndIndirectDataInPlace) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    EncodeDispatchKernelPatchInfo patchInfo;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, pDevice, NEO::PreemptionMode::Disabled, &patchInfo);
+
+    ASSERT_NE(nullptr, patchInfo.walkerCmd);
+    ASSERT_NE(nullptr, patchInfo.interfaceDescriptor);
+    ASSERT_NE(nullptr, patchInfo.indirectData);
+    EXPECT_EQ(MockDispatchKernelEncoder::crossThreadSize, patchInfo.crossThreadDataSize);
+    EXPECT_LE(patchInfo.crossThreadDataSize, patchInfo.indirectDataSize);
+
+    auto usedSpace = cmdContainer->getCommandStream()->getUsed();
+    dispatchInterface->dataCrossThread[0] = 0xAB;
+    uint32_t newDims[] = {7, 3, 2};
+    EXPECT_TRUE(EncodeDispatchKernel<FamilyType>::patchDispatch(patchInfo, newDims, dispatchInterface.get()));
+    EXPECT_EQ(usedSpace, cmdContainer->getCommandStream()->getUsed());
+
+    auto walker = reinterpret_cast<WALKER_TYPE *>(patchInfo.walkerCmd);
+    EXPECT_EQ(7u, walker->getThreadGroupIdXDimension());
+    EXPECT_EQ(3u, walker->getThreadGroupIdYDimension());
+    EXPECT_EQ(2u, walker->getThreadGroupIdZDimension());
+    EXPECT_EQ(0xAB, reinterpret_cast<uint8_t *>(patchInfo.indirectData)[0]);
+}
+
+HWTEST_F(CommandEncodeStatesTest, givenDispatchWhichDoesNotFitIntoEncodedOneWhenPatchDispatchThenFalseIsReturned) {
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    EncodeDispatchKernelPatchInfo patchInfo;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, pDevice, NEO::PreemptionMode::Disabled, &patchInfo);
+
+    EXPECT_FALSE(EncodeDispatchKernel<FamilyType>::patchDispatch(EncodeDispatchKernelPatchInfo{}, dims, dispatchInterface.get()));
+    EXPECT_FALSE(EncodeDispatchKernel<FamilyType>::patchDispatch(patchInfo, nullptr, dispatchInterface.get()));
+
+    EXPECT_CALL(*dispatchInterface.get(), getPerThreadDataSizeForWholeThreadGroup()).WillRepeatedly(::testing::Return(patchInfo.indirectDataSize));
+    EXPECT_FALSE(EncodeDispatchKernel<FamilyType>::patchDispatch(patchInfo, dims, dispatchInterface.get()));
+    EXPECT_CALL(*dispatchInterface.get(), getPerThreadDataSizeForWholeThreadGroup()).WillRepeatedly(::testing::Return(0u));
+
+    EXPECT_CALL(*dispatchInterface.get(), getSlmTotalSize()).WillRepeatedly(::testing::Return(patchInfo.slmTotalSize + 1));
+    EXPECT_FALSE(EncodeDispatchKernel<FamilyType>::patchDispatch(patchInfo, dims, dispatchInterface.get()));
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, CommandEncodeStatesTest, givenDispatchStateReuseEnabledWhenIdenticalDispatchIsEncodedThenHeapBlocksOfPreviousDispatchAreReused) {
+    using BINDING_TABLE_STATE = typename FamilyType::BINDING_TABLE_STATE;
+    using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableDispatchStateReuse.set(1);
+
+    BINDING_TABLE_STATE bindingTableState;
+    bindingTableState.sInit();
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    memset(dispatchInterface->dataCrossThread, 0, sizeof(dispatchInterface->dataCrossThread));
+    memset(dispatchInterface->dataPerThread, 0, sizeof(dispatchInterface->dataPerThread));
+    dispatchInterface->kernelDescriptor.payloadMappings.bindingTable.numEntries = 1;
+    dispatchInterface->kernelDescriptor.payloadMappings.bindingTable.tableOffset = 0U;
+    EXPECT_CALL(*dispatchInterface.get(), getSurfaceStateHeapData()).WillRepeatedly(::testing::Return(reinterpret_cast<uint8_t *>(&bindingTableState)));
+    EXPECT_CALL(*dispatchInterface.get(), getSurfaceStateHeapDataSize()).WillRepeatedly(::testing::Return(static_cast<uint32_t>(sizeof(BINDING_TABLE_STATE))));
+    EXPECT_CALL(*dispatchInterface.get(), getPerThreadDataSizeForWholeThreadGroup()).WillRepeatedly(::testing::Return(MockDispatchKernelEncoder::perThreadSize));
+
+    EncodeDispatchKernelPatchInfo firstPatchInfo;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, pDevice, NEO::PreemptionMode::Disabled, &firstPatchInfo);
+    EXPECT_FALSE(firstPatchInfo.stateShared);
+
+    auto sshUsed = cmdContainer->getIndirectHeap(HeapType::SURFACE_STATE)->getUsed();
+    auto iohUsed = cmdContainer->getIndirectHeap(HeapType::INDIRECT_OBJECT)->getUsed();
+    auto nextIddInBlock = cmdContainer->nextIddInBlock;
+
+    EncodeDispatchKernelPatchInfo secondPatchInfo;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, pDevice, NEO::PreemptionMode::Disabled, &secondPatchInfo);
+
+    EXPECT_EQ(sshUsed, cmdContainer->getIndirectHeap(HeapType::SURFACE_STATE)->getUsed());
+    EXPECT_EQ(iohUsed, cmdContainer->getIndirectHeap(HeapType::INDIRECT_OBJECT)->getUsed());
+    EXPECT_EQ(nextIddInBlock, cmdContainer->nextIddInBlock);
+    EXPECT_TRUE(secondPatchInfo.stateShared);
+    EXPECT_EQ(firstPatchInfo.indirectData, secondPatchInfo.indirectData);
+    EXPECT_EQ(firstPatchInfo.interfaceDescriptor, secondPatchInfo.interfaceDescriptor);
+    EXPECT_EQ(firstPatchInfo.surfaceStates, secondPatchInfo.surfaceStates);
+
+    auto firstWalker = reinterpret_cast<WALKER_TYPE *>(firstPatchInfo.walkerCmd);
+    auto secondWalker = reinterpret_cast<WALKER_TYPE *>(secondPatchInfo.walkerCmd);
+    EXPECT_EQ(firstWalker->getIndirectDataStartAddress(), secondWalker->getIndirectDataStartAddress());
+    EXPECT_EQ(firstWalker->getInterfaceDescriptorOffset(), secondWalker->getInterfaceDescriptorOffset());
+
+    auto &counters = cmdContainer->getDispatchStateCache().getCounters();
+    EXPECT_EQ(1u, counters.reusedSurfaceStates);
+    EXPECT_EQ(1u, counters.reusedIndirectData);
+    EXPECT_EQ(1u, counters.reusedInterfaceDescriptors);
+    EXPECT_EQ(sizeof(BINDING_TABLE_STATE), counters.savedSurfaceStateHeapSize);
+    EXPECT_EQ(MockDispatchKernelEncoder::crossThreadSize + MockDispatchKernelEncoder::perThreadSize, counters.savedIndirectObjectHeapSize);
+    EXPECT_EQ(sizeof(INTERFACE_DESCRIPTOR_DATA), counters.savedDynamicStateHeapSize);
+
+    EXPECT_FALSE(EncodeDispatchKernel<FamilyType>::patchDispatch(secondPatchInfo, dims, dispatchInterface.get()));
+}
+
+HWTEST_F(CommandEncodeStatesTest, givenDispatchStateReuseEnabledWhenCrossThreadDataChangesThenNewIndirectDataIsWritten) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableDispatchStateReuse.set(1);
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    memset(dispatchInterface->dataCrossThread, 0, sizeof(dispatchInterface->dataCrossThread));
+
+    EncodeDispatchKernelPatchInfo firstPatchInfo;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, pDevice, NEO::PreemptionMode::Disabled, &firstPatchInfo);
+
+    dispatchInterface->dataCrossThread[0] = 1;
+    EncodeDispatchKernelPatchInfo secondPatchInfo;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, pDevice, NEO::PreemptionMode::Disabled, &secondPatchInfo);
+
+    EXPECT_NE(firstPatchInfo.indirectData, secondPatchInfo.indirectData);
+    EXPECT_EQ(1u, reinterpret_cast<uint8_t *>(secondPatchInfo.indirectData)[0]);
+    EXPECT_EQ(0u, cmdContainer->getDispatchStateCache().getCounters().reusedIndirectData);
+}
+
+HWTEST_F(CommandEncodeStatesTest, givenDispatchStateReuseDisabledOrCommandContainerResetWhenIdenticalDispatchIsEncodedThenNothingIsReused) {
+    DebugManagerStateRestore restorer;
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+
+    EncodeDispatchKernelPatchInfo firstPatchInfo;
+    EncodeDispatchKernelPatchInfo secondPatchInfo;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, pDevice, NEO::PreemptionMode::Disabled, &firstPatchInfo);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, pDevice, NEO::PreemptionMode::Disabled, &secondPatchInfo);
+    EXPECT_NE(firstPatchInfo.indirectData, secondPatchInfo.indirectData);
+    EXPECT_FALSE(secondPatchInfo.stateShared);
+
+    DebugManager.flags.EnableDispatchStateReuse.set(1);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, pDevice, NEO::PreemptionMode::Disabled, &firstPatchInfo);
+    cmdContainer->reset();
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, pDevice, NEO::PreemptionMode::Disabled, &secondPatchInfo);
+    EXPECT_FALSE(secondPatchInfo.stateShared);
+    EXPECT_EQ(0u, cmdContainer->getDispatchStateCache().getCounters().reusedIndirectData);
+}
+
 HWTEST_F(CommandEncodeStatesTest, givenCommandContainerWithUsedAvailableSizeWhenDispatchKernelThenNextCommandBufferIsAdded) {
     uint32_t dims[] = {2, 1, 1};
     std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
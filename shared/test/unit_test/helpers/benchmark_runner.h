@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+
+struct BenchmarkResult {
+    std::string name;
+    uint32_t threadCount = 0u;
+    uint32_t iterations = 0u;
+    uint32_t repetitions = 0u;
+    double medianNsPerOperation = 0.0;
+    double minNsPerOperation = 0.0;
+    double maxNsPerOperation = 0.0;
+    // Named values other than time reported by the benchmark, e.g. reuse counters of the measured operation.
+    std::vector<std::pair<std::string, double>> metrics;
+};
+
+// Collects results of all benchmarks run by the process, written as json once all tests finish.
+class BenchmarkResults {
+  public:
+    static constexpr const char *defaultOutputFileName = "benchmark_results.json";
+
+    static BenchmarkResults &getInstance() {
+        static BenchmarkResults results;
+        return results;
+    }
+
+    static std::string getOutputFileName() {
+        auto fileName = std::getenv("NEO_BENCHMARK_OUTPUT");
+        return std::string(fileName != nullptr ? fileName : defaultOutputFileName);
+    }
+
+    static void writeString(std::ostream &out, const std::string &value) {
+        out << "\"";
+        for (auto character : value) {
+            if (character == '"' || character == '\\') {
+                out << "\\" << character;
+            } else if (static_cast<unsigned char>(character) < 0x20) {
+                out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(character) << std::dec << std::setfill(' ');
+            } else {
+                out << character;
+            }
+        }
+        out << "\"";
+    }
+
+    void add(const BenchmarkResult &result) {
+        std::lock_guard<std::mutex> lock(mtx);
+        results.push_back(result);
+    }
+
+    // Attaches metric to the most recently added result, benchmarks call it right after BenchmarkRunner::run.
+    void addMetric(const std::string &metricName, double value) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!results.empty()) {
+            results.back().metrics.emplace_back(metricName, value);
+        }
+    }
+
+    std::vector<BenchmarkResult> get() {
+        std::lock_guard<std::mutex> lock(mtx);
+        return results;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mtx);
+        results.clear();
+    }
+
+    void writeJson(std::ostream &out) {
+        std::lock_guard<std::mutex> lock(mtx);
+        out << std::fixed << std::setprecision(1);
+        out << "{\n  \"benchmarks\": [";
+        for (size_t i = 0; i < results.size(); i++) {
+            auto &result = results[i];
+            out << (i == 0 ? "\n" : ",\n") << "    {\"name\": ";
+            writeString(out, result.name);
+            out << ", \"threads\": " << result.threadCount
+                << ", \"iterations\": " << result.iterations
+                << ", \"repetitions\": " << result.repetitions
+                << ", \"ns_per_op\": {\"median\": " << result.medianNsPerOperation
+                << ", \"min\": " << result.minNsPerOperation
+                << ", \"max\": " << result.maxNsPerOperation << "}";
+            if (!result.metrics.empty()) {
+                out << ", \"metrics\": {";
+                for (size_t metric = 0; metric < result.metrics.size(); metric++) {
+                    out << (metric == 0 ? "" : ", ");
+                    writeString(out, result.metrics[metric].first);
+                    out << ": " << result.metrics[metric].second;
+                }
+                out << "}";
+            }
+            out << "}";
+        }
+        out << (results.empty() ? "]\n}\n" : "\n  ]\n}\n");
+    }
+
+    bool save(const std::string &fileName) {
+        std::ofstream file(fileName, std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        writeJson(file);
+        return file.good();
+    }
+
+  protected:
+    std::mutex mtx;
+    std::vector<BenchmarkResult> results;
+};
+
+// Writes collected results after the last test, processes without benchmarks leave no file behind.
+class BenchmarkEnvironment : public ::testing::Environment {
+  public:
+    void TearDown() override {
+        auto &results = BenchmarkResults::getInstance();
+        if (!results.get().empty()) {
+            results.save(BenchmarkResults::getOutputFileName());
+        }
+    }
+};
+
+// Measures steady state host cost of an operation. Every thread calls the operation with its index
+// and iteration number; warm up iterations are not measured. Cost per operation of a repetition is
+// the time of the slowest thread divided by iteration count, median of all repetitions is reported.
+class BenchmarkRunner {
+  public:
+    static constexpr uint32_t defaultIterations = 1000u;
+    static constexpr uint32_t defaultRepetitions = 5u;
+    static constexpr uint32_t defaultWarmUpIterations = 100u;
+
+    using Operation = std::function<void(uint32_t threadIndex, uint32_t iteration)>;
+
+    static std::vector<uint32_t> getThreadCounts() {
+        return {1u, 2u, 4u};
+    }
+
+    static BenchmarkResult run(const std::string &name, uint32_t threadCount, const Operation &operation,
+                               uint32_t iterations = defaultIterations, uint32_t repetitions = defaultRepetitions,
+                               uint32_t warmUpIterations = defaultWarmUpIterations) {
+        threadCount = std::max(threadCount, 1u);
+        for (uint32_t thread = 0; thread < threadCount; thread++) {
+            for (uint32_t iteration = 0; iteration < warmUpIterations; iteration++) {
+                operation(thread, iteration);
+            }
+        }
+
+        std::vector<double> nsPerOperation;
+        for (uint32_t repetition = 0; repetition < repetitions; repetition++) {
+            nsPerOperation.push_back(measure(threadCount, iterations, operation));
+        }
+        std::sort(nsPerOperation.begin(), nsPerOperation.end());
+
+        BenchmarkResult result;
+        result.name = name;
+        result.threadCount = threadCount;
+        result.iterations = iterations;
+        result.repetitions = repetitions;
+        if (!nsPerOperation.empty()) {
+            result.medianNsPerOperation = nsPerOperation[nsPerOperation.size() / 2];
+            result.minNsPerOperation = nsPerOperation.front();
+            result.maxNsPerOperation = nsPerOperation.back();
+        }
+        BenchmarkResults::getInstance().add(result);
+        return result;
+    }
+
+  protected:
+    static double measure(uint32_t threadCount, uint32_t iterations, const Operation &operation) {
+        std::atomic<uint32_t> readyThreads(0u);
+        std::atomic<bool> start(false);
+        std::vector<int64_t> elapsedNs(threadCount, 0);
+
+        auto threadFunction = [&](uint32_t thread) {
+            readyThreads++;
+            while (!start) {
+                std::this_thread::yield();
+            }
+            auto begin = std::chrono::steady_clock::now();
+            for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+                operation(thread, iteration);
+            }
+            elapsedNs[thread] = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+        };
+
+        std::vector<std::thread> threads;
+        for (uint32_t thread = 1; thread < threadCount; thread++) {
+            threads.push_back(std::thread(threadFunction, thread));
+        }
+        while (readyThreads != threadCount - 1) {
+            std::this_thread::yield();
+        }
+        start = true;
+        threadFunction(0u);
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        auto slowestThreadNs = *std::max_element(elapsedNs.begin(), elapsedNs.end());
+        return iterations > 0u ? static_cast<double>(slowestThreadNs) / iterations : 0.0;
+    }
+};
+
+} // namespace NEO
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/unit_test/helpers/benchmark_runner.h"
+#include "shared/test/unit_test/helpers/memory_management.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+
+using namespace NEO;
+
+struct MockBenchmarkResults : public BenchmarkResults {
+    using BenchmarkResults::results;
+};
+
+TEST(BenchmarkResultsTest, givenNoResultsWhenWritingJsonThenEmptyBenchmarkListIsWritten) {
+    MockBenchmarkResults benchmarkResults;
+    std::stringstream stream;
+    benchmarkResults.writeJson(stream);
+    EXPECT_STREQ("{\n  \"benchmarks\": []\n}\n", stream.str().c_str());
+}
+
+TEST(BenchmarkResultsTest, givenResultsWhenWritingJsonThenAllFieldsAreWrittenAndNameIsEscaped) {
+    MockBenchmarkResults benchmarkResults;
+    BenchmarkResult result;
+    result.name = "enqueue \"kernel\"";
+    result.threadCount = 2u;
+    result.iterations = 10u;
+    result.repetitions = 3u;
+    result.medianNsPerOperation = 20.0;
+    result.minNsPerOperation = 10.0;
+    result.maxNsPerOperation = 30.5;
+    benchmarkResults.add(result);
+    benchmarkResults.add(result);
+
+    std::stringstream stream;
+    benchmarkResults.writeJson(stream);
+    auto expectedEntry = std::string("{\"name\": \"enqueue \\\"kernel\\\"\", \"threads\": 2, \"iterations\": 10, \"repetitions\": 3, "
+                                     "\"ns_per_op\": {\"median\": 20.0, \"min\": 10.0, \"max\": 30.5}}");
+    EXPECT_STREQ(("{\n  \"benchmarks\": [\n    " + expectedEntry + ",\n    " + expectedEntry + "\n  ]\n}\n").c_str(), stream.str().c_str());
+}
+
+TEST(BenchmarkResultsTest, givenMetricsAddedAfterResultWhenWritingJsonThenMetricsAreWrittenWithLastResultOnly) {
+    MockBenchmarkResults benchmarkResults;
+    benchmarkResults.addMetric("ignored", 1.0);
+    BenchmarkResult result;
+    result.name = "first";
+    benchmarkResults.add(result);
+    result.name = "second";
+    benchmarkResults.add(result);
+    benchmarkResults.addMetric("reused_surface_states", 999.0);
+    benchmarkResults.addMetric("saved \"ssh\" bytes", 63936.0);
+
+    ASSERT_EQ(2u, benchmarkResults.results.size());
+    EXPECT_TRUE(benchmarkResults.results[0].metrics.empty());
+    ASSERT_EQ(2u, benchmarkResults.results[1].metrics.size());
+
+    std::stringstream stream;
+    benchmarkResults.writeJson(stream);
+    auto timing = std::string("\"threads\": 0, \"iterations\": 0, \"repetitions\": 0, \"ns_per_op\": {\"median\": 0.0, \"min\": 0.0, \"max\": 0.0}");
+    auto expected = std::string("{\n  \"benchmarks\": [\n    {\"name\": \"first\", ") + timing + "},\n" +
+                    "    {\"name\": \"second\", " + timing + ", \"metrics\": {\"reused_surface_states\": 999.0, \"saved \\\"ssh\\\" bytes\": 63936.0}}\n  ]\n}\n";
+    EXPECT_STREQ(expected.c_str(), stream.str().c_str());
+}
+
+TEST(BenchmarkRunnerTest, whenRunningBenchmarkThenOperationIsCalledOnEveryThreadForWarmUpAndAllRepetitions) {
+    // Results of the process are kept by a singleton which outlives the test.
+    MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+    std::atomic<uint32_t> calls(0u);
+    std::atomic<uint32_t> maxThreadIndex(0u);
+    auto result = BenchmarkRunner::run("test", 3u, [&](uint32_t thread, uint32_t iteration) {
+        calls++;
+        auto currentMax = maxThreadIndex.load();
+        while (thread > currentMax && !maxThreadIndex.compare_exchange_weak(currentMax, thread)) {
+        }
+    },
+                                       4u, 2u, 1u);
+    BenchmarkResults::getInstance().clear();
+
+    EXPECT_EQ(3u * (1u + 4u * 2u), calls.load());
+    EXPECT_EQ(2u, maxThreadIndex.load());
+    EXPECT_EQ(3u, result.threadCount);
+    EXPECT_EQ(4u, result.iterations);
+    EXPECT_EQ(2u, result.repetitions);
+    EXPECT_LE(result.minNsPerOperation, result.medianNsPerOperation);
+    EXPECT_LE(result.medianNsPerOperation, result.maxNsPerOperation);
+}
@@ -339,3 +339,92 @@ HWTEST2_F(BlitTests, givenGen9AndGetBlitAllocationPropertiesThenCorrectValuesAre
     EXPECT_EQ(expectedtileType, tileType);
     EXPECT_EQ(expectedMipTailLod, mipTailLod);
 }
+
+HWTEST_F(BlitTests, givenBlitterCopyPlannerDisabledWhenCountingBlitCommandsThenCountMatchesCopySizeEstimation) {
+    BlitProperties properties = {};
+    properties.srcGpuAddress = 0x1003;
+    properties.dstGpuAddress = 0x20000;
+    properties.copySize = {static_cast<size_t>(2 * BlitCommandsHelper<FamilyType>::getMaxBlitWidth() + 5), 3, 2};
+    properties.srcRowPitch = properties.dstRowPitch = 0x20000;
+    properties.srcSlicePitch = properties.dstSlicePitch = 0x80000;
+
+    auto numberOfBlits = BlitCommandsHelper<FamilyType>::getNumberOfBlitCommandsForBuffer(properties);
+    EXPECT_EQ(12u, numberOfBlits);
+    EXPECT_EQ(BlitCommandsHelper<FamilyType>::estimateBlitCommandsSize(properties.copySize, properties.csrDependencies, false, false),
+              BlitCommandsHelper<FamilyType>::estimateBlitCommandsSizeForNumberOfBlits(numberOfBlits, properties.csrDependencies, false, false));
+}
+
+HWTEST_F(BlitTests, givenBlitterCopyPlannerEnabledAndRectCopyWhenDispatchingThenRowsOfEachSliceAreCopiedWithOneBlit) {
+    using XY_COPY_BLT = typename FamilyType::XY_COPY_BLT;
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.EnableBlitterCopyPlanner.set(1);
+
+    BlitProperties properties = {};
+    properties.srcGpuAddress = 0x10000;
+    properties.dstGpuAddress = 0x40000;
+    properties.copySize = {100, 16, 2};
+    properties.srcRowPitch = 0x100;
+    properties.dstRowPitch = 0x200;
+    properties.srcSlicePitch = 0x1000;
+    properties.dstSlicePitch = 0x2000;
+
+    EXPECT_EQ(2u, BlitCommandsHelper<FamilyType>::getNumberOfBlitCommandsForBuffer(properties));
+
+    uint32_t streamBuffer[256] = {};
+    LinearStream stream(streamBuffer, sizeof(streamBuffer));
+    BlitCommandsHelper<FamilyType>::dispatchBlitCommandsForBuffer(properties, stream, pDevice->getRootDeviceEnvironment());
+    EXPECT_EQ(2 * (sizeof(XY_COPY_BLT) + BlitCommandsHelper<FamilyType>::estimatePostBlitCommandSize()), stream.getUsed());
+
+    auto bltCmd = genCmdCast<XY_COPY_BLT *>(streamBuffer);
+    ASSERT_NE(nullptr, bltCmd);
+    EXPECT_EQ(16u, bltCmd->getTransferHeight());
+    EXPECT_EQ(properties.srcGpuAddress, bltCmd->getSourceBaseAddress());
+    EXPECT_EQ(properties.dstGpuAddress, bltCmd->getDestinationBaseAddress());
+}
+
+HWTEST_F(BlitTests, givenBlitterCopyPlannerEnabledAndRectCopyWithOddSlicePitchWhenDispatchingThenEverySliceIsCopiedByteWise) {
+    using XY_COPY_BLT = typename FamilyType::XY_COPY_BLT;
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.EnableBlitterCopyPlanner.set(1);
+
+    BlitProperties properties = {};
+    properties.srcGpuAddress = 0x10000;
+    properties.dstGpuAddress = 0x40000;
+    properties.copySize = {64, 16, 2};
+    properties.srcRowPitch = 0x100;
+    properties.dstRowPitch = 0x200;
+    properties.srcSlicePitch = 0x1001;
+    properties.dstSlicePitch = 0x2000;
+
+    EXPECT_EQ(2u, BlitCommandsHelper<FamilyType>::getNumberOfBlitCommandsForBuffer(properties));
+
+    uint32_t streamBuffer[256] = {};
+    LinearStream stream(streamBuffer, sizeof(streamBuffer));
+    BlitCommandsHelper<FamilyType>::dispatchBlitCommandsForBuffer(properties, stream, pDevice->getRootDeviceEnvironment());
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(cmdList, stream.getCpuBase(), stream.getUsed()));
+    auto bltCmds = findAll<XY_COPY_BLT *>(cmdList.begin(), cmdList.end());
+    ASSERT_EQ(2u, bltCmds.size());
+    for (size_t slice = 0; slice < bltCmds.size(); slice++) {
+        auto bltCmd = genCmdCast<XY_COPY_BLT *>(*bltCmds[slice]);
+        EXPECT_EQ(properties.srcGpuAddress + slice * properties.srcSlicePitch, bltCmd->getSourceBaseAddress());
+        EXPECT_EQ(properties.dstGpuAddress + slice * properties.dstSlicePitch, bltCmd->getDestinationBaseAddress());
+        EXPECT_EQ(64u, bltCmd->getTransferWidth());
+        EXPECT_EQ(16u, bltCmd->getTransferHeight());
+    }
+}
+
+HWTEST_F(BlitTests, givenBlitterCopyPlannerEnabledAndDenselyPackedRowsWhenCountingBlitCommandsThenCopyIsPlannedAsLinear) {
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.EnableBlitterCopyPlanner.set(1);
+
+    BlitProperties properties = {};
+    properties.srcGpuAddress = 0x10000;
+    properties.dstGpuAddress = 0x40000;
+    properties.copySize = {64, 4, 2};
+    properties.srcRowPitch = properties.dstRowPitch = 64;
+    properties.srcSlicePitch = properties.dstSlicePitch = 256;
+
+    EXPECT_EQ(1u, BlitCommandsHelper<FamilyType>::getNumberOfBlitCommandsForBuffer(properties));
+}
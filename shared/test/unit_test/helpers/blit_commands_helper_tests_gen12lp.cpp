@@ -341,4 +341,64 @@ HWTEST2_F(BlitTests, givenSrcTiledImageAndNotTiledDstWhenAppendBlitCommandsForIm
     BlitCommandsHelper<FamilyType>::appendBlitCommandsForImages(properties, bltCmd);
     EXPECT_EQ(bltCmd.getSourcePitch(), expectedPitch / sizeof(uint32_t));
     EXPECT_EQ(bltCmd.getDestinationPitch(), properties.dstRowPitch);
-}
\ No newline at end of file
+}
+
+HWTEST2_F(BlitTests, givenBlitterCopyPlannerEnabledAndAlignedBufferCopyWhenDispatchingThenWidestColorDepthIsUsed, IsGen12LP) {
+    using XY_COPY_BLT = typename FamilyType::XY_COPY_BLT;
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.EnableBlitterCopyPlanner.set(1);
+
+    BlitProperties properties = {};
+    properties.srcGpuAddress = 0x100000;
+    properties.dstGpuAddress = 0x200000;
+    properties.copySize = {0x10000, 1, 1};
+
+    EXPECT_EQ(1u, BlitCommandsHelper<FamilyType>::estimateBlitCommandsSize(properties.copySize, properties.csrDependencies, false, false) /
+                      (sizeof(XY_COPY_BLT) + BlitCommandsHelper<FamilyType>::estimatePostBlitCommandSize()));
+    EXPECT_EQ(1u, BlitCommandsHelper<FamilyType>::getNumberOfBlitCommandsForBuffer(properties));
+
+    uint32_t streamBuffer[64] = {};
+    LinearStream stream(streamBuffer, sizeof(streamBuffer));
+    BlitCommandsHelper<FamilyType>::dispatchBlitCommandsForBuffer(properties, stream, pDevice->getRootDeviceEnvironment());
+
+    auto bltCmd = genCmdCast<XY_COPY_BLT *>(streamBuffer);
+    ASSERT_NE(nullptr, bltCmd);
+    EXPECT_EQ(XY_COPY_BLT::COLOR_DEPTH::COLOR_DEPTH_128_BIT_COLOR, bltCmd->getColorDepth());
+    EXPECT_EQ(0x1000u, bltCmd->getTransferWidth());
+    EXPECT_EQ(1u, bltCmd->getTransferHeight());
+    EXPECT_EQ(0x10000u, bltCmd->getSourcePitch());
+    EXPECT_EQ(0x10000u, bltCmd->getDestinationPitch());
+}
+
+HWTEST2_F(BlitTests, givenBlitterCopyPlannerEnabledAndEquallyMisalignedBufferCopyWhenPlanningThenHeadAndTailAreCopiedByteWise, IsGen12LP) {
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.EnableBlitterCopyPlanner.set(1);
+
+    BlitProperties properties = {};
+    properties.srcGpuAddress = 0x100003;
+    properties.dstGpuAddress = 0x200003;
+    properties.copySize = {0x10000, 1, 1};
+
+    std::vector<BlitCopyRegion> regions;
+    BlitCommandsHelper<FamilyType>::planBlitCommandsForBuffer(properties, [&regions](const BlitCopyRegion &region) { regions.push_back(region); });
+    ASSERT_EQ(3u, regions.size());
+
+    EXPECT_EQ(1u, regions[0].bytesPerPixel);
+    EXPECT_EQ(13u, regions[0].width);
+    EXPECT_EQ(0x200003u, regions[0].dstAddress);
+
+    EXPECT_EQ(16u, regions[1].bytesPerPixel);
+    EXPECT_EQ(0xFFFu, regions[1].width);
+    EXPECT_EQ(0x200010u, regions[1].dstAddress);
+    EXPECT_EQ(0x100010u, regions[1].srcAddress);
+
+    EXPECT_EQ(1u, regions[2].bytesPerPixel);
+    EXPECT_EQ(3u, regions[2].width);
+    EXPECT_EQ(0x210000u, regions[2].dstAddress);
+}
+
+HWTEST2_F(BlitTests, givenDifferentlyMisalignedAddressesWhenSelectingBytesPerPixelThenWidestCommonAlignmentIsUsed, IsGen12LP) {
+    EXPECT_EQ(16u, BlitCommandsHelper<FamilyType>::selectBytesPerPixelForLinearCopy(0x100000, 0x200000, 0x10000));
+    EXPECT_EQ(4u, BlitCommandsHelper<FamilyType>::selectBytesPerPixelForLinearCopy(0x100004, 0x200000, 0x10000));
+    EXPECT_EQ(1u, BlitCommandsHelper<FamilyType>::selectBytesPerPixelForLinearCopy(0x100001, 0x200000, 0x10000));
+}
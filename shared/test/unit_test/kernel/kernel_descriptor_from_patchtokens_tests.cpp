@@ -425,6 +425,11 @@ TEST(KernelDescriptorFromPatchtokens, GivenPrintfStringThenPopulatesStringsMapIn
     EXPECT_EQ(str1, kernelDescriptor.kernelMetadata.printfStringsMap[2]);
     EXPECT_EQ(str2, kernelDescriptor.kernelMetadata.printfStringsMap[1]);
     EXPECT_TRUE(kernelDescriptor.kernelMetadata.printfStringsMap[3].empty());
+
+    ASSERT_EQ(4U, kernelDescriptor.kernelMetadata.printfFormatPrograms.size());
+    ASSERT_EQ(1U, kernelDescriptor.kernelMetadata.printfFormatPrograms[2].size());
+    EXPECT_EQ(str1, kernelDescriptor.kernelMetadata.printfFormatPrograms[2][0].text);
+    EXPECT_TRUE(kernelDescriptor.kernelMetadata.printfFormatPrograms[3].empty());
 }
 
 TEST(KernelDescriptorFromPatchtokens, GivenPureStatlessAddressingMdelThenBindfulOffsetIsLeftUndefined) {
@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/utilities/enqueue_phase_profiler.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+extern std::atomic<uint64_t> rdtscCounter;
+extern std::atomic<uint64_t> rdtscIncrement;
+
+using namespace NEO;
+
+struct MockEnqueuePhaseProfiler : public EnqueuePhaseProfiler {
+    using EnqueuePhaseProfiler::lastRequestPollTime;
+    using EnqueuePhaseProfiler::profileFileName;
+    using EnqueuePhaseProfiler::requestFileName;
+
+    MockEnqueuePhaseProfiler() {
+        profileFileName = "testEnqueuePhaseProfile.log";
+        requestFileName = "testEnqueuePhaseProfile.request";
+        std::remove(profileFileName.c_str());
+        std::remove(requestFileName.c_str());
+    }
+
+    ~MockEnqueuePhaseProfiler() {
+        std::remove(profileFileName.c_str());
+        std::remove(requestFileName.c_str());
+    }
+
+    void commitDispatch() {
+        beginDispatch("kernel");
+        record(EnqueuePhase::Enqueue, 1u);
+        endDispatch();
+    }
+};
+
+TEST(EnqueuePhaseProfilerTest, whenGettingBucketIndexThenLog2RoundedUpIsReturned) {
+    EXPECT_EQ(0u, EnqueuePhaseProfiler::getBucketIndex(0u));
+    EXPECT_EQ(1u, EnqueuePhaseProfiler::getBucketIndex(1u));
+    EXPECT_EQ(2u, EnqueuePhaseProfiler::getBucketIndex(2u));
+    EXPECT_EQ(2u, EnqueuePhaseProfiler::getBucketIndex(3u));
+    EXPECT_EQ(11u, EnqueuePhaseProfiler::getBucketIndex(1024u));
+    EXPECT_EQ(EnqueuePhaseProfiler::histogramBucketCount - 1, EnqueuePhaseProfiler::getBucketIndex(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST(EnqueuePhaseProfilerTest, givenNestedDispatchScopesWhenPhasesAreRecordedThenTheyAreSummedAndCommittedOnceForOutermostKernel) {
+    EnqueuePhaseProfiler profiler;
+
+    profiler.beginDispatch("outerKernel");
+    profiler.record(EnqueuePhase::Enqueue, 100u);
+    profiler.beginDispatch("innerKernel");
+    profiler.record(EnqueuePhase::FlushTask, 10u);
+    profiler.record(EnqueuePhase::FlushTask, 20u);
+    profiler.endDispatch();
+    EXPECT_EQ(0u, profiler.getDispatchCount());
+    profiler.endDispatch();
+
+    EXPECT_EQ(1u, profiler.getDispatchCount());
+    auto statistics = profiler.getStatistics();
+    EXPECT_EQ(1u, statistics[static_cast<uint32_t>(EnqueuePhase::Enqueue)].count);
+    EXPECT_EQ(100u, statistics[static_cast<uint32_t>(EnqueuePhase::Enqueue)].totalTicks);
+    EXPECT_EQ(1u, statistics[static_cast<uint32_t>(EnqueuePhase::FlushTask)].count);
+    EXPECT_EQ(30u, statistics[static_cast<uint32_t>(EnqueuePhase::FlushTask)].totalTicks);
+    EXPECT_EQ(0u, statistics[static_cast<uint32_t>(EnqueuePhase::Flush)].count);
+
+    EnqueuePhaseProfiler::Statistics kernelStatistics;
+    EXPECT_TRUE(profiler.getKernelStatistics("outerKernel", kernelStatistics));
+    EXPECT_EQ(30u, kernelStatistics[static_cast<uint32_t>(EnqueuePhase::FlushTask)].totalTicks);
+    EXPECT_FALSE(profiler.getKernelStatistics("innerKernel", kernelStatistics));
+}
+
+TEST(EnqueuePhaseProfilerTest, givenPhaseRecordedOutsideOfDispatchScopeThenItIsCommittedWithoutKernelName) {
+    EnqueuePhaseProfiler profiler;
+
+    profiler.record(EnqueuePhase::Flush, 5u);
+    profiler.beginDispatch(nullptr);
+    profiler.record(EnqueuePhase::Flush, 7u);
+    profiler.endDispatch();
+
+    EXPECT_EQ(2u, profiler.getDispatchCount());
+    EnqueuePhaseProfiler::Statistics kernelStatistics;
+    EXPECT_TRUE(profiler.getKernelStatistics(EnqueuePhaseProfiler::noKernelName, kernelStatistics));
+    auto &flushStatistics = kernelStatistics[static_cast<uint32_t>(EnqueuePhase::Flush)];
+    EXPECT_EQ(2u, flushStatistics.count);
+    EXPECT_EQ(12u, flushStatistics.totalTicks);
+    EXPECT_EQ(5u, flushStatistics.minTicks);
+    EXPECT_EQ(7u, flushStatistics.maxTicks);
+}
+
+TEST(EnqueuePhaseProfilerTest, givenPhaseSamplesWhenGettingPercentileThenUpperBoundOfBucketIsReturned) {
+    EnqueuePhaseProfiler::PhaseStatistics statistics;
+    for (uint32_t i = 0; i < 90; i++) {
+        statistics.add(10u);
+    }
+    for (uint32_t i = 0; i < 10; i++) {
+        statistics.add(1000u);
+    }
+
+    EXPECT_EQ(15u, statistics.getPercentileTicks(50));
+    EXPECT_EQ(15u, statistics.getPercentileTicks(90));
+    EXPECT_EQ(1000u, statistics.getPercentileTicks(99));
+    EXPECT_EQ(1000u, statistics.getPercentileTicks(100));
+}
+
+TEST(EnqueuePhaseProfilerTest, givenRecordedDispatchesWhenDumpingThenPhaseAndKernelNamesArePrinted) {
+    EnqueuePhaseProfiler profiler;
+    profiler.beginDispatch("copyKernel");
+    profiler.record(EnqueuePhase::DispatchWalker, 100u);
+    profiler.record(EnqueuePhase::Residency, 200u);
+    profiler.endDispatch();
+
+    std::stringstream stream;
+    profiler.dump(stream);
+    auto output = stream.str();
+    EXPECT_NE(std::string::npos, output.find("1 dispatches"));
+    EXPECT_NE(std::string::npos, output.find("Kernel copyKernel"));
+    EXPECT_NE(std::string::npos, output.find("DispatchWalker"));
+    EXPECT_NE(std::string::npos, output.find("Residency"));
+    EXPECT_EQ(std::string::npos, output.find("FlushTask"));
+}
+
+TEST(EnqueuePhaseProfilerTest, whenResetIsCalledThenAllStatisticsAreCleared) {
+    EnqueuePhaseProfiler profiler;
+    profiler.beginDispatch("kernel");
+    profiler.record(EnqueuePhase::Enqueue, 1u);
+    profiler.endDispatch();
+
+    profiler.reset();
+
+    EXPECT_EQ(0u, profiler.getDispatchCount());
+    EXPECT_EQ(0u, profiler.getStatistics()[static_cast<uint32_t>(EnqueuePhase::Enqueue)].count);
+    EnqueuePhaseProfiler::Statistics kernelStatistics;
+    EXPECT_FALSE(profiler.getKernelStatistics("kernel", kernelStatistics));
+}
+
+TEST(EnqueuePhaseProfilerTest, givenProfilerNotEnabledWhenScopesAreUsedThenTimeStampCounterIsNotReadAndNothingIsRecorded) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableEnqueuePhaseProfiler.set(0);
+    EXPECT_FALSE(EnqueuePhaseProfiler::isEnabled());
+
+    auto dispatchCount = EnqueuePhaseProfiler::getInstance().getDispatchCount();
+    auto counter = rdtscCounter.load();
+    {
+        EnqueuePhaseProfiler::ScopedDispatch dispatch("kernel");
+        EnqueuePhaseProfiler::ScopedPhase phase(EnqueuePhase::Enqueue);
+    }
+    EXPECT_EQ(counter, rdtscCounter.load());
+    EXPECT_EQ(dispatchCount, EnqueuePhaseProfiler::getInstance().getDispatchCount());
+}
+
+TEST(EnqueuePhaseProfilerTest, whenGettingTicksPerMicrosecondThenPositiveValueIsReturned) {
+    EnqueuePhaseProfiler profiler;
+    rdtscIncrement = 1000u;
+    EXPECT_LT(0.0, profiler.getTicksPerMicrosecond());
+    rdtscIncrement = 1u;
+}
+
+TEST(EnqueuePhaseProfilerTest, givenDumpRequestedWhenDispatchIsCommittedThenProfileIsDumpedToFileOnce) {
+    MockEnqueuePhaseProfiler profiler;
+    profiler.commitDispatch();
+    EXPECT_FALSE(fileExists(profiler.profileFileName));
+
+    profiler.requestDump();
+    profiler.commitDispatch();
+    EXPECT_TRUE(fileExists(profiler.profileFileName));
+    EXPECT_FALSE(fileExists(profiler.profileFileName + ".tmp"));
+
+    std::remove(profiler.profileFileName.c_str());
+    profiler.commitDispatch();
+    EXPECT_FALSE(fileExists(profiler.profileFileName));
+}
+
+TEST(EnqueuePhaseProfilerTest, givenDumpRequestFileWhenDispatchIsCommittedAfterPollIntervalThenProfileIsDumpedAndRequestFileIsRemoved) {
+    MockEnqueuePhaseProfiler profiler;
+    std::ofstream(profiler.requestFileName).close();
+    ASSERT_TRUE(fileExists(profiler.requestFileName));
+
+    profiler.lastRequestPollTime -= std::chrono::milliseconds(EnqueuePhaseProfiler::dumpRequestPollIntervalMs);
+    profiler.commitDispatch();
+    EXPECT_TRUE(fileExists(profiler.profileFileName));
+    EXPECT_FALSE(fileExists(profiler.requestFileName));
+}
+
+TEST(EnqueuePhaseProfilerTest, givenDumpIntervalWhenDispatchesAreCommittedConcurrentlyThenCompleteProfileIsDumped) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnqueuePhaseProfilerDumpInterval.set(1);
+    MockEnqueuePhaseProfiler profiler;
+
+    std::vector<std::thread> threads;
+    for (uint32_t thread = 0; thread < 4; thread++) {
+        threads.emplace_back([&profiler]() {
+            for (uint32_t dispatch = 0; dispatch < 16; dispatch++) {
+                profiler.commitDispatch();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_FALSE(fileExists(profiler.profileFileName + ".tmp"));
+    std::ifstream file(profiler.profileFileName);
+    std::stringstream content;
+    content << file.rdbuf();
+    // last dump starts after all dispatches are committed
+    EXPECT_NE(std::string::npos, content.str().find("64 dispatches"));
+    EXPECT_NE(std::string::npos, content.str().find("Kernel kernel"));
+}
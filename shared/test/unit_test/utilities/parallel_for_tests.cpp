@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2020 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_for.h"
+#include "shared/test/unit_test/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+TEST(ParallelForTest, givenMultipleThreadsWhenParallelForIsCalledThenEveryIndexIsProcessedExactlyOnce) {
+    std::vector<std::atomic<uint32_t>> calls(100);
+    for (auto &call : calls) {
+        call = 0u;
+    }
+
+    parallelFor(calls.size(), 4u, [&](size_t index) {
+        calls[index]++;
+    });
+
+    for (auto &call : calls) {
+        EXPECT_EQ(1u, call.load());
+    }
+}
+
+TEST(ParallelForTest, givenSingleThreadWhenParallelForIsCalledThenIndicesAreProcessedInOrder) {
+    std::vector<size_t> order;
+
+    parallelFor(5u, 1u, [&](size_t index) {
+        order.push_back(index);
+    });
+
+    EXPECT_EQ((std::vector<size_t>{0u, 1u, 2u, 3u, 4u}), order);
+}
+
+TEST(ParallelForTest, givenThrowingTasksWhenParallelForIsCalledThenAllIndicesRunAndExceptionOfLowestIndexIsRethrown) {
+    std::atomic<uint32_t> calls(0u);
+
+    try {
+        parallelFor(16u, 4u, [&](size_t index) {
+            calls++;
+            if (index == 11u || index == 5u) {
+                throw std::runtime_error(std::to_string(index));
+            }
+        });
+        FAIL();
+    } catch (const std::runtime_error &error) {
+        EXPECT_STREQ("5", error.what());
+    }
+    EXPECT_EQ(16u, calls.load());
+}
+
+TEST(ParallelForTest, givenKernelInitializationThreadCountDebugVariableWhenThreadCountIsQueriedThenItIsBoundedByKernelCount) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(1u, getKernelInitializationThreadCount(100u));
+
+    DebugManager.flags.KernelInitializationThreadCount.set(8);
+    EXPECT_EQ(8u, getKernelInitializationThreadCount(100u));
+    EXPECT_EQ(3u, getKernelInitializationThreadCount(3u));
+    EXPECT_EQ(1u, getKernelInitializationThreadCount(1u));
+
+    DebugManager.flags.KernelInitializationThreadCount.set(1);
+    EXPECT_EQ(1u, getKernelInitializationThreadCount(100u));
+
+    DebugManager.flags.KernelInitializationThreadCount.set(0);
+    EXPECT_LE(1u, getKernelInitializationThreadCount(100u));
+}